@@ -11,15 +11,18 @@ option(VGCPU_ENABLE_UBSAN "Enable UndefinedBehaviorSanitizer" OFF)
 option(VGCPU_ENABLE_TSAN "Enable ThreadSanitizer" OFF)
 option(VGCPU_ENABLE_LINT "Enable clang-tidy linting" OFF)
 option(VGCPU_ENABLE_ALLOC_INSTRUMENTATION "Enable allocation instrumentation for testing" OFF)
+option(VGCPU_BACKEND_PLUGINS "Build third-party backends as plugins loaded on demand" OFF)
 
 # -----------------------------------------------------------------------------
 # Backend Options (preserve existing ENABLE_* names per [DEC-BUILD-01])
-# Tier-1 backends: null, plutovg, blend2d (always ON unless tier1-only mode forces others OFF)
+# Tier-1 backends: null, decode, vgcpu_ref, plutovg, blend2d (always ON unless tier1-only mode forces others OFF)
 # Optional backends: all others
 # -----------------------------------------------------------------------------
 
 # Tier-1 backends (always available)
 option(ENABLE_NULL_BACKEND "Enable Null backend (Tier-1)" ON)
+option(ENABLE_DECODE_BACKEND "Enable decode-only baseline backend (Tier-1)" ON)
+option(ENABLE_VGCPU_REF "Enable built-in reference rasterizer backend (Tier-1)" ON)
 option(ENABLE_PLUTOVG "Enable PlutoVG backend (Tier-1)" ON)
 option(ENABLE_BLEND2D "Enable Blend2D backend (Tier-1)" ON)
 
@@ -34,7 +37,7 @@ if(VGCPU_TIER1_ONLY)
     set(ENABLE_AMANITHVG OFF CACHE BOOL "Enable AmanithVG SRE backend (Optional)" FORCE)
     set(ENABLE_RAQOTE OFF CACHE BOOL "Enable Raqote backend (Optional/Rust)" FORCE)
     set(ENABLE_VELLO_CPU OFF CACHE BOOL "Enable vello_cpu backend (Optional/Rust)" FORCE)
-    message(STATUS "[DEC-SCOPE-02] VGCPU_TIER1_ONLY=ON: Building Tier-1 backends only (null, plutovg, blend2d)")
+    message(STATUS "[DEC-SCOPE-02] VGCPU_TIER1_ONLY=ON: Building Tier-1 backends only (null, decode, vgcpu_ref, plutovg, blend2d)")
 else()
     # Developer mode: optional backends default ON
     option(ENABLE_CAIRO "Enable Cairo backend (Optional)" ON)
@@ -0,0 +1,38 @@
+#pragma once
+#include "common/pixel_format.h"
+
+#include <cstdint>
+#include <span>
+
+namespace vgcpu::artifacts {
+
+/**
+ * @brief Converts 32-bit pixels between layouts (R/B swizzle, premultiply, unpremultiply).
+ *
+ * Runs outside the measured loop: backends render in their native format and artifacts/SSIM
+ * convert to straight RGBA8 afterwards. Uses SSE2 or NEON when available. `src` and `dst` may
+ * alias exactly (in-place conversion).
+ *
+ * @param src Source pixels (4 bytes per pixel).
+ * @param src_format Layout of `src`.
+ * @param dst Destination pixels; must hold at least as many bytes as `src`.
+ * @param dst_format Layout to write.
+ * @return false if `dst` is too small or `src` is not a whole number of pixels.
+ */
+bool convert_pixels(std::span<const uint8_t> src, PixelFormat src_format, std::span<uint8_t> dst,
+                    PixelFormat dst_format);
+
+/**
+ * @brief Portable reference implementation of convert_pixels (no SIMD).
+ *
+ * The vectorized paths produce bit-identical results; exposed for tests and benchmarks.
+ */
+bool convert_pixels_scalar(std::span<const uint8_t> src, PixelFormat src_format,
+                           std::span<uint8_t> dst, PixelFormat dst_format);
+
+/**
+ * @brief Instruction set used by convert_pixels ("sse2", "neon" or "scalar").
+ */
+const char* convert_pixels_isa();
+
+}  // namespace vgcpu::artifacts
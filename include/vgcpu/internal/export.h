@@ -39,6 +39,14 @@
 #define VGCPU_EXPORT
 #endif
 
+// Entry points of backend plugins (MODULE libraries loaded at runtime by the adapter registry).
+// Always exported with C linkage, independent of VGCPU_SHARED_LIBRARY.
+#if defined(VGCPU_PLATFORM_WINDOWS)
+#define VGCPU_PLUGIN_EXPORT extern "C" __declspec(dllexport)
+#else
+#define VGCPU_PLUGIN_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
 // Internal visibility (not exported)
 #if defined(VGCPU_COMPILER_MSVC)
 #define VGCPU_INTERNAL
@@ -20,7 +20,7 @@
     ((VGCPU_VERSION_MAJOR * 10000) + (VGCPU_VERSION_MINOR * 100) + VGCPU_VERSION_PATCH)
 
 // Report schema version per [REQ-133]
-#define VGCPU_REPORT_SCHEMA_VERSION "0.1.0"
+#define VGCPU_REPORT_SCHEMA_VERSION "0.2.0"
 
 // Build info (set by CMake or defaults)
 #ifndef VGCPU_GIT_COMMIT
@@ -1,7 +1,7 @@
 // Raqote C FFI Bridge
 // Blueprint Reference: backends/raqote.md
 
-use raqote::{DrawTarget, SolidSource, Source, DrawOptions, PathBuilder, StrokeStyle, LineCap, LineJoin};
+use raqote::{DrawTarget, SolidSource, Source, DrawOptions, PathBuilder, StrokeStyle, LineCap, LineJoin, Transform};
 
 
 /// Opaque handle to Raqote DrawTarget
@@ -38,7 +38,20 @@ pub extern "C" fn rqt_clear(ptr: *mut RqtSurface, r: u8, g: u8, b: u8, a: u8) {
     if ptr.is_null() { return; }
     let surf = unsafe { &mut *ptr };
     let color = SolidSource::from_unpremultiplied_argb(a, r, g, b);
+    // Clear covers the whole surface in device space, whatever the current transform
+    let transform = *surf.dt.get_transform();
+    surf.dt.set_transform(&Transform::identity());
     surf.dt.clear(color);
+    surf.dt.set_transform(&transform);
+}
+
+/// Set the current transform (x' = a*x + c*y + e, y' = b*x + d*y + f).
+/// It applies to paths drawn afterwards; the caller owns the save/restore stack.
+#[no_mangle]
+pub extern "C" fn rqt_set_transform(ptr: *mut RqtSurface, a: f32, b: f32, c: f32, d: f32, e: f32, f: f32) {
+    if ptr.is_null() { return; }
+    let surf = unsafe { &mut *ptr };
+    surf.dt.set_transform(&Transform::new(a, b, c, d, e, f));
 }
 
 #[no_mangle]
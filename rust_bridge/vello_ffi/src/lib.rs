@@ -2,7 +2,7 @@
 // Blueprint Reference: backends/vello.md
 
 use vello_cpu::{RenderContext, Pixmap};
-use vello_cpu::kurbo::{BezPath, Rect};
+use vello_cpu::kurbo::{Affine, BezPath, Rect};
 use vello_cpu::peniko::Color;
 
 /// Opaque handle to Vello RenderContext
@@ -10,6 +10,7 @@ pub struct VloSurface {
     ctx: RenderContext,
     width: u16,
     height: u16,
+    transform: Affine,
 }
 
 /// Helper for path construction
@@ -26,7 +27,7 @@ pub extern "C" fn vlo_create(width: i32, height: i32) -> *mut VloSurface {
     let w = width as u16;
     let h = height as u16;
     let ctx = RenderContext::new(w, h);
-    Box::into_raw(Box::new(VloSurface { ctx, width: w, height: h }))
+    Box::into_raw(Box::new(VloSurface { ctx, width: w, height: h, transform: Affine::IDENTITY }))
 }
 
 #[no_mangle]
@@ -43,8 +44,21 @@ pub extern "C" fn vlo_clear(ptr: *mut VloSurface, r: u8, g: u8, b: u8, a: u8) {
     let color = Color::from_rgba8(r, g, b, a);
     
     // vello_cpu 0.0.4 doesn't have clear(), but we can fill a rect covering the entire surface
+    // (in device space, whatever the current transform)
+    surf.ctx.set_transform(Affine::IDENTITY);
     surf.ctx.set_paint(color);
     surf.ctx.fill_rect(&Rect::new(0.0, 0.0, surf.width as f64, surf.height as f64));
+    surf.ctx.set_transform(surf.transform);
+}
+
+/// Set the current transform (x' = a*x + c*y + e, y' = b*x + d*y + f).
+/// It applies to paths drawn afterwards; the caller owns the save/restore stack.
+#[no_mangle]
+pub extern "C" fn vlo_set_transform(ptr: *mut VloSurface, a: f32, b: f32, c: f32, d: f32, e: f32, f: f32) {
+    if ptr.is_null() { return; }
+    let surf = unsafe { &mut *ptr };
+    surf.transform = Affine::new([a as f64, b as f64, c as f64, d as f64, e as f64, f as f64]);
+    surf.ctx.set_transform(surf.transform);
 }
 
 #[no_mangle]
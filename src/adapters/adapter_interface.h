@@ -7,17 +7,21 @@
 #pragma once
 
 #include "common/capability_set.h"
+#include "common/pixel_format.h"
 #include "common/status.h"
+#include "ir/ir_format.h"
+#include "ir/prepared_scene.h"
+#include "pal/cpu_features.h"
+#include "pal/memory.h"
 
 #include <cstdint>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace vgcpu {
 
-// Forward declarations
-struct PreparedScene;
-
 /// Adapter metadata information.
 /// Blueprint Reference: [API-06-05] BackendDescriptor (Chapter 4)
 struct AdapterInfo {
@@ -32,15 +36,41 @@ struct AdapterInfo {
 struct SurfaceConfig {
     int width = 0;
     int height = 0;
-    // Future: pixel format, premultiplication settings, etc.
+    PixelFormat format = PixelFormat::kRgba8Premul;  ///< Layout Render writes (adapter's native)
+    int stride = 0;  ///< Bytes per row, a multiple of 4; 0 = width * 4 (tight)
 };
 
+/// Bytes from one row of `config` to the next.
+[[nodiscard]] inline int SurfaceStride(const SurfaceConfig& config) {
+    return config.stride > 0 ? config.stride : config.width * 4;
+}
+
+/// Output pixel storage. The harness allocates it under BenchmarkPolicy::surface_memory
+/// (alignment, huge pages, NUMA placement).
+using SurfaceBuffer = std::vector<uint8_t, pal::SurfaceAllocator<uint8_t>>;
+
+/// Pixels an adapter renders into: a whole SurfaceBuffer, or a window of rows inside one
+/// (TiledAdapter hands each band its rows of the shared surface).
+using SurfaceView = std::span<uint8_t>;
+
 /// Initialization arguments for adapters.
 struct AdapterArgs {
     int thread_count = 1;  ///< Thread count hint (0 = use backend default)
+    /// Highest SIMD level the backend may dispatch to; unset = whatever the CPU supports.
+    /// Only honored by backends with CapabilitySet::supports_isa_cap.
+    std::optional<pal::IsaLevel> max_isa;
     // Future: other configuration options
 };
 
+/// Stroke style of a kSetStroke command, passed to IBackendAdapter::StrokeToPath.
+struct StrokeParams {
+    float width = 1.0f;  ///< User-space line width
+    ir::StrokeCap cap = ir::StrokeCap::kButt;
+    ir::StrokeJoin join = ir::StrokeJoin::kMiter;
+    float miter_limit = 4.0f;       ///< SVG default (not encoded in the IR)
+    float resolution_scale = 1.0f;  ///< Device pixels per user unit; sizes curve tolerances
+};
+
 /// Abstract interface for backend adapters.
 /// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] IBackendAdapter
 /// (Chapter 4)
@@ -75,6 +105,11 @@ class IBackendAdapter {
     /// Get the capability set for this backend.
     [[nodiscard]] virtual CapabilitySet GetCapabilities() const = 0;
 
+    /// Pixel layout the backend renders into without conversion.
+    /// The harness requests this format in SurfaceConfig, so the measured loop never pays for a
+    /// swizzle; artifacts and SSIM convert afterwards (see artifacts::convert_pixels).
+    [[nodiscard]] virtual PixelFormat GetNativeFormat() const { return PixelFormat::kRgba8Premul; }
+
     // -------------------------------------------------------------------------
     // Rendering
     // Blueprint Reference: [API-04] Thread-safety (Chapter 4) / [REQ-56] Reentrancy (Chapter 4) /
@@ -83,12 +118,68 @@ class IBackendAdapter {
 
     /// Render the scene to an output buffer (hot path). [ARCH-14-F]
     /// @param scene The prepared scene to render.
-    /// @param config Surface configuration (width, height).
-    /// @param output_buffer Output pixel buffer (RGBA8, premultiplied).
-    ///                      Will be resized to width * height * 4 bytes.
+    /// @param config Surface configuration (width, height, format, stride).
+    /// @param output_buffer Output pixels in config.format (GetNativeFormat()), at least
+    ///                      SurfaceStride(config) * height bytes. Rows start every stride
+    ///                      bytes; padding past width * 4 is left alone. Backends that cannot
+    ///                      write a padded stride leave supports_surface_stride unset.
     /// @return Status indicating success or failure.
     virtual Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                          std::vector<uint8_t>& output_buffer) = 0;
+                          SurfaceView output_buffer) = 0;
+
+    /// Render `frame_count` frames back to back into the same buffer (hot path).
+    /// The harness times a whole batch per sample and divides, so per-frame costs below the
+    /// timer's resolution stay measurable. Backends may override it to hoist per-call setup
+    /// (surface wrapping, context creation) out of the loop; the default calls Render.
+    /// @return The first failing frame's status.
+    virtual Status RenderBatch(const PreparedScene& scene, const SurfaceConfig& config,
+                               SurfaceView output_buffer, int frame_count) {
+        for (int i = 0; i < frame_count; ++i) {
+            auto status = Render(scene, config, output_buffer);
+            if (status.failed()) {
+                return status;
+            }
+        }
+        return Status::Ok();
+    }
+
+    // -------------------------------------------------------------------------
+    // Pipelined submission (throughput mode)
+    // -------------------------------------------------------------------------
+
+    /// Start rendering a frame into `output_buffer` and return without waiting for it.
+    /// The harness keeps up to BenchmarkPolicy::pipeline_depth frames in flight, one per `slot`
+    /// (0..depth-1), and calls WaitFrame(slot) before reusing a slot or its buffer. The buffer
+    /// stays valid until that wait returns. Backends with deferred or worker-thread rendering
+    /// set CapabilitySet::supports_async_submit and override both calls; the default renders
+    /// synchronously, so a pipeline degenerates to back-to-back Render calls.
+    virtual Status SubmitFrame(const PreparedScene& scene, const SurfaceConfig& config,
+                               SurfaceView output_buffer, uint32_t slot) {
+        (void)slot;
+        return Render(scene, config, output_buffer);
+    }
+
+    /// Block until the frame submitted on `slot` has finished rendering.
+    /// @return The frame's rendering status; Ok for a slot with nothing in flight.
+    virtual Status WaitFrame(uint32_t slot) {
+        (void)slot;
+        return Status::Ok();
+    }
+
+    // -------------------------------------------------------------------------
+    // Stroker isolation
+    // -------------------------------------------------------------------------
+
+    /// Convert a stroked path into the outline the backend's own stroker generates, so stroking
+    /// and rasterization can be timed separately (BenchmarkPolicy::isolate_strokes). The outline
+    /// stays in the path's user space and, filled with the nonzero rule, must cover what the
+    /// stroke covers. Called at prepare time, never inside the measured loop.
+    /// @return Unsupported if the backend does not expose its stroker (the default).
+    virtual Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) {
+        (void)path;
+        (void)stroke;
+        return Status::Unsupported("Backend does not expose its stroker");
+    }
 };
 
 }  // namespace vgcpu
@@ -15,13 +15,30 @@ AdapterRegistry& AdapterRegistry::Instance() {
 }
 
 void AdapterRegistry::Register(std::string id, std::string name, AdapterFactory factory) {
-    adapters_.push_back({std::move(id), std::move(name), std::move(factory)});
+    adapters_.push_back({std::move(id), std::move(name), std::move(factory), {}});
 }
 
-std::vector<std::string> AdapterRegistry::GetAdapterIds() const {
+void AdapterRegistry::RegisterVariant(const std::string& base_id, const std::string& params,
+                                      std::string name, AdapterFactory factory) {
+    adapters_.push_back(
+        {MakeVariantId(base_id, params), std::move(name), std::move(factory), base_id});
+}
+
+std::string AdapterRegistry::MakeVariantId(const std::string& base_id, const std::string& params) {
+    return params.empty() ? base_id : base_id + kVariantSeparator + params;
+}
+
+std::string AdapterRegistry::MakeVariantName(const std::string& name, const std::string& params) {
+    return params.empty() ? name : name + " [" + params + "]";
+}
+
+std::vector<std::string> AdapterRegistry::GetAdapterIds(bool include_variants) const {
     std::vector<std::string> ids;
     ids.reserve(adapters_.size());
     for (const auto& entry : adapters_) {
+        if (entry.is_variant() && !include_variants) {
+            continue;
+        }
         ids.push_back(entry.id);
     }
     // Blueprint Reference: [REQ-29] Deterministic ordering (Chapter 2) / [ARCH-13-02c] SceneStats
@@ -30,6 +47,20 @@ std::vector<std::string> AdapterRegistry::GetAdapterIds() const {
     return ids;
 }
 
+std::vector<std::string> AdapterRegistry::GetVariantIds(const std::string& base_id) const {
+    std::vector<std::string> ids;
+    if (base_id.empty()) {
+        return ids;
+    }
+    for (const auto& entry : adapters_) {
+        if (entry.base_id == base_id) {
+            ids.push_back(entry.id);
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
 const std::vector<AdapterEntry>& AdapterRegistry::GetAdapters() const {
     return adapters_;
 }
@@ -18,11 +18,18 @@ namespace vgcpu {
 /// Factory function type for creating adapters.
 using AdapterFactory = std::function<std::unique_ptr<IBackendAdapter>()>;
 
+/// Separator between a backend id and its variant parameters (e.g. "cairo:aa=fast").
+inline constexpr char kVariantSeparator = ':';
+
 /// Adapter registry entry.
 struct AdapterEntry {
     std::string id;
     std::string name;
     AdapterFactory factory;
+    /// Base backend id for parameterized variants; empty for the default operating point.
+    std::string base_id;
+
+    [[nodiscard]] bool is_variant() const { return !base_id.empty(); }
 };
 
 /// Registry of available backend adapters.
@@ -30,14 +37,27 @@ struct AdapterEntry {
 /// 4)
 class AdapterRegistry {
    public:
+    /// An empty registry. Backends register with Instance(); standalone registries are for tests.
+    AdapterRegistry() = default;
+
     /// Get the singleton instance.
     static AdapterRegistry& Instance();
 
     /// Register an adapter with the registry.
     void Register(std::string id, std::string name, AdapterFactory factory);
 
+    /// Register a named quality/speed variant of an already registered backend.
+    /// The variant id is "<base_id>:<params>", e.g. RegisterVariant("cairo", "aa=fast", ...).
+    /// The adapter created by the factory must report the same id from GetInfo().
+    void RegisterVariant(const std::string& base_id, const std::string& params, std::string name,
+                         AdapterFactory factory);
+
     /// Get list of registered adapter IDs.
-    [[nodiscard]] std::vector<std::string> GetAdapterIds() const;
+    /// @param include_variants Also list parameterized variants (default: base backends only).
+    [[nodiscard]] std::vector<std::string> GetAdapterIds(bool include_variants = false) const;
+
+    /// Get the sorted variant IDs registered for a base backend (excluding the base itself).
+    [[nodiscard]] std::vector<std::string> GetVariantIds(const std::string& base_id) const;
 
     /// Get list of all adapter entries.
     [[nodiscard]] const std::vector<AdapterEntry>& GetAdapters() const;
@@ -49,8 +69,16 @@ class AdapterRegistry {
     /// @return nullptr if adapter not found.
     [[nodiscard]] std::unique_ptr<IBackendAdapter> CreateAdapter(const std::string& id) const;
 
+    /// Build a variant id from a base backend id and its parameter string.
+    /// Empty params yield the base id unchanged.
+    [[nodiscard]] static std::string MakeVariantId(const std::string& base_id,
+                                                   const std::string& params);
+
+    /// Build a variant display name ("<name> [<params>]"); empty params yield the name unchanged.
+    [[nodiscard]] static std::string MakeVariantName(const std::string& name,
+                                                     const std::string& params);
+
    private:
-    AdapterRegistry() = default;
     std::vector<AdapterEntry> adapters_;
 };
 
@@ -11,6 +11,7 @@
 #pragma warning(disable : 4244 5054 5055)
 #endif
 
+#include "agg_conv_curve.h"
 #include "agg_conv_stroke.h"
 #include "agg_conv_transform.h"
 #include "agg_path_storage.h"
@@ -20,6 +21,7 @@
 #include "agg_renderer_scanline.h"
 #include "agg_rendering_buffer.h"
 #include "agg_scanline_p.h"
+#include "agg_scanline_u.h"
 
 #if defined(_MSC_VER)
 #pragma warning(pop)
@@ -29,10 +31,19 @@
 #include <cmath>
 #include <cstring>
 #include <optional>
+#include <vector>
 
 namespace vgcpu::adapters::agg_backend {
 
 namespace {
+
+constexpr const char* kAggName = "Anti-Grain Geometry 2.6";
+
+/// Variant parameter string for a scanline container (empty for the default).
+const char* ScanlineParams(AggScanline scanline) {
+    return scanline == AggScanline::kU8 ? "scanline=u8" : "";
+}
+
 template <typename T>
 T ReadLE(const uint8_t*& ptr) {
     T val;
@@ -40,74 +51,53 @@ T ReadLE(const uint8_t*& ptr) {
     ptr += sizeof(T);
     return val;
 }
-}  // namespace
-
-AggAdapter::AggAdapter() = default;
-AggAdapter::~AggAdapter() = default;
-
-Status AggAdapter::Initialize(const AdapterArgs& args) {
-    (void)args;
-    initialized_ = true;
-    return Status::Ok();
-}
 
-Status AggAdapter::Prepare(const PreparedScene& scene) {
-    (void)scene;
-    if (!initialized_) {
-        return Status::Fail("AggAdapter not initialized");
+/// Reconstruct an IR path as AGG path storage (curves stay curve3/curve4 commands).
+agg::path_storage BuildPath(const Path& ir_path) {
+    agg::path_storage p;
+    size_t pt_idx = 0;
+    for (auto verb : ir_path.verbs) {
+        switch (verb) {
+            case ir::PathVerb::kMoveTo:
+                p.move_to(ir_path.points[pt_idx], ir_path.points[pt_idx + 1]);
+                pt_idx += 2;
+                break;
+            case ir::PathVerb::kLineTo:
+                p.line_to(ir_path.points[pt_idx], ir_path.points[pt_idx + 1]);
+                pt_idx += 2;
+                break;
+            case ir::PathVerb::kQuadTo:
+                // AGG curve3
+                p.curve3(ir_path.points[pt_idx], ir_path.points[pt_idx + 1],
+                         ir_path.points[pt_idx + 2], ir_path.points[pt_idx + 3]);
+                pt_idx += 4;
+                break;
+            case ir::PathVerb::kCubicTo:
+                p.curve4(ir_path.points[pt_idx], ir_path.points[pt_idx + 1],
+                         ir_path.points[pt_idx + 2], ir_path.points[pt_idx + 3],
+                         ir_path.points[pt_idx + 4], ir_path.points[pt_idx + 5]);
+                pt_idx += 6;
+                break;
+            case ir::PathVerb::kClose:
+                p.close_polygon();
+                break;
+        }
     }
-    return Status::Ok();
+    return p;
 }
 
-void AggAdapter::Shutdown() {
-    initialized_ = false;
-}
-
-AdapterInfo AggAdapter::GetInfo() const {
-    return AdapterInfo{.id = "agg",
-                       .detailed_name = "Anti-Grain Geometry 2.6",
-                       .version = "2.6",
-                       .is_cpu_only = true};
-}
-
-CapabilitySet AggAdapter::GetCapabilities() const {
-    return CapabilitySet::All();  // AGG supports most things
-}
-
-Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                          std::vector<uint8_t>& output_buffer) {
-    if (!initialized_)
-        return Status::Fail("Not initialized");
-    if (!scene.IsValid())
-        return Status::InvalidArg("Invalid scene");
-
-    uint32_t width = config.width;
-    uint32_t height = config.height;
-    uint32_t stride = width * 4;
-
-    // Resize buffer
-    if (output_buffer.size() != stride * height) {
-        output_buffer.resize(stride * height);
-    }
-
-    // 1. Setup AGG Rendering Pipeline
-    agg::rendering_buffer rbuf(output_buffer.data(), width, height, stride);
-
-    // Pixel format: AGG's rgba32 order.
-    // Assuming RGBA8888 (R=0, G=1, B=2, A=3).
-    // AGG pixfmt_rgba32 usually expects R-G-B-A byte order in memory.
-    using pixfmt_t = agg::pixfmt_rgba32;
-    pixfmt_t pixf(rbuf);
-
-    using ren_base_t = agg::renderer_base<pixfmt_t>;
-    ren_base_t ren_base(pixf);
+using pixfmt_t = agg::pixfmt_rgba32;
+using ren_base_t = agg::renderer_base<pixfmt_t>;
 
+/// Execute the IR command stream with the given scanline container.
+template <typename Scanline>
+Status RenderCommands(const PreparedScene& scene, ren_base_t& ren_base, Scanline& sl) {
     // Rasterizer
     agg::rasterizer_scanline_aa<> ras;
-    agg::scanline_p8 sl;
 
     // State
     agg::trans_affine ctm;
+    std::vector<agg::trans_affine> ctm_stack;
 
     // Commands
     const uint8_t* ptr = scene.command_stream.data();
@@ -154,7 +144,8 @@ Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& confi
                 std::memcpy(m, ptr, 24);
                 ptr += 24;
                 agg::trans_affine next(m[0], m[1], m[2], m[3], m[4], m[5]);
-                ctm.multiply(next);
+                // Canvas semantics: local points go through `next` first, then the CTM
+                ctm.premultiply(next);
                 break;
             }
 
@@ -172,9 +163,16 @@ Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& confi
                 break;
             }
 
+            // Only the transform is stacked; paint and stroke state are set before each draw
             case ir::Opcode::kSave:
+                ctm_stack.push_back(ctm);
+                break;
+
             case ir::Opcode::kRestore:
-                // TODO: Implement state stack
+                if (!ctm_stack.empty()) {
+                    ctm = ctm_stack.back();
+                    ctm_stack.pop_back();
+                }
                 break;
 
             case ir::Opcode::kFillPath:
@@ -185,36 +183,7 @@ Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& confi
 
                 const auto& ir_path = scene.paths[path_id];
 
-                // Reconstruct path
-                agg::path_storage p;
-                size_t pt_idx = 0;
-                for (auto verb : ir_path.verbs) {
-                    switch (verb) {
-                        case ir::PathVerb::kMoveTo:
-                            p.move_to(ir_path.points[pt_idx], ir_path.points[pt_idx + 1]);
-                            pt_idx += 2;
-                            break;
-                        case ir::PathVerb::kLineTo:
-                            p.line_to(ir_path.points[pt_idx], ir_path.points[pt_idx + 1]);
-                            pt_idx += 2;
-                            break;
-                        case ir::PathVerb::kQuadTo:
-                            // AGG curve3
-                            p.curve3(ir_path.points[pt_idx], ir_path.points[pt_idx + 1],
-                                     ir_path.points[pt_idx + 2], ir_path.points[pt_idx + 3]);
-                            pt_idx += 4;
-                            break;
-                        case ir::PathVerb::kCubicTo:
-                            p.curve4(ir_path.points[pt_idx], ir_path.points[pt_idx + 1],
-                                     ir_path.points[pt_idx + 2], ir_path.points[pt_idx + 3],
-                                     ir_path.points[pt_idx + 4], ir_path.points[pt_idx + 5]);
-                            pt_idx += 6;
-                            break;
-                        case ir::PathVerb::kClose:
-                            p.close_polygon();
-                            break;
-                    }
-                }
+                agg::path_storage p = BuildPath(ir_path);
 
                 // Transform
                 agg::conv_transform<agg::path_storage> trans_path(p, ctm);
@@ -255,9 +224,119 @@ Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& confi
     return Status::Ok();
 }
 
+}  // namespace
+
+AggAdapter::AggAdapter() = default;
+AggAdapter::AggAdapter(AggScanline scanline) : scanline_(scanline) {}
+AggAdapter::~AggAdapter() = default;
+
+Status AggAdapter::Initialize(const AdapterArgs& args) {
+    (void)args;
+    initialized_ = true;
+    return Status::Ok();
+}
+
+Status AggAdapter::Prepare(const PreparedScene& scene) {
+    (void)scene;
+    if (!initialized_) {
+        return Status::Fail("AggAdapter not initialized");
+    }
+    return Status::Ok();
+}
+
+void AggAdapter::Shutdown() {
+    initialized_ = false;
+}
+
+AdapterInfo AggAdapter::GetInfo() const {
+    const std::string params = ScanlineParams(scanline_);
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("agg", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kAggName, params),
+                       .version = "2.6",
+                       .is_cpu_only = true};
+}
+
+CapabilitySet AggAdapter::GetCapabilities() const {
+    CapabilitySet caps = CapabilitySet::All();  // AGG supports most things
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;        // rendering_buffer takes a row stride
+    return caps;
+}
+
+Status AggAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
+                          SurfaceView output_buffer) {
+    if (!initialized_)
+        return Status::Fail("Not initialized");
+    if (!scene.IsValid())
+        return Status::InvalidArg("Invalid scene");
+
+    uint32_t width = config.width;
+    uint32_t height = config.height;
+    uint32_t stride = SurfaceStride(config);
+
+    if (output_buffer.size() < static_cast<size_t>(stride) * height) {
+        return Status::InvalidArg("Output buffer smaller than surface");
+    }
+
+    // 1. Setup AGG Rendering Pipeline
+    agg::rendering_buffer rbuf(output_buffer.data(), width, height, stride);
+
+    // Pixel format: AGG's rgba32 order.
+    // Assuming RGBA8888 (R=0, G=1, B=2, A=3).
+    // AGG pixfmt_rgba32 usually expects R-G-B-A byte order in memory.
+    pixfmt_t pixf(rbuf);
+    ren_base_t ren_base(pixf);
+
+    if (scanline_ == AggScanline::kU8) {
+        agg::scanline_u8 sl;
+        return RenderCommands(scene, ren_base, sl);
+    }
+    agg::scanline_p8 sl;
+    return RenderCommands(scene, ren_base, sl);
+}
+
+Result<Path> AggAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    static constexpr agg::line_cap_e kCaps[] = {agg::butt_cap, agg::round_cap, agg::square_cap};
+    static constexpr agg::line_join_e kJoins[] = {agg::miter_join, agg::round_join,
+                                                  agg::bevel_join};
+
+    agg::path_storage p = BuildPath(path);
+    agg::conv_curve<agg::path_storage> curves(p);
+    agg::conv_stroke<agg::conv_curve<agg::path_storage>> outline(curves);
+    outline.width(stroke.width);
+    outline.line_cap(kCaps[static_cast<size_t>(stroke.cap) % 3]);
+    outline.line_join(kJoins[static_cast<size_t>(stroke.join) % 3]);
+    outline.miter_limit(stroke.miter_limit);
+    // Approximation scales are device pixels per unit, so curves and round joins are subdivided
+    // for the transform the outline will be drawn with
+    curves.approximation_scale(stroke.resolution_scale);
+    outline.approximation_scale(stroke.resolution_scale);
+
+    Path out;
+    double x = 0.0;
+    double y = 0.0;
+    outline.rewind(0);
+    for (unsigned cmd = outline.vertex(&x, &y); !agg::is_stop(cmd); cmd = outline.vertex(&x, &y)) {
+        if (agg::is_vertex(cmd)) {
+            out.verbs.push_back(agg::is_move_to(cmd) ? ir::PathVerb::kMoveTo
+                                                     : ir::PathVerb::kLineTo);
+            out.points.push_back(static_cast<float>(x));
+            out.points.push_back(static_cast<float>(y));
+        } else if (agg::is_end_poly(cmd) && agg::is_closed(cmd)) {
+            out.verbs.push_back(ir::PathVerb::kClose);
+        }
+    }
+    return out;
+}
+
 void RegisterAggAdapter() {
-    AdapterRegistry::Instance().Register("agg", "Anti-Grain Geometry 2.6",
-                                         []() { return std::make_unique<AggAdapter>(); });
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("agg", kAggName, []() { return std::make_unique<AggAdapter>(); });
+    const char* u8_params = ScanlineParams(AggScanline::kU8);
+    registry.RegisterVariant("agg", u8_params,
+                             AdapterRegistry::MakeVariantName(kAggName, u8_params), []() {
+                                 return std::make_unique<AggAdapter>(AggScanline::kU8);
+                             });
 }
 
 }  // namespace vgcpu::adapters::agg_backend
@@ -12,9 +12,14 @@
 
 namespace vgcpu::adapters::agg_backend {
 
+/// AGG scanline container used by the AA renderer. kP8 (packed) is the default "agg" backend;
+/// kU8 (unpacked) is registered as the "agg:scanline=u8" variant.
+enum class AggScanline { kP8, kU8 };
+
 class AggAdapter : public IBackendAdapter {
    public:
     AggAdapter();
+    explicit AggAdapter(AggScanline scanline);
     ~AggAdapter() override;
 
     // Lifecycle
@@ -25,13 +30,19 @@ class AggAdapter : public IBackendAdapter {
     // Metadata
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// agg::pixfmt_rgba32 over premultiplied colors.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kRgba8Premul; }
 
     // Rendering
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
+
+    // Stroker isolation: conv_stroke over conv_curve, read back as closed polylines
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
 
    private:
     bool initialized_ = false;
+    AggScanline scanline_ = AggScanline::kP8;
 };
 
 void RegisterAggAdapter();
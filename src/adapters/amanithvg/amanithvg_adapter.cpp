@@ -23,6 +23,33 @@ namespace vgcpu {
 
 namespace {
 
+constexpr const char* kAmanithVGName = "AmanithVG SRE (Software Rendering Engine)";
+
+/// Variant parameter string for a rendering quality (empty for the default).
+const char* QualityParams(AmanithVGQuality quality) {
+    switch (quality) {
+        case AmanithVGQuality::kFaster:
+            return "quality=faster";
+        case AmanithVGQuality::kNonAntialiased:
+            return "quality=nonaa";
+        case AmanithVGQuality::kBetter:
+        default:
+            return "";
+    }
+}
+
+VGint ToVGRenderingQuality(AmanithVGQuality quality) {
+    switch (quality) {
+        case AmanithVGQuality::kFaster:
+            return VG_RENDERING_QUALITY_FASTER;
+        case AmanithVGQuality::kNonAntialiased:
+            return VG_RENDERING_QUALITY_NONANTIALIASED;
+        case AmanithVGQuality::kBetter:
+        default:
+            return VG_RENDERING_QUALITY_BETTER;
+    }
+}
+
 // Convert IR color (RGBA) to OpenVG color (RGBA as floats)
 void SetPaintColor(VGPaint paint, uint32_t rgba) {
     VGfloat color[4];
@@ -135,6 +162,14 @@ void ApplyGradientPaint(VGPaint paint, const Paint& ir_paint) {
     }
 }
 
+/// Load the current transform as VG_MATRIX_PATH_USER_TO_SURFACE (the default matrix mode).
+/// OpenVG matrices are column-major { sx, shy, w0, shx, sy, w1, tx, ty, w2 }.
+void LoadUserToSurface(const TransformStack& transforms) {
+    const auto& m = transforms.Current();
+    const VGfloat matrix[9] = {m[0], m[1], 0.0f, m[2], m[3], 0.0f, m[4], m[5], 1.0f};
+    vgLoadMatrix(matrix);
+}
+
 }  // namespace
 
 Status AmanithVGAdapter::Initialize(const AdapterArgs& /*args*/) {
@@ -162,18 +197,21 @@ void AmanithVGAdapter::Shutdown() {
 }
 
 AdapterInfo AmanithVGAdapter::GetInfo() const {
-    return AdapterInfo{.id = "amanithvg",
-                       .detailed_name = "AmanithVG SRE (Software Rendering Engine)",
+    const std::string params = QualityParams(quality_);
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("amanithvg", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kAmanithVGName, params),
                        .version = "6.0.0",
                        .is_cpu_only = true};
 }
 
 CapabilitySet AmanithVGAdapter::GetCapabilities() const {
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    return caps;
 }
 
 Status AmanithVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                                std::vector<uint8_t>& output_buffer) {
+                                SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("AmanithVGAdapter not initialized");
     if (!scene.IsValid())
@@ -208,9 +246,10 @@ Status AmanithVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig&
     }
 
     // Set default rendering state
-    vgSeti(VG_RENDERING_QUALITY, VG_RENDERING_QUALITY_BETTER);
+    vgSeti(VG_RENDERING_QUALITY, ToVGRenderingQuality(quality_));
     vgSeti(VG_BLEND_MODE, VG_BLEND_SRC_OVER);
     vgLoadIdentity();
+    transforms_.Reset();
 
     // Create reusable paint handles
     VGPaint fill_paint = vgCreatePaint();
@@ -367,39 +406,24 @@ Status AmanithVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig&
                 break;
             }
 
+            // OpenVG has no state stack: track the path-user-to-surface matrix here
             case ir::Opcode::kSave:
-                // OpenVG doesn't have save/restore for full state
-                // but we can push matrix
+                transforms_.Save();
                 break;
 
             case ir::Opcode::kRestore:
+                transforms_.Restore();
+                LoadUserToSurface(transforms_);
                 break;
 
-            case ir::Opcode::kSetMatrix: {
-                if (cmd + 24 > end)
-                    goto done;
-                // OpenVG uses 3x3 affine matrix (column-major)
-                // IR uses [a b c d e f] = [m00 m01 m10 m11 m02 m12]
-                const float* m = reinterpret_cast<const float*>(cmd);
-                cmd += 24;
-
-                VGfloat matrix[9] = {m[0], m[2], m[4],   // column 0
-                                     m[1], m[3], m[5],   // column 1
-                                     0.0f, 0.0f, 1.0f};  // column 2
-                vgLoadMatrix(matrix);
-                break;
-            }
-
-            case ir::Opcode::kConcatMatrix: {
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix:
                 if (cmd + 24 > end)
                     goto done;
-                const float* m = reinterpret_cast<const float*>(cmd);
+                transforms_.Apply(opcode, cmd);
                 cmd += 24;
-
-                VGfloat matrix[9] = {m[0], m[2], m[4], m[1], m[3], m[5], 0.0f, 0.0f, 1.0f};
-                vgMultMatrix(matrix);
+                LoadUserToSurface(transforms_);
                 break;
-            }
 
             default:
                 break;
@@ -423,8 +447,16 @@ done:
 }
 
 void RegisterAmanithVGAdapter() {
-    AdapterRegistry::Instance().Register("amanithvg", "AmanithVG SRE (Software Rendering Engine)",
-                                         []() { return std::make_unique<AmanithVGAdapter>(); });
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("amanithvg", kAmanithVGName,
+                      []() { return std::make_unique<AmanithVGAdapter>(); });
+
+    for (auto quality : {AmanithVGQuality::kFaster, AmanithVGQuality::kNonAntialiased}) {
+        registry.RegisterVariant(
+            "amanithvg", QualityParams(quality),
+            AdapterRegistry::MakeVariantName(kAmanithVGName, QualityParams(quality)),
+            [quality]() { return std::make_unique<AmanithVGAdapter>(quality); });
+    }
 }
 
 }  // namespace vgcpu
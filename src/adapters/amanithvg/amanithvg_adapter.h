@@ -7,26 +7,36 @@
 #pragma once
 
 #include "adapters/adapter_interface.h"
+#include "adapters/transform_stack.h"
 
 namespace vgcpu {
 
+/// OpenVG rendering quality. kBetter is the default "amanithvg" backend; the others are
+/// registered as "amanithvg:quality=<level>" variants.
+enum class AmanithVGQuality { kBetter, kFaster, kNonAntialiased };
+
 /// AmanithVG SRE (Software Rendering Engine) backend adapter.
 /// Uses OpenVG 1.1 API with Mazatech SRE extensions for CPU-only rendering.
 class AmanithVGAdapter : public IBackendAdapter {
    public:
+    AmanithVGAdapter() = default;
+    explicit AmanithVGAdapter(AmanithVGQuality quality) : quality_(quality) {}
+
     Status Initialize(const AdapterArgs& args) override;
     Status Prepare(const PreparedScene& scene) override;
     void Shutdown() override;
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
+    AmanithVGQuality quality_ = AmanithVGQuality::kBetter;
+    TransformStack transforms_;
 };
 
-/// Register AmanithVG adapter with the adapter registry.
+/// Register AmanithVG adapter (and its rendering quality variants) with the adapter registry.
 void RegisterAmanithVGAdapter();
 
 }  // namespace vgcpu
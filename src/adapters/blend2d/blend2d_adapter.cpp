@@ -10,12 +10,18 @@
 #include "ir/ir_format.h"
 #include "ir/prepared_scene.h"
 
+#include <algorithm>
+#include <cstring>
 #include <vector>
 
 namespace vgcpu {
 
 namespace {
 
+/// Most persistent contexts kept at once. Rotating through more buffers than this rebuilds a
+/// context on every frame.
+constexpr size_t kMaxTargets = 16;
+
 // Helper to create Blend2D gradient from IR paint
 BLGradient CreateGradient(const Paint& paint) {
     BLGradient gradient;
@@ -47,72 +53,128 @@ BLGradient CreateGradient(const Paint& paint) {
     return gradient;
 }
 
-}  // namespace
-
-Status Blend2DAdapter::Initialize(const AdapterArgs& args) {
-    if (args.thread_count > 0) {
-        thread_count_ = args.thread_count;
+/// Appends IR path geometry to `out_path`.
+void AppendIrPath(const Path& path_data, BLPath& out_path) {
+    size_t pt_idx = 0;
+    for (auto verb : path_data.verbs) {
+        switch (verb) {
+            case ir::PathVerb::kMoveTo:
+                if (pt_idx + 1 <= path_data.points.size() / 2) {
+                    out_path.move_to(path_data.points[pt_idx * 2],
+                                     path_data.points[pt_idx * 2 + 1]);
+                    pt_idx++;
+                }
+                break;
+            case ir::PathVerb::kLineTo:
+                if (pt_idx + 1 <= path_data.points.size() / 2) {
+                    out_path.line_to(path_data.points[pt_idx * 2],
+                                     path_data.points[pt_idx * 2 + 1]);
+                    pt_idx++;
+                }
+                break;
+            case ir::PathVerb::kQuadTo:
+                if (pt_idx + 2 <= path_data.points.size() / 2) {
+                    out_path.quad_to(path_data.points[pt_idx * 2],
+                                     path_data.points[pt_idx * 2 + 1],
+                                     path_data.points[(pt_idx + 1) * 2],
+                                     path_data.points[(pt_idx + 1) * 2 + 1]);
+                    pt_idx += 2;
+                }
+                break;
+            case ir::PathVerb::kCubicTo:
+                if (pt_idx + 3 <= path_data.points.size() / 2) {
+                    out_path.cubic_to(path_data.points[pt_idx * 2],
+                                      path_data.points[pt_idx * 2 + 1],
+                                      path_data.points[(pt_idx + 1) * 2],
+                                      path_data.points[(pt_idx + 1) * 2 + 1],
+                                      path_data.points[(pt_idx + 2) * 2],
+                                      path_data.points[(pt_idx + 2) * 2 + 1]);
+                    pt_idx += 3;
+                }
+                break;
+            case ir::PathVerb::kClose:
+                out_path.close();
+                break;
+        }
     }
-    initialized_ = true;
-    return Status::Ok();
 }
 
-Status Blend2DAdapter::Prepare(const PreparedScene& scene) {
-    (void)scene;
-    if (!initialized_) {
-        return Status::Fail("Blend2DAdapter not initialized");
+/// Converts a Blend2D path (e.g. a stroker outline) back to IR geometry.
+Path ToIrPath(const BLPath& bl_path) {
+    Path out;
+    const uint8_t* cmds = bl_path.command_data();
+    const BLPoint* pts = bl_path.vertex_data();
+    const size_t count = bl_path.size();
+    out.verbs.reserve(count);
+    out.points.reserve(count * 2);
+
+    auto push = [&](const BLPoint& p) {
+        out.points.push_back(static_cast<float>(p.x));
+        out.points.push_back(static_cast<float>(p.y));
+    };
+    for (size_t i = 0; i < count;) {
+        switch (cmds[i]) {
+            case BL_PATH_CMD_MOVE:
+                out.verbs.push_back(ir::PathVerb::kMoveTo);
+                push(pts[i++]);
+                break;
+            case BL_PATH_CMD_ON:
+                out.verbs.push_back(ir::PathVerb::kLineTo);
+                push(pts[i++]);
+                break;
+            case BL_PATH_CMD_QUAD:
+                if (i + 2 > count)
+                    return out;
+                out.verbs.push_back(ir::PathVerb::kQuadTo);
+                push(pts[i]);
+                push(pts[i + 1]);
+                i += 2;
+                break;
+            case BL_PATH_CMD_CUBIC:
+                if (i + 3 > count)
+                    return out;
+                out.verbs.push_back(ir::PathVerb::kCubicTo);
+                push(pts[i]);
+                push(pts[i + 1]);
+                push(pts[i + 2]);
+                i += 3;
+                break;
+            case BL_PATH_CMD_CLOSE:
+                out.verbs.push_back(ir::PathVerb::kClose);
+                ++i;
+                break;
+            default:
+                ++i;  // Weights and other non-vertex commands
+                break;
+        }
     }
-    return Status::Ok();
-}
-
-void Blend2DAdapter::Shutdown() {
-    initialized_ = false;
-}
-
-AdapterInfo Blend2DAdapter::GetInfo() const {
-    BLRuntimeBuildInfo buildInfo;
-    BLRuntime::query_build_info(&buildInfo);
-
-    std::string version = std::to_string(buildInfo.major_version) + "." +
-                          std::to_string(buildInfo.minor_version) + "." +
-                          std::to_string(buildInfo.patch_version);
-
-    return AdapterInfo{.id = "blend2d",
-                       .detailed_name = "Blend2D (JIT Software Rasterizer)",
-                       .version = version,
-                       .is_cpu_only = true};
+    return out;
 }
 
-CapabilitySet Blend2DAdapter::GetCapabilities() const {
-    CapabilitySet caps = CapabilitySet::All();
-    caps.supports_parallel_render = true;
-    return caps;
+BLStrokeCap ToBLCap(ir::StrokeCap cap) {
+    switch (cap) {
+        case ir::StrokeCap::kRound:
+            return BL_STROKE_CAP_ROUND;
+        case ir::StrokeCap::kSquare:
+            return BL_STROKE_CAP_SQUARE;
+        default:
+            return BL_STROKE_CAP_BUTT;
+    }
 }
 
-Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                              std::vector<uint8_t>& output_buffer) {
-    if (!initialized_)
-        return Status::Fail("Blend2DAdapter not initialized");
-    if (!scene.IsValid())
-        return Status::InvalidArg("Invalid scene");
-    if (config.width <= 0 || config.height <= 0)
-        return Status::InvalidArg("Invalid surface configuration");
-
-    // Buffer is pre-sized by harness. Contents are undefined until kClear.
-
-    BLImage img;
-    BLResult result =
-        img.create_from_data(config.width, config.height, BL_FORMAT_PRGB32, output_buffer.data(),
-                             static_cast<intptr_t>(config.width * 4));
-
-    if (result != BL_SUCCESS) {
-        return Status::Fail("Failed to create Blend2D image from data");
+BLStrokeJoin ToBLJoin(ir::StrokeJoin join) {
+    switch (join) {
+        case ir::StrokeJoin::kRound:
+            return BL_STROKE_JOIN_ROUND;
+        case ir::StrokeJoin::kBevel:
+            return BL_STROKE_JOIN_BEVEL;
+        default:
+            return BL_STROKE_JOIN_MITER_CLIP;
     }
+}
 
-    BLContextCreateInfo cci{};
-    cci.thread_count = thread_count_;
-    BLContext ctx(img, cci);
-
+/// Replays the IR command stream onto `ctx`.
+void DrawScene(BLContext& ctx, const PreparedScene& scene) {
     const uint8_t* cmd = scene.command_stream.data();
     const uint8_t* end = cmd + scene.command_stream.size();
 
@@ -145,53 +207,10 @@ Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
         }
     };
 
-    // Helper to build path
     auto build_path = [&](uint16_t path_id, BLPath& out_path) {
         if (path_id >= scene.paths.size())
             return;
-        const auto& path_data = scene.paths[path_id];
-        size_t pt_idx = 0;
-        for (auto verb : path_data.verbs) {
-            switch (verb) {
-                case ir::PathVerb::kMoveTo:
-                    if (pt_idx + 1 <= path_data.points.size() / 2) {
-                        out_path.move_to(path_data.points[pt_idx * 2],
-                                         path_data.points[pt_idx * 2 + 1]);
-                        pt_idx++;
-                    }
-                    break;
-                case ir::PathVerb::kLineTo:
-                    if (pt_idx + 1 <= path_data.points.size() / 2) {
-                        out_path.line_to(path_data.points[pt_idx * 2],
-                                         path_data.points[pt_idx * 2 + 1]);
-                        pt_idx++;
-                    }
-                    break;
-                case ir::PathVerb::kQuadTo:
-                    if (pt_idx + 2 <= path_data.points.size() / 2) {
-                        out_path.quad_to(path_data.points[pt_idx * 2],
-                                         path_data.points[pt_idx * 2 + 1],
-                                         path_data.points[(pt_idx + 1) * 2],
-                                         path_data.points[(pt_idx + 1) * 2 + 1]);
-                        pt_idx += 2;
-                    }
-                    break;
-                case ir::PathVerb::kCubicTo:
-                    if (pt_idx + 3 <= path_data.points.size() / 2) {
-                        out_path.cubic_to(path_data.points[pt_idx * 2],
-                                          path_data.points[pt_idx * 2 + 1],
-                                          path_data.points[(pt_idx + 1) * 2],
-                                          path_data.points[(pt_idx + 1) * 2 + 1],
-                                          path_data.points[(pt_idx + 2) * 2],
-                                          path_data.points[(pt_idx + 2) * 2 + 1]);
-                        pt_idx += 3;
-                    }
-                    break;
-                case ir::PathVerb::kClose:
-                    out_path.close();
-                    break;
-            }
-        }
+        AppendIrPath(scene.paths[path_id], out_path);
     };
 
     while (cmd < end) {
@@ -237,35 +256,8 @@ Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
                 uint8_t opts = *cmd++;
 
                 ctx.set_stroke_width(width);
-
-                ir::StrokeCap cap = ir::UnpackStrokeCap(opts);
-                ir::StrokeJoin join = ir::UnpackStrokeJoin(opts);
-
-                // Map Cap
-                switch (cap) {
-                    case ir::StrokeCap::kButt:
-                        ctx.set_stroke_caps(BL_STROKE_CAP_BUTT);
-                        break;
-                    case ir::StrokeCap::kRound:
-                        ctx.set_stroke_caps(BL_STROKE_CAP_ROUND);
-                        break;
-                    case ir::StrokeCap::kSquare:
-                        ctx.set_stroke_caps(BL_STROKE_CAP_SQUARE);
-                        break;
-                }
-
-                // Map Join
-                switch (join) {
-                    case ir::StrokeJoin::kMiter:
-                        ctx.set_stroke_join(BL_STROKE_JOIN_MITER_CLIP);
-                        break;
-                    case ir::StrokeJoin::kRound:
-                        ctx.set_stroke_join(BL_STROKE_JOIN_ROUND);
-                        break;
-                    case ir::StrokeJoin::kBevel:
-                        ctx.set_stroke_join(BL_STROKE_JOIN_BEVEL);
-                        break;
-                }
+                ctx.set_stroke_caps(ToBLCap(ir::UnpackStrokeCap(opts)));
+                ctx.set_stroke_join(ToBLJoin(ir::UnpackStrokeJoin(opts)));
                 break;
             }
 
@@ -310,22 +302,20 @@ Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
                 ctx.restore();
                 break;
 
-            case ir::Opcode::kSetMatrix: {
-                // Skipping actual implementation for brevity, IR doc says f32[6]
-                // Just advance pointer
-                if (cmd + 24 > end)
-                    goto done;
-                // float m[6]; memcpy(m, cmd, 24);
-                // BLMatrix2D mat(m[0], m[1], m[2], m[3], m[4], m[5]);
-                // ctx.set_transform(mat);
-                cmd += 24;
-                break;
-            }
-
+            case ir::Opcode::kSetMatrix:
             case ir::Opcode::kConcatMatrix: {
                 if (cmd + 24 > end)
                     goto done;
+                float m[6];
+                std::memcpy(m, cmd, sizeof(m));
                 cmd += 24;
+                // BLMatrix2D(m00, m01, m10, m11, m20, m21) has the IR's a..f layout. The user
+                // transform is part of the state saved and restored by save()/restore().
+                BLMatrix2D mat(m[0], m[1], m[2], m[3], m[4], m[5]);
+                if (opcode == ir::Opcode::kSetMatrix)
+                    ctx.set_transform(mat);
+                else
+                    ctx.apply_transform(mat);
                 break;
             }
 
@@ -335,10 +325,238 @@ Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
     }
 
 done:
-    ctx.end();
+    return;
+}
+
+/// Keep Blend2D's pipeline generator at or below `level`. The JIT only honors a feature override
+/// on a context with its own (isolated) JIT runtime; a scalar cap disables the JIT so the
+/// portable pipelines run instead.
+void ApplyIsaCap(pal::IsaLevel level, BLContextCreateInfo& cci) {
+    if (level == pal::IsaLevel::kScalar) {
+        cci.flags |= BL_CONTEXT_CREATE_FLAG_DISABLE_JIT;
+        return;
+    }
+
+    uint32_t features = 0;
+    switch (level) {
+        case pal::IsaLevel::kAvx512:
+            features |= BL_RUNTIME_CPU_FEATURE_X86_AVX512;
+            [[fallthrough]];
+        case pal::IsaLevel::kAvx2:
+            features |= BL_RUNTIME_CPU_FEATURE_X86_AVX | BL_RUNTIME_CPU_FEATURE_X86_AVX2;
+            [[fallthrough]];
+        case pal::IsaLevel::kSse42:
+            features |= BL_RUNTIME_CPU_FEATURE_X86_SSE3 | BL_RUNTIME_CPU_FEATURE_X86_SSSE3 |
+                        BL_RUNTIME_CPU_FEATURE_X86_SSE4_1 | BL_RUNTIME_CPU_FEATURE_X86_SSE4_2;
+            [[fallthrough]];
+        case pal::IsaLevel::kSse2:
+            features |= BL_RUNTIME_CPU_FEATURE_X86_SSE2;
+            break;
+        default:
+            return;  // NEON is the only ARM level above scalar, so it never caps anything
+    }
+    cci.flags |= BL_CONTEXT_CREATE_FLAG_ISOLATED_JIT_RUNTIME |
+                 BL_CONTEXT_CREATE_FLAG_OVERRIDE_CPU_FEATURES;
+    cci.cpu_features = features;
+}
+
+}  // namespace
+
+Status Blend2DAdapter::Initialize(const AdapterArgs& args) {
+    if (args.thread_count > 0) {
+        thread_count_ = args.thread_count;
+    }
+    max_isa_.reset();
+    if (args.max_isa && *args.max_isa < pal::HighestIsaLevel()) {
+        max_isa_ = args.max_isa;
+    }
+    EndTargets();
+    initialized_ = true;
+    return Status::Ok();
+}
+
+Status Blend2DAdapter::Prepare(const PreparedScene& scene) {
+    (void)scene;
+    if (!initialized_) {
+        return Status::Fail("Blend2DAdapter not initialized");
+    }
     return Status::Ok();
 }
 
+void Blend2DAdapter::Shutdown() {
+    for (uint32_t slot = 0; slot < frames_.size(); ++slot) {
+        (void)WaitFrame(slot);
+    }
+    EndTargets();
+    initialized_ = false;
+}
+
+AdapterInfo Blend2DAdapter::GetInfo() const {
+    BLRuntimeBuildInfo buildInfo;
+    BLRuntime::query_build_info(&buildInfo);
+
+    std::string version = std::to_string(buildInfo.major_version) + "." +
+                          std::to_string(buildInfo.minor_version) + "." +
+                          std::to_string(buildInfo.patch_version);
+
+    return AdapterInfo{.id = "blend2d",
+                       .detailed_name = "Blend2D (JIT Software Rasterizer)",
+                       .version = version,
+                       .is_cpu_only = true};
+}
+
+CapabilitySet Blend2DAdapter::GetCapabilities() const {
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_parallel_render = true;
+    // Rendering contexts with worker threads (thread_count >= 1) record commands and rasterize
+    // asynchronously until flushed
+    caps.supports_async_submit = true;
+    caps.supports_isa_cap = true;
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;
+    return caps;
+}
+
+Status Blend2DAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
+                              SurfaceView output_buffer) {
+    if (!initialized_)
+        return Status::Fail("Blend2DAdapter not initialized");
+    if (!scene.IsValid())
+        return Status::InvalidArg("Invalid scene");
+    if (config.width <= 0 || config.height <= 0)
+        return Status::InvalidArg("Invalid surface configuration");
+
+    // Buffer is pre-sized by harness. Contents are undefined until kClear.
+    auto target = AcquireTarget(config, output_buffer);
+    if (target.failed())
+        return target.status();
+    Draw(*target.value(), scene);
+    return Finish(*target.value());
+}
+
+Status Blend2DAdapter::SubmitFrame(const PreparedScene& scene, const SurfaceConfig& config,
+                                   SurfaceView output_buffer, uint32_t slot) {
+    if (!initialized_)
+        return Status::Fail("Blend2DAdapter not initialized");
+    if (!scene.IsValid())
+        return Status::InvalidArg("Invalid scene");
+    if (config.width <= 0 || config.height <= 0)
+        return Status::InvalidArg("Invalid surface configuration");
+
+    if (slot >= frames_.size())
+        frames_.resize(slot + 1, nullptr);
+    if (frames_[slot])
+        (void)WaitFrame(slot);  // Caller did not wait; never let two frames share a slot
+
+    auto target = AcquireTarget(config, output_buffer);
+    if (target.failed())
+        return target.status();
+
+    // With worker threads the context only records commands; rasterization proceeds when
+    // WaitFrame flushes it. Same per-frame work as Render, split at the flush.
+    Draw(*target.value(), scene);
+    frames_[slot] = target.value();
+    return Status::Ok();
+}
+
+Status Blend2DAdapter::WaitFrame(uint32_t slot) {
+    if (slot >= frames_.size() || !frames_[slot])
+        return Status::Ok();
+    Target* target = frames_[slot];
+    frames_[slot] = nullptr;
+    return target->in_flight ? Finish(*target) : Status::Ok();
+}
+
+Result<Blend2DAdapter::Target*> Blend2DAdapter::AcquireTarget(const SurfaceConfig& config,
+                                                              SurfaceView output_buffer) {
+    const int stride = static_cast<int>(SurfaceStride(config));
+    for (auto& target : targets_) {
+        if (target->data == output_buffer.data() && target->width == config.width &&
+            target->height == config.height && target->stride == stride) {
+            if (target->in_flight) {
+                (void)Finish(*target);  // Resubmitted from another slot before its wait
+            }
+            return target.get();
+        }
+    }
+
+    if (targets_.size() >= kMaxTargets) {
+        Target* oldest = targets_.front().get();
+        oldest->ctx.end();
+        std::replace(frames_.begin(), frames_.end(), oldest, static_cast<Target*>(nullptr));
+        targets_.erase(targets_.begin());
+    }
+
+    auto target = std::make_unique<Target>();
+    BLResult result =
+        target->image.create_from_data(config.width, config.height, BL_FORMAT_PRGB32,
+                                       output_buffer.data(), static_cast<intptr_t>(stride));
+    if (result != BL_SUCCESS) {
+        return Status::Fail("Failed to create Blend2D image from data");
+    }
+
+    BLContextCreateInfo cci{};
+    cci.thread_count = thread_count_;
+    if (max_isa_) {
+        ApplyIsaCap(*max_isa_, cci);
+    }
+    if (target->ctx.begin(target->image, cci) != BL_SUCCESS) {
+        return Status::Fail("Failed to begin Blend2D context");
+    }
+    target->ctx.save(target->cookie);
+    target->data = output_buffer.data();
+    target->width = config.width;
+    target->height = config.height;
+    target->stride = stride;
+    targets_.push_back(std::move(target));
+    return targets_.back().get();
+}
+
+void Blend2DAdapter::Draw(Target& target, const PreparedScene& scene) {
+    // Back to the state right after begin()
+    target.ctx.restore(target.cookie);
+    target.ctx.save(target.cookie);
+    DrawScene(target.ctx, scene);
+    target.in_flight = true;
+}
+
+Status Blend2DAdapter::Finish(Target& target) {
+    target.in_flight = false;
+    if (target.ctx.flush(BL_CONTEXT_FLUSH_SYNC) != BL_SUCCESS) {
+        return Status::Fail("Blend2D frame failed to complete");
+    }
+    return Status::Ok();
+}
+
+void Blend2DAdapter::EndTargets() {
+    for (auto& target : targets_) {
+        target->ctx.end();
+    }
+    targets_.clear();
+    frames_.clear();
+}
+
+Result<Path> Blend2DAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    BLPath input;
+    AppendIrPath(path, input);
+
+    // Same options DrawScene gives the context, with the flattening tolerance moved to user space
+    BLStrokeOptions options;
+    options.width = stroke.width;
+    options.miter_limit = stroke.miter_limit;
+    options.set_caps(ToBLCap(stroke.cap));
+    options.join = ToBLJoin(stroke.join);
+    BLApproximationOptions approx = bl_default_approximation_options;
+    if (stroke.resolution_scale > 0.0f)
+        approx.flatten_tolerance /= stroke.resolution_scale;
+
+    BLPath outline;
+    if (outline.add_stroked_path(input, options, approx) != BL_SUCCESS) {
+        return Status::Fail("Blend2D failed to stroke path");
+    }
+    return ToIrPath(outline);
+}
+
 void RegisterBlend2DAdapter() {
     AdapterRegistry::Instance().Register("blend2d", "Blend2D (JIT Software Rasterizer)",
                                          []() { return std::make_unique<Blend2DAdapter>(); });
@@ -10,9 +10,20 @@
 
 #include <blend2d/blend2d.h>
 
+#include <memory>
+#include <optional>
+#include <vector>
+
 namespace vgcpu {
 
 /// Blend2D backend adapter implementation.
+/// Every frame, synchronous or pipelined, draws on a persistent context bound to its output
+/// buffer, reset to its initial state and flushed synchronously (in WaitFrame when pipelined).
+/// Contexts are kept per buffer, so cold-buffer rotation and pipeline slots reuse theirs instead
+/// of rebuilding one per frame. With AdapterArgs::max_isa below the CPU's level the contexts are
+/// created with a CPU feature override (which needs an isolated JIT runtime, so a fresh context
+/// per frame would recompile every pipeline); the uncapped level takes the same path, so an ISA
+/// sweep varies only the dispatch.
 class Blend2DAdapter : public IBackendAdapter {
    public:
     Blend2DAdapter() = default;
@@ -26,14 +37,48 @@ class Blend2DAdapter : public IBackendAdapter {
     // Metadata
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// BL_FORMAT_PRGB32 is a native-endian 0xAARRGGBB word.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
 
     // Rendering
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
+
+    // Pipelined submission: drawn on the buffer's persistent context, flushed in WaitFrame
+    Status SubmitFrame(const PreparedScene& scene, const SurfaceConfig& config,
+                       SurfaceView output_buffer, uint32_t slot) override;
+    Status WaitFrame(uint32_t slot) override;
+
+    // Stroker isolation: BLPath::add_stroked_path with the context's stroke options
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
 
    private:
+    /// Persistent context bound to one output buffer.
+    struct Target {
+        const uint8_t* data = nullptr;  ///< Key: pixels, size and stride of the buffer
+        int width = 0;
+        int height = 0;
+        int stride = 0;
+        BLImage image;
+        BLContext ctx;
+        BLContextCookie cookie;   ///< State right after begin()
+        bool in_flight = false;  ///< Drawn but not yet flushed
+    };
+
+    /// Context for `output_buffer`, created on first use (evicting the oldest beyond a small cap).
+    Result<Target*> AcquireTarget(const SurfaceConfig& config, SurfaceView output_buffer);
+    /// Reset `target` to its initial state and record the scene.
+    static void Draw(Target& target, const PreparedScene& scene);
+    /// Rasterize what Draw recorded and wait for the workers.
+    static Status Finish(Target& target);
+    /// End every context (their thread count and CPU features may no longer apply).
+    void EndTargets();
+
     bool initialized_ = false;
     uint32_t thread_count_ = 1;
+    std::optional<pal::IsaLevel> max_isa_;  ///< Set only when the cap is below the CPU's level
+    std::vector<std::unique_ptr<Target>> targets_;  ///< Oldest first
+    std::vector<Target*> frames_;  ///< Target submitted in each pipeline slot; null = idle
 };
 
 /// Register the Blend2D adapter with the global registry.
@@ -12,8 +12,45 @@
 
 #include <cairo.h>
 
+#include <cstring>
+
 namespace vgcpu {
 
+namespace {
+
+constexpr const char* kCairoName = "Cairo (Image Surface, CPU Rasterizer)";
+
+/// Variant parameter string for an antialiasing mode (empty for the default).
+const char* AntialiasParams(CairoAntialias aa) {
+    switch (aa) {
+        case CairoAntialias::kGood:
+            return "aa=good";
+        case CairoAntialias::kFast:
+            return "aa=fast";
+        case CairoAntialias::kNone:
+            return "aa=none";
+        case CairoAntialias::kBest:
+        default:
+            return "";
+    }
+}
+
+cairo_antialias_t ToCairoAntialias(CairoAntialias aa) {
+    switch (aa) {
+        case CairoAntialias::kGood:
+            return CAIRO_ANTIALIAS_GOOD;
+        case CairoAntialias::kFast:
+            return CAIRO_ANTIALIAS_FAST;
+        case CairoAntialias::kNone:
+            return CAIRO_ANTIALIAS_NONE;
+        case CairoAntialias::kBest:
+        default:
+            return CAIRO_ANTIALIAS_BEST;
+    }
+}
+
+}  // namespace
+
 Status CairoAdapter::Initialize(const AdapterArgs& args) {
     (void)args;
     initialized_ = true;
@@ -33,19 +70,23 @@ void CairoAdapter::Shutdown() {
 }
 
 AdapterInfo CairoAdapter::GetInfo() const {
-    return AdapterInfo{.id = "cairo",
-                       .detailed_name = "Cairo (Image Surface, CPU Rasterizer)",
+    const std::string params = AntialiasParams(antialias_);
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("cairo", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kCairoName, params),
                        .version = CAIRO_VERSION_STRING,
                        .is_cpu_only = true};
 }
 
 CapabilitySet CairoAdapter::GetCapabilities() const {
     // Cairo supports all basic features
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // Image surfaces wrap caller memory with any stride
+    return caps;
 }
 
 Status CairoAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                            std::vector<uint8_t>& output_buffer) {
+                            SurfaceView output_buffer) {
     if (!initialized_) {
         return Status::Fail("CairoAdapter not initialized");
     }
@@ -59,8 +100,11 @@ Status CairoAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
     }
 
     // Buffer is pre-sized by harness. Contents are undefined until kClear.
-    // Cairo uses ARGB32 format with specific stride alignment
-    int stride = cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, config.width);
+    // Cairo uses ARGB32 format; any stride meeting its alignment (a multiple of 4) works
+    const int stride = SurfaceStride(config);
+    if (stride < cairo_format_stride_for_width(CAIRO_FORMAT_ARGB32, config.width)) {
+        return Status::InvalidArg("Invalid surface stride");
+    }
 
     // Create Cairo surface wrapping our buffer
     cairo_surface_t* surface = cairo_image_surface_create_for_data(
@@ -77,8 +121,7 @@ Status CairoAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
         return Status::Fail("Failed to create Cairo context");
     }
 
-    // Set default antialias
-    cairo_set_antialias(cr, CAIRO_ANTIALIAS_BEST);
+    cairo_set_antialias(cr, ToCairoAntialias(antialias_));
 
     // Process command stream
     const uint8_t* cmd = scene.command_stream.data();
@@ -222,6 +265,24 @@ Status CairoAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
                 cairo_restore(cr);
                 break;
 
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix: {
+                if (cmd + 24 > end)
+                    goto done;
+                float m[6];
+                std::memcpy(m, cmd, sizeof(m));
+                cmd += 24;
+                // cairo_matrix_t (xx, yx, xy, yy, x0, y0) has the IR's a..f layout; the CTM is
+                // part of the state saved by cairo_save()
+                cairo_matrix_t matrix;
+                cairo_matrix_init(&matrix, m[0], m[1], m[2], m[3], m[4], m[5]);
+                if (opcode == ir::Opcode::kSetMatrix)
+                    cairo_set_matrix(cr, &matrix);
+                else
+                    cairo_transform(cr, &matrix);
+                break;
+            }
+
             default:
                 // Skip unknown opcodes
                 break;
@@ -238,8 +299,14 @@ done:
 
 // Explicit registration function
 void RegisterCairoAdapter() {
-    AdapterRegistry::Instance().Register("cairo", "Cairo (Image Surface, CPU Rasterizer)",
-                                         []() { return std::make_unique<CairoAdapter>(); });
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("cairo", kCairoName, []() { return std::make_unique<CairoAdapter>(); });
+
+    for (auto aa : {CairoAntialias::kGood, CairoAntialias::kFast, CairoAntialias::kNone}) {
+        registry.RegisterVariant("cairo", AntialiasParams(aa),
+                                 AdapterRegistry::MakeVariantName(kCairoName, AntialiasParams(aa)),
+                                 [aa]() { return std::make_unique<CairoAdapter>(aa); });
+    }
 }
 
 }  // namespace vgcpu
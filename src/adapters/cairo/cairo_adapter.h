@@ -10,11 +10,16 @@
 
 namespace vgcpu {
 
+/// Cairo antialiasing operating point. kBest is the default "cairo" backend; the others are
+/// registered as "cairo:aa=<mode>" variants.
+enum class CairoAntialias { kBest, kGood, kFast, kNone };
+
 /// Cairo backend adapter for CPU-only 2D vector rendering.
 /// Uses Cairo Image Surface for pure CPU software rasterization.
 class CairoAdapter : public IBackendAdapter {
    public:
     CairoAdapter() = default;
+    explicit CairoAdapter(CairoAntialias antialias) : antialias_(antialias) {}
     ~CairoAdapter() override = default;
 
     // Lifecycle
@@ -25,16 +30,19 @@ class CairoAdapter : public IBackendAdapter {
     // Metadata
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// CAIRO_FORMAT_ARGB32 is a native-endian 0xAARRGGBB word.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
 
     // Rendering
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
+    CairoAntialias antialias_ = CairoAntialias::kBest;
 };
 
-/// Register the Cairo adapter with the global registry.
+/// Register the Cairo adapter (and its antialiasing variants) with the global registry.
 void RegisterCairoAdapter();
 
 }  // namespace vgcpu
@@ -0,0 +1,225 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] Decode baseline
+// backend (Chapter 4)
+
+#include "adapters/decode/decode_adapter.h"
+
+#include "adapters/adapter_registry.h"
+#include "ir/ir_format.h"
+#include "ir/path_flattener.h"
+#include "ir/prepared_scene.h"
+
+#include <cstring>
+
+namespace vgcpu {
+
+namespace {
+
+template <typename T>
+T ReadLE(const uint8_t*& ptr) {
+    T val;
+    std::memcpy(&val, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return val;
+}
+
+}  // namespace
+
+Status DecodeAdapter::Initialize(const AdapterArgs& args) {
+    (void)args;  // Decoding is single-threaded by design
+    initialized_ = true;
+    return Status::Ok();
+}
+
+Status DecodeAdapter::Prepare(const PreparedScene& scene) {
+    if (!initialized_) {
+        return Status::Fail("DecodeAdapter not initialized");
+    }
+    // One untimed pass sizes the sink so Render does not allocate ([REQ-113]).
+    return Decode(scene);
+}
+
+void DecodeAdapter::Shutdown() {
+    sink_points_ = {};
+    sink_contours_ = {};
+    flat_ = {};
+    transforms_.Reset();
+    initialized_ = false;
+}
+
+AdapterInfo DecodeAdapter::GetInfo() const {
+    return AdapterInfo{.id = "decode",
+                       .detailed_name = "Decode-only Baseline (IR walk + flattening)",
+                       .version = "1.0.0",
+                       .is_cpu_only = true};
+}
+
+CapabilitySet DecodeAdapter::GetCapabilities() const {
+    // Every command is decoded; nothing is rasterized, so nothing is unsupported.
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;
+    return caps;
+}
+
+Status DecodeAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
+                             SurfaceView output_buffer) {
+    (void)output_buffer;  // Decode baseline never touches pixels
+    if (!initialized_) {
+        return Status::Fail("DecodeAdapter not initialized");
+    }
+
+    if (!scene.IsValid()) {
+        return Status::InvalidArg("Invalid scene");
+    }
+
+    if (config.width <= 0 || config.height <= 0) {
+        return Status::InvalidArg("Invalid surface configuration");
+    }
+
+    return Decode(scene);
+}
+
+Status DecodeAdapter::Decode(const PreparedScene& scene) {
+    sink_points_.clear();
+    sink_contours_.clear();
+    transforms_.Reset();
+    draw_count_ = 0;
+    paint_checksum_ = 0;
+
+    uint16_t fill_paint_id = 0;
+    uint16_t stroke_paint_id = 0;
+
+    const uint8_t* ptr = scene.command_stream.data();
+    const uint8_t* end = ptr + scene.command_stream.size();
+
+    while (ptr < end) {
+        auto op = static_cast<ir::Opcode>(*ptr++);
+        switch (op) {
+            case ir::Opcode::kEnd:
+                return Status::Ok();
+
+            case ir::Opcode::kSave:
+                transforms_.Save();
+                break;
+
+            case ir::Opcode::kRestore:
+                transforms_.Restore();
+                break;
+
+            case ir::Opcode::kClear:
+                if (end - ptr < 4)
+                    return Status::InvalidArg("Truncated Clear command");
+                paint_checksum_ ^= ReadLE<uint32_t>(ptr);
+                break;
+
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix:
+                if (end - ptr < 24)
+                    return Status::InvalidArg("Truncated matrix command");
+                transforms_.Apply(op, ptr);
+                ptr += 24;
+                break;
+
+            case ir::Opcode::kSetFill:
+                if (end - ptr < 3)
+                    return Status::InvalidArg("Truncated SetFill command");
+                fill_paint_id = ReadLE<uint16_t>(ptr);
+                ptr += 1;  // fill rule
+                break;
+
+            case ir::Opcode::kSetStroke:
+                if (end - ptr < 7)
+                    return Status::InvalidArg("Truncated SetStroke command");
+                stroke_paint_id = ReadLE<uint16_t>(ptr);
+                ptr += 4 + 1;  // width, options
+                break;
+
+            case ir::Opcode::kFillPath:
+            case ir::Opcode::kStrokePath: {
+                if (end - ptr < 2)
+                    return Status::InvalidArg("Truncated draw command");
+                uint16_t path_id = ReadLE<uint16_t>(ptr);
+                uint16_t paint_id = (op == ir::Opcode::kFillPath) ? fill_paint_id : stroke_paint_id;
+                if (path_id >= scene.paths.size())
+                    break;
+                if (paint_id < scene.paints.size()) {
+                    paint_checksum_ ^= scene.paints[paint_id].color;
+                }
+                // Strokes are flattened along their centerline; stroke expansion is backend work.
+                FlattenPath(scene.paths[path_id], transforms_.Current());
+                ++draw_count_;
+                break;
+            }
+
+            default:
+                return Status::InvalidArg("Unknown opcode in command stream");
+        }
+    }
+
+    return Status::Ok();
+}
+
+void DecodeAdapter::FlattenPath(const Path& path, const TransformStack::Matrix& m) {
+    // Flatten in user space with the tolerance shrunk by the CTM's largest stretch, so the
+    // transformed polyline stays within kDefaultFlattenTolerance device pixels
+    const float scale = ir::MaxScale({m[0], m[1], m[2], m[3]});
+    flat_.verbs.clear();
+    flat_.points.clear();
+    ir::FlattenPathInto(path, ir::kDefaultFlattenTolerance / (scale > 0.0f ? scale : 1.0f), flat_);
+
+    const auto& pts = flat_.points;
+    size_t idx = 0;
+    float start_x = 0.0f, start_y = 0.0f;  // First point of the current contour
+    bool reopen = false;                    // Closed, and no kMoveTo has followed yet
+
+    auto emit = [&](float x, float y) {
+        sink_points_.push_back(m[0] * x + m[2] * y + m[4]);
+        sink_points_.push_back(m[1] * x + m[3] * y + m[5]);
+    };
+    auto close_contour = [&]() {
+        if (sink_contours_.empty() || sink_contours_.back() != sink_points_.size() / 2) {
+            sink_contours_.push_back(static_cast<uint32_t>(sink_points_.size() / 2));
+        }
+    };
+
+    // Only move/line/close remain, each move/line with exactly one point
+    for (auto verb : flat_.verbs) {
+        switch (verb) {
+            case ir::PathVerb::kMoveTo:
+                close_contour();
+                start_x = pts[idx];
+                start_y = pts[idx + 1];
+                emit(start_x, start_y);
+                reopen = false;
+                idx += 2;
+                break;
+            case ir::PathVerb::kLineTo:
+                // A segment after kClose starts a new contour at the closed contour's start point
+                if (reopen) {
+                    emit(start_x, start_y);
+                    reopen = false;
+                }
+                emit(pts[idx], pts[idx + 1]);
+                idx += 2;
+                break;
+            case ir::PathVerb::kClose:
+                close_contour();
+                reopen = true;
+                break;
+            default:
+                break;
+        }
+    }
+    close_contour();
+}
+
+// Explicit registration function (called from main)
+void RegisterDecodeAdapter() {
+    AdapterRegistry::Instance().Register("decode", "Decode-only Baseline (IR walk + flattening)",
+                                         []() { return std::make_unique<DecodeAdapter>(); });
+}
+
+}  // namespace vgcpu
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] Decode baseline
+// backend (Chapter 4)
+
+#pragma once
+
+#include "adapters/adapter_interface.h"
+#include "adapters/transform_stack.h"
+#include "ir/prepared_scene.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace vgcpu {
+
+/// Decode-only baseline adapter.
+/// Walks the full command stream, tracks transform and paint state, and flattens every filled or
+/// stroked path into a device-space polyline sink without rasterizing anything. Its timings
+/// capture harness plus IR interpretation cost, which the harness can subtract from the other
+/// backends (see Harness::ApplyBaseline).
+class DecodeAdapter : public IBackendAdapter {
+   public:
+    DecodeAdapter() = default;
+    ~DecodeAdapter() override = default;
+
+    // Lifecycle
+    Status Initialize(const AdapterArgs& args) override;
+    Status Prepare(const PreparedScene& scene) override;
+    void Shutdown() override;
+
+    // Metadata
+    [[nodiscard]] AdapterInfo GetInfo() const override;
+    [[nodiscard]] CapabilitySet GetCapabilities() const override;
+
+    // Rendering
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override;
+
+    /// Number of flattened points emitted by the last Render/Prepare call.
+    [[nodiscard]] size_t GetFlattenedPointCount() const { return sink_points_.size() / 2; }
+
+    /// Number of path draw commands (fills + strokes) decoded by the last Render/Prepare call.
+    [[nodiscard]] size_t GetDrawCount() const { return draw_count_; }
+
+   private:
+    Status Decode(const PreparedScene& scene);
+    void FlattenPath(const Path& path, const TransformStack::Matrix& m);
+
+    bool initialized_ = false;
+    std::vector<float> sink_points_;       ///< Flattened x,y pairs in device space
+    std::vector<uint32_t> sink_contours_;  ///< Point count at the end of each contour
+    Path flat_;                            ///< Scratch for ir::FlattenPathInto, reused per draw
+    TransformStack transforms_;
+    size_t draw_count_ = 0;
+    uint32_t paint_checksum_ = 0;  ///< Keeps paint lookups observable
+};
+
+/// Register the decode baseline adapter with the global registry.
+void RegisterDecodeAdapter();
+
+}  // namespace vgcpu
@@ -38,11 +38,14 @@ AdapterInfo NullAdapter::GetInfo() const {
 
 CapabilitySet NullAdapter::GetCapabilities() const {
     // Null backend claims to support everything
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;
+    return caps;
 }
 
 Status NullAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                           std::vector<uint8_t>& output_buffer) {
+                           SurfaceView output_buffer) {
     (void)output_buffer;  // Null adapter does not write to buffer
     if (!initialized_) {
         return Status::Fail("NullAdapter not initialized");
@@ -29,7 +29,7 @@ class NullAdapter : public IBackendAdapter {
 
     // Rendering
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-06] Adapter Registry (Chapter 3) / [API-06-05] Registry:
+// creation/enumeration (Chapter 4)
+
+#pragma once
+
+#include "adapters/adapter_interface.h"
+#include "vgcpu/internal/export.h"
+
+#include <cstdint>
+
+namespace vgcpu {
+
+/// Version of the plugin entry point contract. Bump whenever PluginApi, PluginBackend, the
+/// IBackendAdapter vtable or the structs it passes (AdapterArgs, CapabilitySet) change; the host
+/// refuses plugins built against another version.
+inline constexpr uint32_t kPluginAbiVersion = 7;
+
+/// Exported symbol every backend plugin provides (see VGCPU_PLUGIN_EXPORT).
+inline constexpr const char* kPluginEntryPoint = "vgcpu_plugin_api";
+
+/// File name prefix of backend plugins: "vgcpu_backend_<id>" plus the platform suffix.
+inline constexpr const char* kPluginFilePrefix = "vgcpu_backend_";
+
+/// One adapter exported by a plugin (a backend or one of its variants).
+struct PluginBackend {
+    const char* id;       ///< Adapter id, e.g. "cairo" or "cairo:aa=fast"
+    const char* name;     ///< Display name
+    const char* base_id;  ///< Base backend id for variants; "" for the backend itself
+};
+
+/// Table returned by the plugin entry point. Plain C layout so it can be validated before any
+/// C++ object crosses the module boundary.
+struct PluginApi {
+    uint32_t abi_version;       ///< kPluginAbiVersion the plugin was built with
+    const char* vgcpu_version;  ///< VGCPU_VERSION_STRING the plugin was built with
+    uint32_t backend_count;
+    const PluginBackend* backends;
+    /// Create an adapter by id; nullptr if unknown. The caller owns the result and destroys it
+    /// through its virtual destructor, which runs inside the plugin.
+    IBackendAdapter* (*create)(const char* id);
+};
+
+/// Signature of kPluginEntryPoint.
+using PluginEntryFn = const PluginApi* (*)();
+
+}  // namespace vgcpu
@@ -0,0 +1,49 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-06] Adapter Registry (Chapter 3) / [API-06-05] Registry:
+// creation/enumeration (Chapter 4)
+//
+// Entry point compiled into every backend plugin. The build names the backend through
+// VGCPU_PLUGIN_HEADER (its adapter header) and VGCPU_PLUGIN_REGISTER (its Register function),
+// which registers the backend and its variants into the plugin's private registry.
+
+#include "adapters/adapter_registry.h"
+#include "adapters/plugin_abi.h"
+#include "vgcpu/internal/version.h"
+
+#include <vector>
+
+#if !defined(VGCPU_PLUGIN_HEADER) || !defined(VGCPU_PLUGIN_REGISTER)
+#error "Backend plugins must define VGCPU_PLUGIN_HEADER and VGCPU_PLUGIN_REGISTER"
+#endif
+
+#include VGCPU_PLUGIN_HEADER
+
+namespace {
+
+using namespace vgcpu;
+
+IBackendAdapter* CreateAdapter(const char* id) {
+    return AdapterRegistry::Instance().CreateAdapter(id).release();
+}
+
+const PluginApi& GetApi() {
+    static std::vector<PluginBackend> backends;
+    static const PluginApi api = [] {
+        VGCPU_PLUGIN_REGISTER();
+        // Registry entries live for the lifetime of the module, so their strings stay valid.
+        for (const auto& entry : AdapterRegistry::Instance().GetAdapters()) {
+            backends.push_back({entry.id.c_str(), entry.name.c_str(), entry.base_id.c_str()});
+        }
+        return PluginApi{kPluginAbiVersion, VGCPU_VERSION_STRING,
+                         static_cast<uint32_t>(backends.size()), backends.data(), &CreateAdapter};
+    }();
+    return api;
+}
+
+}  // namespace
+
+VGCPU_PLUGIN_EXPORT const vgcpu::PluginApi* vgcpu_plugin_api() {
+    return &GetApi();
+}
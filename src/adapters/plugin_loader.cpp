@@ -0,0 +1,104 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-06] Adapter Registry (Chapter 3) / [API-06-05] Registry:
+// creation/enumeration (Chapter 4)
+
+#include "adapters/plugin_loader.h"
+
+#include "adapters/adapter_registry.h"
+#include "adapters/plugin_abi.h"
+#include "pal/dynamic_library.h"
+#include "vgcpu/internal/version.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace vgcpu {
+
+namespace {
+
+/// Loaded plugins. Never unloaded: adapter vtables and factories point into them, and several
+/// backend libraries do not support being unmapped.
+std::vector<pal::DynamicLibrary>& LoadedPlugins() {
+    static auto* plugins = new std::vector<pal::DynamicLibrary>();
+    return *plugins;
+}
+
+}  // namespace
+
+std::string PluginFileName(const std::string& id) {
+    return std::string(kPluginFilePrefix) + id + pal::DynamicLibrary::Suffix();
+}
+
+std::vector<std::string> DiscoverPlugins(const std::filesystem::path& dir) {
+    std::vector<std::string> ids;
+    std::error_code ec;
+    if (!std::filesystem::is_directory(dir, ec)) {
+        return ids;
+    }
+
+    const std::string prefix = kPluginFilePrefix;
+    const std::string suffix = pal::DynamicLibrary::Suffix();
+    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+        const std::string file = entry.path().filename().string();
+        if (file.size() > prefix.size() + suffix.size() && file.starts_with(prefix) &&
+            file.ends_with(suffix)) {
+            ids.push_back(file.substr(prefix.size(), file.size() - prefix.size() - suffix.size()));
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+Status LoadBackendPlugin(const std::filesystem::path& dir, const std::string& id) {
+    auto& registry = AdapterRegistry::Instance();
+    if (registry.HasAdapter(id)) {
+        return Status::Ok();
+    }
+
+    const auto path = dir / PluginFileName(id);
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        return Status::NotFound("No plugin for backend '" + id + "' in " + dir.string());
+    }
+
+    auto library = pal::DynamicLibrary::Open(path.string());
+    if (library.failed()) {
+        return library.status();
+    }
+
+    auto entry = reinterpret_cast<PluginEntryFn>(library.value().GetSymbol(kPluginEntryPoint));
+    if (!entry) {
+        return Status::Fail(path.string() + " does not export " + kPluginEntryPoint);
+    }
+    const PluginApi* api = entry();
+    if (!api || api->abi_version != kPluginAbiVersion ||
+        std::strcmp(api->vgcpu_version, VGCPU_VERSION_STRING) != 0) {
+        return Status::Fail(path.string() + " was built for a different plugin ABI or version");
+    }
+
+    for (uint32_t i = 0; i < api->backend_count; ++i) {
+        const PluginBackend& backend = api->backends[i];
+        const std::string backend_id = backend.id;
+        if (registry.HasAdapter(backend_id)) {
+            continue;
+        }
+        AdapterFactory factory = [create = api->create, backend_id]() {
+            return std::unique_ptr<IBackendAdapter>(create(backend_id.c_str()));
+        };
+        const std::string base_id = backend.base_id;
+        if (base_id.empty()) {
+            registry.Register(backend_id, backend.name, std::move(factory));
+        } else {
+            registry.RegisterVariant(base_id, backend_id.substr(base_id.size() + 1),
+                                     backend.name, std::move(factory));
+        }
+    }
+
+    LoadedPlugins().push_back(std::move(library.value()));
+    return Status::Ok();
+}
+
+}  // namespace vgcpu
@@ -0,0 +1,30 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-06] Adapter Registry (Chapter 3) / [API-06-05] Registry:
+// creation/enumeration (Chapter 4)
+
+#pragma once
+
+#include "common/status.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace vgcpu {
+
+/// File name of the plugin providing backend `id` ("vgcpu_backend_cairo.so" on Linux).
+[[nodiscard]] std::string PluginFileName(const std::string& id);
+
+/// Backend ids that have a plugin file in `dir`, sorted. Nothing is loaded.
+[[nodiscard]] std::vector<std::string> DiscoverPlugins(const std::filesystem::path& dir);
+
+/// Load the plugin of backend `id` from `dir` and register its adapters (the backend and its
+/// variants) with the global registry. Loading is lazy and idempotent: a plugin is mapped into
+/// the process only when a run needs it, stays loaded until exit, and ids that are already
+/// registered (built in, or loaded before) are skipped.
+/// @return NotFound if `dir` has no plugin for `id`; Fail on an ABI mismatch.
+Status LoadBackendPlugin(const std::filesystem::path& dir, const std::string& id);
+
+}  // namespace vgcpu
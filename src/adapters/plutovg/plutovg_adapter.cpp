@@ -12,6 +12,8 @@
 
 #include <plutovg.h>
 
+#include <cstring>
+
 namespace vgcpu {
 
 Status PlutoVGAdapter::Initialize(const AdapterArgs& args) {
@@ -41,11 +43,14 @@ AdapterInfo PlutoVGAdapter::GetInfo() const {
 
 CapabilitySet PlutoVGAdapter::GetCapabilities() const {
     // PlutoVG supports all basic features
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // Surfaces wrap caller memory with any stride
+    return caps;
 }
 
 Status PlutoVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                              std::vector<uint8_t>& output_buffer) {
+                              SurfaceView output_buffer) {
     if (!initialized_) {
         return Status::Fail("PlutoVGAdapter not initialized");
     }
@@ -63,8 +68,7 @@ Status PlutoVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
     // Create PlutoVG surface wrapping our buffer
     plutovg_surface_t* surface =
         plutovg_surface_create_for_data(output_buffer.data(), config.width, config.height,
-                                        config.width * 4  // stride
-        );
+                                        SurfaceStride(config));
 
     if (!surface) {
         return Status::Fail("Failed to create PlutoVG surface");
@@ -211,6 +215,24 @@ Status PlutoVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& c
                 plutovg_canvas_restore(canvas);
                 break;
 
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix: {
+                if (cmd + 24 > end)
+                    goto done;
+                float m[6];
+                std::memcpy(m, cmd, sizeof(m));
+                cmd += 24;
+                // plutovg_matrix_t has the IR's a..f layout; the matrix is part of the state
+                // saved by plutovg_canvas_save()
+                plutovg_matrix_t matrix;
+                plutovg_matrix_init(&matrix, m[0], m[1], m[2], m[3], m[4], m[5]);
+                if (opcode == ir::Opcode::kSetMatrix)
+                    plutovg_canvas_set_matrix(canvas, &matrix);
+                else
+                    plutovg_canvas_transform(canvas, &matrix);
+                break;
+            }
+
             default:
                 // Skip unknown opcodes
                 break;
@@ -25,10 +25,12 @@ class PlutoVGAdapter : public IBackendAdapter {
     // Metadata
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// PlutoVG surfaces are premultiplied native-endian 0xAARRGGBB words.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
 
     // Rendering
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
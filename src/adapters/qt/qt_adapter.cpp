@@ -11,6 +11,7 @@
 #include <QLinearGradient>
 #include <QPainter>
 #include <QPainterPath>
+#include <QPainterPathStroker>
 #include <QRadialGradient>
 #include <iostream>
 
@@ -18,6 +19,9 @@ namespace vgcpu {
 
 namespace {
 
+constexpr const char* kQtName = "Qt Raster Engine";
+constexpr const char* kQtNoAAParams = "aa=off";
+
 // Create a QPainterPath from IR path data
 QPainterPath CreateQPath(const Path& path_data) {
     QPainterPath path;
@@ -61,6 +65,46 @@ QPainterPath CreateQPath(const Path& path_data) {
     return path;
 }
 
+// Convert a QPainterPath (e.g. a stroker outline) back to IR geometry. Every subpath is closed:
+// the outline is only ever filled, which closes it anyway.
+Path ToIrPath(const QPainterPath& qpath) {
+    Path out;
+    auto push = [&](const QPainterPath::Element& e) {
+        out.points.push_back(static_cast<float>(e.x));
+        out.points.push_back(static_cast<float>(e.y));
+    };
+    const int count = qpath.elementCount();
+    for (int i = 0; i < count; ++i) {
+        const QPainterPath::Element& e = qpath.elementAt(i);
+        switch (e.type) {
+            case QPainterPath::MoveToElement:
+                if (!out.verbs.empty())
+                    out.verbs.push_back(ir::PathVerb::kClose);
+                out.verbs.push_back(ir::PathVerb::kMoveTo);
+                push(e);
+                break;
+            case QPainterPath::LineToElement:
+                out.verbs.push_back(ir::PathVerb::kLineTo);
+                push(e);
+                break;
+            case QPainterPath::CurveToElement:
+                if (i + 2 < count) {
+                    out.verbs.push_back(ir::PathVerb::kCubicTo);
+                    push(e);
+                    push(qpath.elementAt(i + 1));
+                    push(qpath.elementAt(i + 2));
+                }
+                i += 2;  // Skip the two CurveToDataElement entries
+                break;
+            case QPainterPath::CurveToDataElement:
+                break;
+        }
+    }
+    if (!out.verbs.empty())
+        out.verbs.push_back(ir::PathVerb::kClose);
+    return out;
+}
+
 // Convert IR color to QColor
 QColor ToQColor(uint32_t rgba) {
     return QColor::fromRgba(
@@ -126,26 +170,32 @@ void QtAdapter::Shutdown() {
 }
 
 AdapterInfo QtAdapter::GetInfo() const {
-    return AdapterInfo{
-        .id = "qt", .detailed_name = "Qt Raster Engine", .version = "6.8.0", .is_cpu_only = true};
+    const std::string params = antialiasing_ ? "" : kQtNoAAParams;
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("qt", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kQtName, params),
+                       .version = "6.8.0",
+                       .is_cpu_only = true};
 }
 
 CapabilitySet QtAdapter::GetCapabilities() const {
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // QImage wraps the buffer with bytesPerLine
+    return caps;
 }
 
 Status QtAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                         std::vector<uint8_t>& output_buffer) {
+                         SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("QtAdapter not initialized");
 
     // Wrap the output buffer in a QImage
     // We use Format_ARGB32_Premultiplied which is the native fast format for Qt's raster engine
-    QImage image(output_buffer.data(), config.width, config.height, config.width * 4,
+    QImage image(output_buffer.data(), config.width, config.height, SurfaceStride(config),
                  QImage::Format_ARGB32_Premultiplied);
 
     QPainter painter(&image);
-    painter.setRenderHint(QPainter::Antialiasing, true);
+    painter.setRenderHint(QPainter::Antialiasing, antialiasing_);
 
     // Command Loop
     const uint8_t* cmd = scene.command_stream.data();
@@ -256,17 +306,16 @@ Status QtAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config
                 painter.restore();
                 break;
 
-            case ir::Opcode::kSetMatrix: {
-                const float* m = reinterpret_cast<const float*>(cmd);
-                cmd += 24;
-                painter.setTransform(QTransform(m[0], m[1], m[2], m[3], m[4], m[5]));
-                break;
-            }
-
+            case ir::Opcode::kSetMatrix:
             case ir::Opcode::kConcatMatrix: {
+                if (cmd + 24 > end)
+                    goto done;
                 const float* m = reinterpret_cast<const float*>(cmd);
                 cmd += 24;
-                painter.setTransform(QTransform(m[0], m[1], m[2], m[3], m[4], m[5]), true);
+                // QTransform(m11, m12, m21, m22, dx, dy) has the IR's a..f layout; combining
+                // applies the new transform before the current one (canvas concat)
+                painter.setTransform(QTransform(m[0], m[1], m[2], m[3], m[4], m[5]),
+                                     opcode == ir::Opcode::kConcatMatrix);
                 break;
             }
         }
@@ -276,9 +325,27 @@ done:
     return Status::Ok();
 }
 
+Result<Path> QtAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    static constexpr Qt::PenCapStyle kCaps[] = {Qt::FlatCap, Qt::RoundCap, Qt::SquareCap};
+    static constexpr Qt::PenJoinStyle kJoins[] = {Qt::MiterJoin, Qt::RoundJoin, Qt::BevelJoin};
+
+    QPainterPathStroker stroker;
+    stroker.setWidth(stroke.width);
+    stroker.setCapStyle(kCaps[static_cast<size_t>(stroke.cap) % 3]);
+    stroker.setJoinStyle(kJoins[static_cast<size_t>(stroke.join) % 3]);
+    // Qt measures the miter limit from the join point in pen widths: half the SVG ratio
+    stroker.setMiterLimit(stroke.miter_limit / 2.0f);
+    if (stroke.resolution_scale > 0.0f)
+        stroker.setCurveThreshold(stroker.curveThreshold() / stroke.resolution_scale);
+    return ToIrPath(stroker.createStroke(CreateQPath(path)));
+}
+
 void RegisterQtAdapter() {
-    AdapterRegistry::Instance().Register("qt", "Qt Raster Engine",
-                                         []() { return std::make_unique<QtAdapter>(); });
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("qt", kQtName, []() { return std::make_unique<QtAdapter>(); });
+    registry.RegisterVariant("qt", kQtNoAAParams,
+                             AdapterRegistry::MakeVariantName(kQtName, kQtNoAAParams),
+                             []() { return std::make_unique<QtAdapter>(false); });
 }
 
 }  // namespace vgcpu
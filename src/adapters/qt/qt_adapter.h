@@ -11,16 +11,25 @@ namespace vgcpu {
 
 class QtAdapter : public IBackendAdapter {
    public:
+    QtAdapter() = default;
+    /// @param antialiasing QPainter::Antialiasing hint; false registers as "qt:aa=off".
+    explicit QtAdapter(bool antialiasing) : antialiasing_(antialiasing) {}
+
     Status Initialize(const AdapterArgs& args) override;
     Status Prepare(const PreparedScene& scene) override;
     void Shutdown() override;
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// QImage::Format_ARGB32_Premultiplied is a native-endian 0xAARRGGBB word.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
+    // Stroker isolation: QPainterPathStroker with the Render pen's style
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
 
    private:
     bool initialized_ = false;
+    bool antialiasing_ = true;
 };
 
 void RegisterQtAdapter();
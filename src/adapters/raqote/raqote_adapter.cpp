@@ -27,6 +27,7 @@ RqtSurface* rqt_create(int32_t width, int32_t height);
 void rqt_destroy(RqtSurface* ptr);
 void rqt_clear(RqtSurface* ptr, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 void rqt_get_pixels(RqtSurface* ptr, uint32_t* out_buf);
+void rqt_set_transform(RqtSurface* ptr, float a, float b, float c, float d, float e, float f);
 
 // Path construction
 RqtPath* rqt_path_create();
@@ -122,11 +123,13 @@ AdapterInfo RaqoteAdapter::GetInfo() const {
 }
 
 CapabilitySet RaqoteAdapter::GetCapabilities() const {
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    return caps;
 }
 
 Status RaqoteAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                             std::vector<uint8_t>& output_buffer) {
+                             SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("RaqoteAdapter not initialized");
     if (!scene.IsValid())
@@ -147,6 +150,12 @@ Status RaqoteAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
     ir::StrokeCap current_stroke_cap = ir::StrokeCap::kButt;
     ir::StrokeJoin current_stroke_join = ir::StrokeJoin::kMiter;
 
+    transforms_.Reset();
+    auto sync_transform = [&] {
+        const auto& m = transforms_.Current();
+        rqt_set_transform(surf, m[0], m[1], m[2], m[3], m[4], m[5]);
+    };
+
     const uint8_t* cmd = scene.command_stream.data();
     const uint8_t* end = cmd + scene.command_stream.size();
 
@@ -263,15 +272,23 @@ Status RaqoteAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
                 break;
             }
 
+            // Raqote has no state stack: track the transform here and push it on change
             case ir::Opcode::kSave:
+                transforms_.Save();
+                break;
+
             case ir::Opcode::kRestore:
-                // Raqote doesn't have state stack - skip
+                transforms_.Restore();
+                sync_transform();
                 break;
 
             case ir::Opcode::kSetMatrix:
             case ir::Opcode::kConcatMatrix:
-                // TODO: Implement transform support
+                if (cmd + 24 > end)
+                    goto done;
+                transforms_.Apply(opcode, cmd);
                 cmd += 24;
+                sync_transform();
                 break;
 
             default:
@@ -280,7 +297,7 @@ Status RaqoteAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
     }
 
 done:
-    // Copy pixels to output buffer (Raqote uses ARGB order)
+    // Copy pixels to output buffer (premultiplied 0xAARRGGBB words, i.e. BGRA bytes)
     rqt_get_pixels(surf, reinterpret_cast<uint32_t*>(output_buffer.data()));
     rqt_destroy(surf);
 
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "adapters/adapter_registry.h"
+#include "adapters/transform_stack.h"
 
 #include <memory>
 
@@ -16,11 +17,14 @@ class RaqoteAdapter : public IBackendAdapter {
     void Shutdown() override;
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// Raqote draw targets are premultiplied native-endian 0xAARRGGBB words.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
+    TransformStack transforms_;
 };
 
 void RegisterRaqoteAdapter();
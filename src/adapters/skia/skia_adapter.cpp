@@ -11,18 +11,24 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkPathUtils.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkSurface.h"
 #include "include/effects/SkGradientShader.h"
 
+#include <cstring>
 #include <vector>
 
 namespace vgcpu {
 
 namespace {
 
+constexpr const char* kSkiaName = "Skia (CPU Raster)";
+constexpr const char* kSkiaNoAAParams = "aa=off";
+
 SkColor ConvertColor(uint32_t c) {
     // IR color is RGBA8 (A is high byte: 0xAABBGGRR in Little Endian u32? No wait.)
     // IR Format says: "RGBA8 premultiplied (default: opaque black)"
@@ -83,8 +89,64 @@ SkPath CreatePath(const Path& irGraph) {
     return path;
 }
 
-void ApplyPaint(SkPaint& skPaint, const Paint& irPaint) {
-    skPaint.setAntiAlias(true);
+/// Conics in stroker output (round caps and joins) are split into 2^kConicQuadPow2 quads.
+constexpr int kConicQuadPow2 = 2;
+
+/// Converts an SkPath (e.g. a stroker outline) back to IR geometry.
+Path ToIrPath(const SkPath& path) {
+    Path out;
+    auto push = [&](const SkPoint& p) {
+        out.points.push_back(p.fX);
+        out.points.push_back(p.fY);
+    };
+
+    SkPath::RawIter iter(path);
+    SkPoint pts[4];
+    SkPoint quads[1 + 2 * (1 << kConicQuadPow2)];
+    for (SkPath::Verb verb = iter.next(pts); verb != SkPath::kDone_Verb; verb = iter.next(pts)) {
+        switch (verb) {
+            case SkPath::kMove_Verb:
+                out.verbs.push_back(ir::PathVerb::kMoveTo);
+                push(pts[0]);
+                break;
+            case SkPath::kLine_Verb:
+                out.verbs.push_back(ir::PathVerb::kLineTo);
+                push(pts[1]);
+                break;
+            case SkPath::kQuad_Verb:
+                out.verbs.push_back(ir::PathVerb::kQuadTo);
+                push(pts[1]);
+                push(pts[2]);
+                break;
+            case SkPath::kConic_Verb: {
+                const int count = SkPath::ConvertConicToQuads(pts[0], pts[1], pts[2],
+                                                              iter.conicWeight(), quads,
+                                                              kConicQuadPow2);
+                for (int i = 0; i < count; ++i) {
+                    out.verbs.push_back(ir::PathVerb::kQuadTo);
+                    push(quads[1 + 2 * i]);
+                    push(quads[2 + 2 * i]);
+                }
+                break;
+            }
+            case SkPath::kCubic_Verb:
+                out.verbs.push_back(ir::PathVerb::kCubicTo);
+                push(pts[1]);
+                push(pts[2]);
+                push(pts[3]);
+                break;
+            case SkPath::kClose_Verb:
+                out.verbs.push_back(ir::PathVerb::kClose);
+                break;
+            default:
+                break;
+        }
+    }
+    return out;
+}
+
+void ApplyPaint(SkPaint& skPaint, const Paint& irPaint, bool antialias) {
+    skPaint.setAntiAlias(antialias);
 
     if (irPaint.type == ir::PaintType::kSolid) {
         skPaint.setColor(ConvertColor(irPaint.color));
@@ -146,18 +208,22 @@ void SkiaAdapter::Shutdown() {
 }
 
 AdapterInfo SkiaAdapter::GetInfo() const {
-    return AdapterInfo{.id = "skia",
-                       .detailed_name = "Skia (CPU Raster)",
+    const std::string params = antialias_ ? "" : kSkiaNoAAParams;
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("skia", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kSkiaName, params),
                        .version = "m124 (Aseprite build)",
                        .is_cpu_only = true};
 }
 
 CapabilitySet SkiaAdapter::GetCapabilities() const {
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // WrapPixels takes the row bytes
+    return caps;
 }
 
 Status SkiaAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                           std::vector<uint8_t>& output_buffer) {
+                           SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("SkiaAdapter not initialized");
     if (!scene.IsValid())
@@ -169,7 +235,8 @@ Status SkiaAdapter::Render(const PreparedScene& scene, const SurfaceConfig& conf
     SkImageInfo info =
         SkImageInfo::Make(config.width, config.height, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
 
-    sk_sp<SkSurface> surface = SkSurfaces::WrapPixels(info, output_buffer.data(), config.width * 4);
+    sk_sp<SkSurface> surface =
+        SkSurfaces::WrapPixels(info, output_buffer.data(), SurfaceStride(config));
 
     if (!surface) {
         return Status::Fail("Failed to create SkSurface");
@@ -267,7 +334,7 @@ Status SkiaAdapter::Render(const PreparedScene& scene, const SurfaceConfig& conf
 
                 SkPaint paint;
                 paint.setStyle(SkPaint::kFill_Style);
-                ApplyPaint(paint, scene.paints[current_paint_id]);
+                ApplyPaint(paint, scene.paints[current_paint_id], antialias_);
 
                 SkPath path = CreatePath(scene.paths[path_id]);
                 path.setFillType(current_fill_rule == ir::FillRule::kEvenOdd
@@ -294,7 +361,7 @@ Status SkiaAdapter::Render(const PreparedScene& scene, const SurfaceConfig& conf
                 paint.setStrokeWidth(current_stroke.width);
                 paint.setStrokeCap(current_stroke.cap);
                 paint.setStrokeJoin(current_stroke.join);
-                ApplyPaint(paint, scene.paints[current_stroke.paint_id]);
+                ApplyPaint(paint, scene.paints[current_stroke.paint_id], antialias_);
 
                 SkPath path = CreatePath(scene.paths[path_id]);
                 canvas->drawPath(path, paint);
@@ -310,13 +377,21 @@ Status SkiaAdapter::Render(const PreparedScene& scene, const SurfaceConfig& conf
                 break;
 
             case ir::Opcode::kSetMatrix:
-                // TODO: Implement matrix
-                cmd += 24;
-                break;
-
-            case ir::Opcode::kConcatMatrix:
+            case ir::Opcode::kConcatMatrix: {
+                if (cmd + 24 > end)
+                    goto done;
+                float m[6];
+                std::memcpy(m, cmd, sizeof(m));
                 cmd += 24;
+                // IR a..f is column-major (x' = a*x + c*y + e); SkMatrix is row-major. The
+                // canvas matrix is saved and restored with save()/restore().
+                SkMatrix matrix = SkMatrix::MakeAll(m[0], m[2], m[4], m[1], m[3], m[5], 0, 0, 1);
+                if (opcode == ir::Opcode::kSetMatrix)
+                    canvas->setMatrix(matrix);
+                else
+                    canvas->concat(matrix);
                 break;
+            }
 
             default:
                 break;
@@ -327,9 +402,35 @@ done:
     return Status::Ok();
 }
 
+Result<Path> SkiaAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    static constexpr SkPaint::Cap kCaps[] = {SkPaint::kButt_Cap, SkPaint::kRound_Cap,
+                                             SkPaint::kSquare_Cap};
+    static constexpr SkPaint::Join kJoins[] = {SkPaint::kMiter_Join, SkPaint::kRound_Join,
+                                               SkPaint::kBevel_Join};
+
+    SkPaint paint;
+    paint.setStyle(SkPaint::kStroke_Style);
+    paint.setStrokeWidth(stroke.width);
+    paint.setStrokeMiter(stroke.miter_limit);
+    paint.setStrokeCap(kCaps[static_cast<size_t>(stroke.cap) % 3]);
+    paint.setStrokeJoin(kJoins[static_cast<size_t>(stroke.join) % 3]);
+
+    // resScale tells the stroker how finely to approximate curves for the device transform.
+    // A false return means hairline, which Skia rasterizes directly without an outline.
+    SkPath outline;
+    if (!skpathutils::FillPathWithPaint(CreatePath(path), paint, &outline, nullptr,
+                                        stroke.resolution_scale)) {
+        return Status::Unsupported("Skia draws hairline strokes without an outline");
+    }
+    return ToIrPath(outline);
+}
+
 void RegisterSkiaAdapter() {
-    AdapterRegistry::Instance().Register("skia", "Skia (CPU Raster)",
-                                         []() { return std::make_unique<SkiaAdapter>(); });
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("skia", kSkiaName, []() { return std::make_unique<SkiaAdapter>(); });
+    registry.RegisterVariant("skia", kSkiaNoAAParams,
+                             AdapterRegistry::MakeVariantName(kSkiaName, kSkiaNoAAParams),
+                             []() { return std::make_unique<SkiaAdapter>(false); });
 }
 
 }  // namespace vgcpu
@@ -10,6 +10,8 @@ namespace vgcpu {
 class SkiaAdapter : public IBackendAdapter {
    public:
     SkiaAdapter() = default;
+    /// @param antialias SkPaint antialiasing; false registers as "skia:aa=off".
+    explicit SkiaAdapter(bool antialias) : antialias_(antialias) {}
     ~SkiaAdapter() override = default;
 
     Status Initialize(const AdapterArgs& args) override;
@@ -17,12 +19,18 @@ class SkiaAdapter : public IBackendAdapter {
     void Shutdown() override;
     AdapterInfo GetInfo() const override;
     CapabilitySet GetCapabilities() const override;
+    /// kRGBA_8888_SkColorType with kPremul_SkAlphaType.
+    PixelFormat GetNativeFormat() const override { return PixelFormat::kRgba8Premul; }
 
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
+
+    // Stroker isolation: skpathutils::FillPathWithPaint with the Render stroke paint
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
 
    private:
     bool initialized_ = false;
+    bool antialias_ = true;
 };
 
 void RegisterSkiaAdapter();
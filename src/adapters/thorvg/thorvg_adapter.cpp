@@ -113,6 +113,16 @@ void ApplyGradientFill(tvg::Shape* shape, const Paint& paint) {
     }
 }
 
+// Apply the current transform to a shape (and its fill, which lives in shape space)
+void ApplyTransform(tvg::Shape* shape, const TransformStack& transforms) {
+    if (transforms.IsIdentity()) {
+        return;
+    }
+    const auto& m = transforms.Current();
+    // tvg::Matrix is row-major: {e11, e12, e13, e21, e22, e23, e31, e32, e33}
+    shape->transform({m[0], m[2], m[4], m[1], m[3], m[5], 0.0f, 0.0f, 1.0f});
+}
+
 }  // namespace
 
 Status ThorVGAdapter::Initialize(const AdapterArgs& /*args*/) {
@@ -147,11 +157,14 @@ AdapterInfo ThorVGAdapter::GetInfo() const {
 }
 
 CapabilitySet ThorVGAdapter::GetCapabilities() const {
-    return CapabilitySet::All();
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // SwCanvas::target takes a stride in pixels
+    return caps;
 }
 
 Status ThorVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                             std::vector<uint8_t>& output_buffer) {
+                             SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("ThorVGAdapter not initialized");
     if (!scene.IsValid())
@@ -165,15 +178,17 @@ Status ThorVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
         return Status::Fail("Failed to create ThorVG SwCanvas");
     }
 
-    // Target the output buffer (ARGB8888 format)
-    auto result =
-        canvas->target(reinterpret_cast<uint32_t*>(output_buffer.data()),
-                       static_cast<uint32_t>(config.width), static_cast<uint32_t>(config.width),
-                       static_cast<uint32_t>(config.height), tvg::SwCanvas::ARGB8888);
+    // Target the output buffer (ARGB8888 format, stride in pixels)
+    auto result = canvas->target(reinterpret_cast<uint32_t*>(output_buffer.data()),
+                                 static_cast<uint32_t>(SurfaceStride(config) / 4),
+                                 static_cast<uint32_t>(config.width),
+                                 static_cast<uint32_t>(config.height), tvg::SwCanvas::ARGB8888);
     if (result != tvg::Result::Success) {
         return Status::Fail("Failed to set ThorVG canvas target");
     }
 
+    transforms_.Reset();
+
     // Command loop
     const uint8_t* cmd = scene.command_stream.data();
     const uint8_t* end = cmd + scene.command_stream.size();
@@ -279,6 +294,7 @@ Status ThorVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
                 shape->fill(current_fill_rule == ir::FillRule::kEvenOdd ? tvg::FillRule::EvenOdd
                                                                         : tvg::FillRule::Winding);
 
+                ApplyTransform(shape.get(), transforms_);
                 canvas->push(std::move(shape));
                 break;
             }
@@ -309,23 +325,25 @@ Status ThorVGAdapter::Render(const PreparedScene& scene, const SurfaceConfig& co
                 uint8_t a = (paint.color >> 24) & 0xFF;
                 shape->stroke(r, g, b, a);
 
+                ApplyTransform(shape.get(), transforms_);
                 canvas->push(std::move(shape));
                 break;
             }
 
+            // ThorVG has no canvas state stack: track the transform here
             case ir::Opcode::kSave:
-                // ThorVG doesn't have save/restore, skip
+                transforms_.Save();
                 break;
 
             case ir::Opcode::kRestore:
+                transforms_.Restore();
                 break;
 
             case ir::Opcode::kSetMatrix:
-                // TODO: Implement matrix transforms
-                cmd += 24;
-                break;
-
             case ir::Opcode::kConcatMatrix:
+                if (cmd + 24 > end)
+                    goto done;
+                transforms_.Apply(opcode, cmd);
                 cmd += 24;
                 break;
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "adapters/adapter_interface.h"
+#include "adapters/transform_stack.h"
 
 namespace vgcpu {
 
@@ -19,11 +20,14 @@ class ThorVGAdapter : public IBackendAdapter {
     void Shutdown() override;
     [[nodiscard]] AdapterInfo GetInfo() const override;
     [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    /// SwCanvas::ARGB8888 is a native-endian 0xAARRGGBB word.
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kBgra8Premul; }
     Status Render(const PreparedScene& scene, const SurfaceConfig& config,
-                  std::vector<uint8_t>& output_buffer) override;
+                  SurfaceView output_buffer) override;
 
    private:
     bool initialized_ = false;
+    TransformStack transforms_;  ///< ThorVG has no canvas state; shapes get the CTM on push
 };
 
 /// Register ThorVG adapter with the adapter registry.
@@ -0,0 +1,316 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [REQ-35] Concurrency (Chapter
+// 4)
+
+#include "adapters/tiled/tiled_adapter.h"
+
+#include "ir/ir_format.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace vgcpu {
+
+namespace {
+
+void AppendSetMatrix(std::vector<uint8_t>& stream, const float (&m)[6]) {
+    stream.push_back(static_cast<uint8_t>(ir::Opcode::kSetMatrix));
+    const auto* bytes = reinterpret_cast<const uint8_t*>(m);
+    stream.insert(stream.end(), bytes, bytes + sizeof(m));
+}
+
+}  // namespace
+
+TiledAdapter::TiledAdapter(std::string inner_id, AdapterFactory inner_factory)
+    : inner_id_(std::move(inner_id)), inner_factory_(std::move(inner_factory)) {
+    // Metadata and capabilities come from an uninitialized probe instance.
+    if (auto probe = inner_factory_ ? inner_factory_() : nullptr) {
+        inner_info_ = probe->GetInfo();
+        inner_caps_ = probe->GetCapabilities();
+        inner_format_ = probe->GetNativeFormat();
+    }
+}
+
+TiledAdapter::~TiledAdapter() {
+    StopWorkers();
+}
+
+Status TiledAdapter::Initialize(const AdapterArgs& args) {
+    if (!inner_factory_) {
+        return Status::Fail("TiledAdapter has no inner backend factory");
+    }
+    if (!inner_caps_.supports_transforms) {
+        return Status::Unsupported("Inner backend '" + inner_id_ +
+                                   "' cannot apply the band translate (no transform support)");
+    }
+
+    // Re-initializing replaces the previous bands and their workers.
+    ReleaseBands();
+
+    size_t count = args.thread_count > 0 ? static_cast<size_t>(args.thread_count)
+                                         : std::max(1u, std::thread::hardware_concurrency());
+
+    // Every band renders serially on its own instance ([REQ-55] per-instance isolation).
+    AdapterArgs inner_args = args;
+    inner_args.thread_count = 1;
+    bands_.resize(count);
+    for (auto& band : bands_) {
+        band.adapter = inner_factory_();
+        auto status = band.adapter ? band.adapter->Initialize(inner_args)
+                                   : Status::Fail("Failed to create inner backend '" +
+                                                  inner_id_ + "'");
+        if (status.failed()) {
+            band.adapter.reset();  // Never initialized, so not shut down
+            ReleaseBands();
+            return status;
+        }
+    }
+
+    stop_ = false;
+    for (size_t i = 1; i < bands_.size(); ++i) {
+        workers_.emplace_back(&TiledAdapter::WorkerLoop, this, i, generation_);
+    }
+    initialized_ = true;
+    return Status::Ok();
+}
+
+Status TiledAdapter::Prepare(const PreparedScene& scene) {
+    if (!initialized_) {
+        return Status::Fail("TiledAdapter not initialized");
+    }
+
+    width_ = static_cast<int>(scene.width);
+    height_ = static_cast<int>(scene.height);
+    const int count = static_cast<int>(bands_.size());
+    const int band_height = (height_ + count - 1) / count;
+
+    for (int i = 0; i < count; ++i) {
+        Band& band = bands_[static_cast<size_t>(i)];
+        band.y0 = std::min(i * band_height, height_);
+        band.height = std::min(band_height, height_ - band.y0);
+        if (band.height <= 0) {
+            continue;  // More threads than rows
+        }
+
+        auto band_scene = MakeBandScene(scene, band.y0, band.height);
+        if (band_scene.failed()) {
+            return band_scene.status();
+        }
+        band.scene = std::move(band_scene.value());
+
+        auto status = band.adapter->Prepare(band.scene);
+        if (status.failed()) {
+            return status;
+        }
+    }
+    return Status::Ok();
+}
+
+void TiledAdapter::Shutdown() {
+    ReleaseBands();
+}
+
+void TiledAdapter::ReleaseBands() {
+    StopWorkers();
+    for (auto& band : bands_) {
+        if (band.adapter) {
+            band.adapter->Shutdown();
+        }
+    }
+    bands_.clear();
+    initialized_ = false;
+}
+
+AdapterInfo TiledAdapter::GetInfo() const {
+    return AdapterInfo{
+        .id = AdapterRegistry::MakeVariantId(inner_id_, kTiledParams),
+        .detailed_name = AdapterRegistry::MakeVariantName(inner_info_.detailed_name, kTiledParams),
+        .version = inner_info_.version,
+        .is_cpu_only = inner_info_.is_cpu_only};
+}
+
+CapabilitySet TiledAdapter::GetCapabilities() const {
+    CapabilitySet caps = inner_caps_;
+    caps.supports_parallel_render = true;
+    return caps;
+}
+
+Status TiledAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
+                            SurfaceView output_buffer) {
+    (void)scene;  // Bands render their translated copies made in Prepare
+    if (!initialized_) {
+        return Status::Fail("TiledAdapter not initialized");
+    }
+
+    if (config.width != width_ || config.height != height_) {
+        return Status::InvalidArg("Surface configuration does not match the prepared scene");
+    }
+
+    const int stride = SurfaceStride(config);
+    if (stride < width_ * 4) {
+        return Status::InvalidArg("Invalid surface stride");
+    }
+    if (output_buffer.size() < static_cast<size_t>(stride) * height_) {
+        return Status::InvalidArg("Output buffer smaller than surface");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        target_ = output_buffer;
+        target_stride_ = stride;
+        pending_ = workers_.size();
+        ++generation_;
+    }
+    start_cv_.notify_all();
+
+    RenderBand(bands_[0]);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return pending_ == 0; });
+        target_ = {};
+    }
+
+    for (const auto& band : bands_) {
+        if (band.status.failed()) {
+            return band.status;
+        }
+    }
+    return Status::Ok();
+}
+
+Result<Path> TiledAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    if (!initialized_ || bands_.empty()) {
+        return Status::Fail("TiledAdapter not initialized");
+    }
+    return bands_.front().adapter->StrokeToPath(path, stroke);
+}
+
+void TiledAdapter::RenderBand(Band& band) {
+    if (band.height <= 0) {
+        band.status = Status::Ok();
+        return;
+    }
+    // The band's rows of the shared surface, at the shared stride: no copy afterwards
+    SurfaceConfig band_config;
+    band_config.width = width_;
+    band_config.height = band.height;
+    band_config.format = inner_format_;
+    band_config.stride = target_stride_;
+    const size_t offset = static_cast<size_t>(band.y0) * target_stride_;
+    const size_t length = static_cast<size_t>(band.height) * target_stride_;
+    band.status = band.adapter->Render(band.scene, band_config, target_.subspan(offset, length));
+}
+
+void TiledAdapter::WorkerLoop(size_t band_index, uint64_t seen) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            start_cv_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+        }
+
+        RenderBand(bands_[band_index]);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0) {
+                done_cv_.notify_one();
+            }
+        }
+    }
+}
+
+void TiledAdapter::StopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    start_cv_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+std::string TiledAdapter::InnerIdOf(const std::string& id) {
+    const std::string suffix = std::string(1, kVariantSeparator) + kTiledParams;
+    if (id.size() > suffix.size() && id.ends_with(suffix)) {
+        return id.substr(0, id.size() - suffix.size());
+    }
+    return {};
+}
+
+Result<PreparedScene> TiledAdapter::MakeBandScene(const PreparedScene& scene, int y0, int height) {
+    PreparedScene band = scene;
+    band.height = static_cast<uint32_t>(height);
+    band.command_stream.clear();
+    band.command_stream.reserve(scene.command_stream.size() + 1 + 24);
+
+    const float dy = static_cast<float>(y0);
+    const float shift[6] = {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, -dy};
+    AppendSetMatrix(band.command_stream, shift);
+
+    const uint8_t* ptr = scene.command_stream.data();
+    const uint8_t* end = ptr + scene.command_stream.size();
+    while (ptr < end) {
+        const auto op = static_cast<ir::Opcode>(*ptr++);
+        const int size = ir::CommandPayloadSize(op);
+        if (size < 0) {
+            return Status::InvalidArg("Unknown opcode in command stream");
+        }
+        if (end - ptr < size) {
+            return Status::InvalidArg("Truncated command in command stream");
+        }
+
+        if (op == ir::Opcode::kSetMatrix) {
+            // Absolute transforms replace the band shift, so pre-translate them.
+            float m[6];
+            std::memcpy(m, ptr, sizeof(m));
+            m[5] -= dy;
+            AppendSetMatrix(band.command_stream, m);
+        } else {
+            band.command_stream.push_back(static_cast<uint8_t>(op));
+            band.command_stream.insert(band.command_stream.end(), ptr, ptr + size);
+        }
+        ptr += size;
+        if (op == ir::Opcode::kEnd) {
+            break;
+        }
+    }
+    return band;
+}
+
+void RegisterTiledVariants() {
+    auto& registry = AdapterRegistry::Instance();
+
+    // Copy first: registering variants grows the entry list.
+    std::vector<AdapterEntry> bases;
+    for (const auto& entry : registry.GetAdapters()) {
+        if (!entry.is_variant()) {
+            bases.push_back(entry);
+        }
+    }
+
+    for (const auto& entry : bases) {
+        auto probe = entry.factory();
+        if (!probe || probe->GetCapabilities().supports_parallel_render) {
+            continue;  // Natively multi-threaded engines are measured as they are
+        }
+        if (!probe->GetCapabilities().supports_transforms) {
+            continue;  // Bands would all draw from row 0
+        }
+        registry.RegisterVariant(
+            entry.id, kTiledParams, AdapterRegistry::MakeVariantName(entry.name, kTiledParams),
+            [id = entry.id, factory = entry.factory]() {
+                return std::make_unique<TiledAdapter>(id, factory);
+            });
+    }
+}
+
+}  // namespace vgcpu
@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [REQ-35] Concurrency (Chapter
+// 4)
+
+#pragma once
+
+#include "adapters/adapter_interface.h"
+#include "adapters/adapter_registry.h"
+#include "ir/prepared_scene.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vgcpu {
+
+/// Variant parameter string of tile-parallel variants ("<backend>:tiled").
+inline constexpr const char* kTiledParams = "tiled";
+
+/// Tile-parallel decorator adapter.
+/// Splits the surface into one horizontal band per thread. Each band owns an inner adapter
+/// instance and a copy of the scene whose command stream is translated by the band's y offset,
+/// so the inner backend's own surface clips it. Bands render concurrently on persistent workers,
+/// each straight into its rows of the shared output buffer. The translate needs an inner backend
+/// with CapabilitySet::supports_transforms; others get no tiled variant. This lets single-threaded
+/// engines use many cores, and comparing against the inner backend's serial time measures
+/// "parallelize it ourselves" against native multi-threaded engines (see Harness::ApplyScaling).
+class TiledAdapter : public IBackendAdapter {
+   public:
+    TiledAdapter(std::string inner_id, AdapterFactory inner_factory);
+    ~TiledAdapter() override;
+
+    TiledAdapter(const TiledAdapter&) = delete;
+    TiledAdapter& operator=(const TiledAdapter&) = delete;
+
+    // Lifecycle
+    Status Initialize(const AdapterArgs& args) override;
+    Status Prepare(const PreparedScene& scene) override;
+    void Shutdown() override;
+
+    // Metadata
+    [[nodiscard]] AdapterInfo GetInfo() const override;
+    [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return inner_format_; }
+
+    // Rendering
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override;
+
+    // Stroker isolation: outlines come from the first band's inner instance
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
+
+    /// Number of bands (and inner adapter instances) used per frame.
+    [[nodiscard]] size_t GetBandCount() const { return bands_.size(); }
+
+    /// Inner backend id of a tiled variant id ("cairo:tiled" -> "cairo"); empty otherwise.
+    [[nodiscard]] static std::string InnerIdOf(const std::string& id);
+
+    /// Copy of `scene` covering rows [y0, y0 + height): the surface height shrinks and every
+    /// absolute transform (plus an implicit initial one) is translated by -y0.
+    /// @return InvalidArg if the command stream cannot be walked.
+    [[nodiscard]] static Result<PreparedScene> MakeBandScene(const PreparedScene& scene, int y0,
+                                                             int height);
+
+   private:
+    struct Band {
+        std::unique_ptr<IBackendAdapter> adapter;
+        PreparedScene scene;
+        int y0 = 0;
+        int height = 0;
+        Status status;
+    };
+
+    void RenderBand(Band& band);
+    /// @param seen Frame generation at launch; the worker waits for the next one.
+    void WorkerLoop(size_t band_index, uint64_t seen);
+    void StopWorkers();
+    /// Stop the workers, then shut down and drop every band.
+    void ReleaseBands();
+
+    std::string inner_id_;
+    AdapterFactory inner_factory_;
+    AdapterInfo inner_info_;
+    CapabilitySet inner_caps_;
+    PixelFormat inner_format_ = PixelFormat::kRgba8Premul;
+
+    std::vector<Band> bands_;
+    int width_ = 0;
+    int height_ = 0;
+    SurfaceView target_;     ///< Output buffer of the frame in flight
+    int target_stride_ = 0;  ///< Its row stride in bytes
+
+    // Persistent workers render bands 1..N-1; the calling thread renders band 0.
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    uint64_t generation_ = 0;
+    size_t pending_ = 0;
+    bool stop_ = false;
+    bool initialized_ = false;
+};
+
+/// Register a "<id>:tiled" variant for every registered backend without native parallel
+/// rendering that applies transforms. Call after all backends are registered.
+void RegisterTiledVariants();
+
+}  // namespace vgcpu
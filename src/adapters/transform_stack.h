@@ -0,0 +1,68 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] IBackendAdapter
+// (Chapter 4)
+
+#pragma once
+
+#include "ir/ir_format.h"
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace vgcpu {
+
+/// Current transform and save/restore stack for backends without a native state stack
+/// (ThorVG, Vello, Raqote, OpenVG). Matrices use the IR layout:
+/// x' = a*x + c*y + e, y' = b*x + d*y + f.
+class TransformStack {
+   public:
+    using Matrix = std::array<float, 6>;
+
+    static constexpr Matrix kIdentity = {1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+
+    /// Forget all state (start of a frame).
+    void Reset() {
+        ctm_ = kIdentity;
+        stack_.clear();
+    }
+
+    void Save() { stack_.push_back(ctm_); }
+
+    /// Pop the last saved transform; unbalanced restores are ignored.
+    void Restore() {
+        if (!stack_.empty()) {
+            ctm_ = stack_.back();
+            stack_.pop_back();
+        }
+    }
+
+    /// Apply a kSetMatrix or kConcatMatrix payload (f32[6]).
+    void Apply(ir::Opcode op, const uint8_t* payload) {
+        Matrix m;
+        std::memcpy(m.data(), payload, sizeof(m));
+        ctm_ = (op == ir::Opcode::kSetMatrix) ? m : Multiply(ctm_, m);
+    }
+
+    [[nodiscard]] const Matrix& Current() const { return ctm_; }
+
+    [[nodiscard]] bool IsIdentity() const { return ctm_ == kIdentity; }
+
+    /// Canvas-style concatenation: the result maps points through `m` first, then `cur`.
+    [[nodiscard]] static Matrix Multiply(const Matrix& cur, const Matrix& m) {
+        return {cur[0] * m[0] + cur[2] * m[1],
+                cur[1] * m[0] + cur[3] * m[1],
+                cur[0] * m[2] + cur[2] * m[3],
+                cur[1] * m[2] + cur[3] * m[3],
+                cur[0] * m[4] + cur[2] * m[5] + cur[4],
+                cur[1] * m[4] + cur[3] * m[5] + cur[5]};
+    }
+
+   private:
+    Matrix ctm_ = kIdentity;
+    std::vector<Matrix> stack_;
+};
+
+}  // namespace vgcpu
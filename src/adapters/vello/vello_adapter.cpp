@@ -27,6 +27,7 @@ VloSurface* vlo_create(int32_t width, int32_t height);
 void vlo_destroy(VloSurface* ptr);
 void vlo_clear(VloSurface* ptr, uint8_t r, uint8_t g, uint8_t b, uint8_t a);
 void vlo_get_pixels(VloSurface* ptr, uint32_t* out_buf);
+void vlo_set_transform(VloSurface* ptr, float a, float b, float c, float d, float e, float f);
 
 // Path construction
 VloPath* vlo_path_create();
@@ -129,11 +130,12 @@ CapabilitySet VelloAdapter::GetCapabilities() const {
     caps.supports_radial_gradient = false;
     caps.supports_clipping = false;
     caps.supports_dashes = false;
+    caps.supports_transforms = true;
     return caps;
 }
 
 Status VelloAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
-                            std::vector<uint8_t>& output_buffer) {
+                            SurfaceView output_buffer) {
     if (!initialized_)
         return Status::Fail("VelloAdapter not initialized");
     if (!scene.IsValid())
@@ -154,6 +156,12 @@ Status VelloAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
     ir::StrokeCap current_stroke_cap = ir::StrokeCap::kButt;
     ir::StrokeJoin current_stroke_join = ir::StrokeJoin::kMiter;
 
+    transforms_.Reset();
+    auto sync_transform = [&] {
+        const auto& m = transforms_.Current();
+        vlo_set_transform(surf, m[0], m[1], m[2], m[3], m[4], m[5]);
+    };
+
     const uint8_t* cmd = scene.command_stream.data();
     const uint8_t* end = cmd + scene.command_stream.size();
 
@@ -245,15 +253,23 @@ Status VelloAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
                 break;
             }
 
+            // vello_cpu has no state stack: track the transform here and push it on change
             case ir::Opcode::kSave:
+                transforms_.Save();
+                break;
+
             case ir::Opcode::kRestore:
-                // vello_cpu doesn't have state stack exposed this way
+                transforms_.Restore();
+                sync_transform();
                 break;
 
             case ir::Opcode::kSetMatrix:
             case ir::Opcode::kConcatMatrix:
-                // TODO: Implement transform support if vello_cpu supports it
+                if (cmd + 24 > end)
+                    goto done;
+                transforms_.Apply(opcode, cmd);
                 cmd += 24;
+                sync_transform();
                 break;
 
             default:
@@ -262,7 +278,7 @@ Status VelloAdapter::Render(const PreparedScene& scene, const SurfaceConfig& con
     }
 
 done:
-    // Copy pixels to output buffer (vello_cpu uses ARGB order internally)
+    // Copy pixels to output buffer (vello_cpu pixmaps are premultiplied RGBA8 bytes)
     vlo_get_pixels(surf, reinterpret_cast<uint32_t*>(output_buffer.data()));
     vlo_destroy(surf);
 
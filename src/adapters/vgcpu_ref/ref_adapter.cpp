@@ -0,0 +1,390 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#include "adapters/vgcpu_ref/ref_adapter.h"
+
+#include "adapters/adapter_registry.h"
+#include "ir/ir_format.h"
+#include "ir/prepared_scene.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace vgcpu {
+
+namespace {
+
+constexpr const char* kRefName = "VGCPU Reference Rasterizer (built-in)";
+
+/// Flattening tolerance in device pixels (matches the decode baseline).
+constexpr float kFlattenTolerance = 0.25f;
+
+/// Initial state stack depth reserved at Initialize.
+constexpr size_t kStateStackReserve = 32;
+
+template <typename T>
+T ReadLE(const uint8_t*& ptr) {
+    T val;
+    std::memcpy(&val, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return val;
+}
+
+std::string IsaParams(ref::KernelIsa isa) {
+    return std::string("simd=") + ref::IsaName(isa);
+}
+
+/// Per-channel linear interpolation of two premultiplied RGBA8 colors.
+uint32_t LerpColor(uint32_t c0, uint32_t c1, float f) {
+    uint32_t out = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        float a = static_cast<float>((c0 >> shift) & 0xFF);
+        float b = static_cast<float>((c1 >> shift) & 0xFF);
+        auto v = static_cast<uint32_t>(a + (b - a) * f + 0.5f);
+        out |= std::min(v, 255u) << shift;
+    }
+    return out;
+}
+
+int LutIndex(float t) {
+    if (!(t > 0.0f)) {
+        return 0;  // Also catches NaN
+    }
+    return t >= 1.0f ? 255 : static_cast<int>(t * 255.0f + 0.5f);
+}
+
+}  // namespace
+
+Status VgcpuRefAdapter::Initialize(const AdapterArgs& args) {
+    // Single-threaded rasterizer; only the ISA cap applies
+    if (!pinned_isa_) {
+        isa_ = args.max_isa ? ref::DetectBestIsa(*args.max_isa) : ref::DetectBestIsa();
+    } else if (!ref::IsIsaAvailable(isa_)) {
+        return Status::Unsupported(std::string("ISA not available on this CPU: ") +
+                                   ref::IsaName(isa_));
+    } else if (args.max_isa && !ref::IsIsaWithinLevel(isa_, *args.max_isa)) {
+        return Status::Unsupported(std::string("Pinned ISA ") + ref::IsaName(isa_) +
+                                   " exceeds the " + pal::IsaLevelName(*args.max_isa) + " cap");
+    }
+    kernels_ = &ref::GetKernels(isa_);
+    state_stack_.reserve(kStateStackReserve);
+    initialized_ = true;
+    return Status::Ok();
+}
+
+Status VgcpuRefAdapter::Prepare(const PreparedScene& scene) {
+    if (!initialized_) {
+        return Status::Fail("VgcpuRefAdapter not initialized");
+    }
+    BuildGradientLuts(scene);
+
+    // One untimed render grows the polygon, cell and span buffers so Render does not allocate
+    // ([REQ-113]).
+    SurfaceConfig config;
+    config.width = static_cast<int>(scene.width);
+    config.height = static_cast<int>(scene.height);
+    SurfaceBuffer scratch(static_cast<size_t>(config.width) * config.height * 4);
+    return Render(scene, config, scratch);
+}
+
+void VgcpuRefAdapter::Shutdown() {
+    rasterizer_ = {};
+    stroker_ = {};
+    polygon_ = {};
+    centerline_ = {};
+    gradient_luts_ = {};
+    span_colors_ = {};
+    state_stack_ = {};
+    kernels_ = nullptr;
+    initialized_ = false;
+}
+
+AdapterInfo VgcpuRefAdapter::GetInfo() const {
+    const std::string params = pinned_isa_ ? IsaParams(isa_) : std::string();
+    return AdapterInfo{.id = AdapterRegistry::MakeVariantId("vgcpu_ref", params),
+                       .detailed_name = AdapterRegistry::MakeVariantName(kRefName, params),
+                       .version = "1.0.0",
+                       .is_cpu_only = true};
+}
+
+CapabilitySet VgcpuRefAdapter::GetCapabilities() const {
+    CapabilitySet caps = CapabilitySet::All();
+    caps.supports_dashes = false;
+    caps.supports_clipping = false;
+    caps.supports_isa_cap = true;         // Kernel selection honors AdapterArgs::max_isa
+    caps.supports_transforms = true;
+    caps.supports_surface_stride = true;  // Rows are addressed through SurfaceConfig::stride
+    return caps;
+}
+
+Status VgcpuRefAdapter::Render(const PreparedScene& scene, const SurfaceConfig& config,
+                               SurfaceView output_buffer) {
+    if (!initialized_) {
+        return Status::Fail("VgcpuRefAdapter not initialized");
+    }
+
+    if (!scene.IsValid()) {
+        return Status::InvalidArg("Invalid scene");
+    }
+
+    if (config.width <= 0 || config.height <= 0) {
+        return Status::InvalidArg("Invalid surface configuration");
+    }
+
+    const int stride = SurfaceStride(config);
+    if (stride % 4 != 0 || stride < config.width * 4) {
+        return Status::InvalidArg("Invalid surface stride");
+    }
+    const size_t row_pixels = static_cast<size_t>(stride) / 4;
+    if (output_buffer.size() < row_pixels * config.height * 4) {
+        return Status::InvalidArg("Output buffer smaller than surface");
+    }
+    if (gradient_luts_.size() != scene.paints.size()) {
+        BuildGradientLuts(scene);
+    }
+    rasterizer_.Reset(config.width, config.height);
+    if (span_colors_.size() < static_cast<size_t>(config.width) + 2) {
+        span_colors_.resize(static_cast<size_t>(config.width) + 2);
+    }
+
+    // Buffer is pre-sized by harness. Contents are undefined until kClear.
+    auto* pixels = reinterpret_cast<uint32_t*>(output_buffer.data());
+
+    DrawState state;
+    state_stack_.clear();
+
+    const uint8_t* ptr = scene.command_stream.data();
+    const uint8_t* end = ptr + scene.command_stream.size();
+
+    while (ptr < end) {
+        auto op = static_cast<ir::Opcode>(*ptr++);
+        switch (op) {
+            case ir::Opcode::kEnd:
+                return Status::Ok();
+
+            case ir::Opcode::kSave:
+                state_stack_.push_back(state);
+                break;
+
+            case ir::Opcode::kRestore:
+                if (!state_stack_.empty()) {
+                    state = state_stack_.back();
+                    state_stack_.pop_back();
+                }
+                break;
+
+            case ir::Opcode::kClear: {
+                if (end - ptr < 4)
+                    return Status::InvalidArg("Truncated Clear command");
+                const uint32_t color = ReadLE<uint32_t>(ptr);
+                for (int y = 0; y < config.height; ++y) {
+                    uint32_t* row = pixels + static_cast<size_t>(y) * row_pixels;
+                    std::fill(row, row + config.width, color);
+                }
+                break;
+            }
+
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix: {
+                if (end - ptr < 24)
+                    return Status::InvalidArg("Truncated matrix command");
+                float m[6];
+                std::memcpy(m, ptr, sizeof(m));
+                ptr += sizeof(m);
+                const ref::Affine affine{m[0], m[1], m[2], m[3], m[4], m[5]};
+                state.ctm =
+                    (op == ir::Opcode::kSetMatrix) ? affine : state.ctm.Multiply(affine);
+                break;
+            }
+
+            case ir::Opcode::kSetFill:
+                if (end - ptr < 3)
+                    return Status::InvalidArg("Truncated SetFill command");
+                state.fill_paint = ReadLE<uint16_t>(ptr);
+                state.fill_even_odd =
+                    static_cast<ir::FillRule>(ReadLE<uint8_t>(ptr)) == ir::FillRule::kEvenOdd;
+                break;
+
+            case ir::Opcode::kSetStroke: {
+                if (end - ptr < 7)
+                    return Status::InvalidArg("Truncated SetStroke command");
+                state.stroke_paint = ReadLE<uint16_t>(ptr);
+                state.stroke.width = ReadLE<float>(ptr);
+                const uint8_t opts = ReadLE<uint8_t>(ptr);
+                state.stroke.cap = static_cast<ir::StrokeCap>(opts & 0x03);
+                state.stroke.join = static_cast<ir::StrokeJoin>((opts >> 2) & 0x03);
+                break;
+            }
+
+            case ir::Opcode::kFillPath: {
+                if (end - ptr < 2)
+                    return Status::InvalidArg("Truncated FillPath command");
+                const uint16_t path_id = ReadLE<uint16_t>(ptr);
+                if (path_id >= scene.paths.size() || state.fill_paint >= scene.paints.size())
+                    break;
+                polygon_.Clear();
+                ref::FlattenPath(scene.paths[path_id], state.ctm, kFlattenTolerance, polygon_);
+                rasterizer_.AddPolygon(polygon_);
+                DrawCoverage(scene.paints[state.fill_paint], state.fill_paint, state.ctm,
+                             state.fill_even_odd, pixels, row_pixels);
+                break;
+            }
+
+            case ir::Opcode::kStrokePath: {
+                if (end - ptr < 2)
+                    return Status::InvalidArg("Truncated StrokePath command");
+                const uint16_t path_id = ReadLE<uint16_t>(ptr);
+                if (path_id >= scene.paths.size() || state.stroke_paint >= scene.paints.size())
+                    break;
+                const float scale = state.ctm.ScaleFactor();
+                if (!(scale > 0.0f))
+                    break;
+                // Stroke in user space, then transform the outline: keeps non-uniform scales
+                // producing elliptical pens like the library backends.
+                const float tolerance = kFlattenTolerance / scale;
+                centerline_.Clear();
+                ref::FlattenPath(scene.paths[path_id], ref::Affine{}, tolerance, centerline_);
+                polygon_.Clear();
+                stroker_.Stroke(centerline_, state.stroke, tolerance, polygon_);
+                polygon_.Transform(state.ctm);
+                rasterizer_.AddPolygon(polygon_);
+                DrawCoverage(scene.paints[state.stroke_paint], state.stroke_paint, state.ctm,
+                             false, pixels, row_pixels);
+                break;
+            }
+
+            default:
+                return Status::InvalidArg("Unknown opcode in command stream");
+        }
+    }
+
+    return Status::Ok();
+}
+
+Result<Path> VgcpuRefAdapter::StrokeToPath(const Path& path, const StrokeParams& stroke) {
+    Path outline;
+    if (!(stroke.resolution_scale > 0.0f)) {
+        return outline;  // Degenerate transform: nothing would be drawn
+    }
+    // Same tolerance and stroker as Render's kStrokePath, so the outline matches the stroke.
+    const float tolerance = kFlattenTolerance / stroke.resolution_scale;
+    const ref::StrokeStyle style{stroke.width, stroke.cap, stroke.join, stroke.miter_limit};
+    centerline_.Clear();
+    ref::FlattenPath(path, ref::Affine{}, tolerance, centerline_);
+    polygon_.Clear();
+    stroker_.Stroke(centerline_, style, tolerance, polygon_);
+
+    outline.verbs.reserve(polygon_.points.size() + polygon_.contour_ends.size());
+    outline.points.reserve(polygon_.points.size() * 2);
+    uint32_t begin = 0;
+    for (const uint32_t contour_end : polygon_.contour_ends) {
+        for (uint32_t i = begin; i < contour_end; ++i) {
+            outline.verbs.push_back(i == begin ? ir::PathVerb::kMoveTo : ir::PathVerb::kLineTo);
+            outline.points.push_back(polygon_.points[i].x);
+            outline.points.push_back(polygon_.points[i].y);
+        }
+        outline.verbs.push_back(ir::PathVerb::kClose);
+        begin = contour_end;
+    }
+    return outline;
+}
+
+void VgcpuRefAdapter::BuildGradientLuts(const PreparedScene& scene) {
+    gradient_luts_.assign(scene.paints.size(), GradientLut{});
+    for (size_t i = 0; i < scene.paints.size(); ++i) {
+        const Paint& paint = scene.paints[i];
+        if (paint.type == ir::PaintType::kSolid || paint.stops.empty()) {
+            continue;
+        }
+        const auto& stops = paint.stops;
+        GradientLut& lut = gradient_luts_[i];
+        size_t s = 0;
+        for (int k = 0; k < 256; ++k) {
+            const float t = static_cast<float>(k) / 255.0f;
+            while (s < stops.size() && stops[s].offset < t) {
+                ++s;
+            }
+            if (s == 0) {
+                lut[k] = stops.front().color;
+            } else if (s == stops.size()) {
+                lut[k] = stops.back().color;
+            } else {
+                const auto& a = stops[s - 1];
+                const auto& b = stops[s];
+                const float span = b.offset - a.offset;
+                const float f = span > 0.0f ? (t - a.offset) / span : 1.0f;
+                lut[k] = LerpColor(a.color, b.color, f);
+            }
+        }
+    }
+}
+
+void VgcpuRefAdapter::DrawCoverage(const Paint& paint, size_t paint_id, const ref::Affine& ctm,
+                                   bool even_odd, uint32_t* pixels, size_t row_pixels) {
+    const ref::Kernels& k = *kernels_;
+
+    if (paint.type == ir::PaintType::kSolid) {
+        rasterizer_.Sweep(k, even_odd, [&](int y, int x, const float* coverage, int count) {
+            k.composite_solid(pixels + static_cast<size_t>(y) * row_pixels + x, coverage, count,
+                              paint.color);
+        });
+        return;
+    }
+
+    // Gradients are evaluated at pixel centers mapped back to user space.
+    const ref::Affine inv = ctm.Inverse();
+    const GradientLut& lut = gradient_luts_[paint_id];
+    uint32_t* colors = span_colors_.data();
+
+    rasterizer_.Sweep(k, even_odd, [&](int y, int x, const float* coverage, int count) {
+        ref::Point p = inv.Apply({static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f});
+        if (paint.type == ir::PaintType::kLinear) {
+            const float dx = paint.linear_end_x - paint.linear_start_x;
+            const float dy = paint.linear_end_y - paint.linear_start_y;
+            const float len2 = dx * dx + dy * dy;
+            const float rcp = len2 > 0.0f ? 1.0f / len2 : 0.0f;
+            float t =
+                ((p.x - paint.linear_start_x) * dx + (p.y - paint.linear_start_y) * dy) * rcp;
+            const float dt = (inv.a * dx + inv.b * dy) * rcp;
+            for (int i = 0; i < count; ++i, t += dt) {
+                colors[i] = lut[static_cast<size_t>(LutIndex(t))];
+            }
+        } else {
+            const float r = paint.radial_radius;
+            const float rcp = r > 0.0f ? 1.0f / r : 0.0f;
+            for (int i = 0; i < count; ++i, p.x += inv.a, p.y += inv.b) {
+                const float t = r > 0.0f ? std::hypot(p.x - paint.radial_center_x,
+                                                      p.y - paint.radial_center_y) *
+                                               rcp
+                                         : 1.0f;
+                colors[i] = lut[static_cast<size_t>(LutIndex(t))];
+            }
+        }
+        k.composite_span(pixels + static_cast<size_t>(y) * row_pixels + x, coverage, colors,
+                         count);
+    });
+}
+
+// Explicit registration function (called from main)
+void RegisterVgcpuRefAdapter() {
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("vgcpu_ref", kRefName, []() { return std::make_unique<VgcpuRefAdapter>(); });
+
+    // Pinned-ISA variants, only for kernels this build and CPU can run.
+    for (auto isa : {ref::KernelIsa::kScalar, ref::KernelIsa::kSse2, ref::KernelIsa::kAvx2,
+                     ref::KernelIsa::kNeon}) {
+        if (!ref::IsIsaAvailable(isa)) {
+            continue;
+        }
+        registry.RegisterVariant("vgcpu_ref", IsaParams(isa),
+                                 AdapterRegistry::MakeVariantName(kRefName, IsaParams(isa)),
+                                 [isa]() { return std::make_unique<VgcpuRefAdapter>(isa); });
+    }
+}
+
+}  // namespace vgcpu
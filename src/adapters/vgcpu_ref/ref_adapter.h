@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#pragma once
+
+#include "adapters/adapter_interface.h"
+#include "adapters/vgcpu_ref/ref_kernels.h"
+#include "adapters/vgcpu_ref/ref_rasterizer.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vgcpu {
+
+struct Paint;
+
+/// Built-in reference rasterizer adapter.
+/// A dependency-free sparse-scanline analytic coverage rasterizer (nonzero/even-odd fills,
+/// polygonal stroker, solid and gradient spans) with scalar, SSE2, AVX2 and NEON span kernels.
+/// It serves as a performance baseline that needs no third-party library and, through its scalar
+/// kernel, as deterministic ground truth for SSIM comparisons. The default "vgcpu_ref" backend
+/// uses the best ISA of the running CPU; "vgcpu_ref:simd=<isa>" variants pin a kernel set.
+class VgcpuRefAdapter : public IBackendAdapter {
+   public:
+    VgcpuRefAdapter() = default;
+    explicit VgcpuRefAdapter(ref::KernelIsa isa) : isa_(isa), pinned_isa_(true) {}
+    ~VgcpuRefAdapter() override = default;
+
+    // Lifecycle
+    Status Initialize(const AdapterArgs& args) override;
+    Status Prepare(const PreparedScene& scene) override;
+    void Shutdown() override;
+
+    // Metadata
+    [[nodiscard]] AdapterInfo GetInfo() const override;
+    [[nodiscard]] CapabilitySet GetCapabilities() const override;
+    [[nodiscard]] PixelFormat GetNativeFormat() const override { return PixelFormat::kRgba8Premul; }
+
+    // Rendering
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override;
+
+    // Stroker isolation: the polygonal stroker's outline as closed polylines
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override;
+
+    /// Instruction set of the kernels used for rendering.
+    [[nodiscard]] ref::KernelIsa GetIsa() const { return isa_; }
+
+   private:
+    using GradientLut = std::array<uint32_t, 256>;  ///< Premultiplied RGBA8, pad spread
+
+    /// Graphics state saved and restored by kSave/kRestore.
+    struct DrawState {
+        ref::Affine ctm;
+        uint16_t fill_paint = 0;
+        bool fill_even_odd = false;
+        uint16_t stroke_paint = 0;
+        ref::StrokeStyle stroke;
+    };
+
+    void BuildGradientLuts(const PreparedScene& scene);
+    void DrawCoverage(const Paint& paint, size_t paint_id, const ref::Affine& ctm, bool even_odd,
+                      uint32_t* pixels, size_t row_pixels);
+
+    ref::KernelIsa isa_ = ref::KernelIsa::kScalar;
+    bool pinned_isa_ = false;
+    bool initialized_ = false;
+    const ref::Kernels* kernels_ = nullptr;
+
+    ref::Rasterizer rasterizer_;
+    ref::Stroker stroker_;
+    ref::Polygon polygon_;     ///< Device-space fill or stroke outline
+    ref::Polygon centerline_;  ///< User-space stroke centerline
+    std::vector<GradientLut> gradient_luts_;  ///< Indexed by paint id (unused for solid paints)
+    std::vector<uint32_t> span_colors_;       ///< Gradient colors for one span
+    std::vector<DrawState> state_stack_;
+};
+
+/// Register the reference adapter (and its per-ISA variants) with the global registry.
+void RegisterVgcpuRefAdapter();
+
+}  // namespace vgcpu
@@ -0,0 +1,518 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#include "adapters/vgcpu_ref/ref_kernels.h"
+
+#include "vgcpu/internal/export.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define VGCPU_REF_X86 1
+#include <immintrin.h>
+#if defined(VGCPU_COMPILER_MSVC)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+#define VGCPU_REF_NEON 1
+#include <arm_neon.h>
+#endif
+
+// AVX2 kernels are compiled with a function-level target so the rest of the build keeps its
+// baseline ISA; they are only selected after a runtime CPU check.
+#if defined(VGCPU_REF_X86) && (defined(VGCPU_COMPILER_GCC) || defined(VGCPU_COMPILER_CLANG))
+#define VGCPU_REF_AVX2_TARGET __attribute__((target("avx2")))
+#define VGCPU_REF_HAS_AVX2 1
+#elif defined(VGCPU_REF_X86) && defined(VGCPU_COMPILER_MSVC)
+#define VGCPU_REF_AVX2_TARGET
+#define VGCPU_REF_HAS_AVX2 1
+#endif
+
+namespace vgcpu::ref {
+
+namespace {
+
+// ============================================================================
+// Scalar reference (defines the blending math every SIMD variant must match)
+// ============================================================================
+
+/// Exact round(x / 255) for x <= 65535.
+inline uint32_t Div255(uint32_t x) {
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+inline uint32_t CoverageToByte(float c) {
+    return static_cast<uint32_t>(c * 255.0f + 0.5f);
+}
+
+inline float ApplyFillRule(float winding, bool even_odd) {
+    float a = std::fabs(winding);
+    if (even_odd) {
+        a -= 2.0f * static_cast<float>(static_cast<int>(a * 0.5f));
+        return 1.0f - std::fabs(1.0f - a);
+    }
+    return std::min(a, 1.0f);
+}
+
+inline uint32_t BlendPixel(uint32_t d, uint32_t s, uint32_t c) {
+    uint32_t sr = Div255((s & 0xFF) * c);
+    uint32_t sg = Div255(((s >> 8) & 0xFF) * c);
+    uint32_t sb = Div255(((s >> 16) & 0xFF) * c);
+    uint32_t sa = Div255((s >> 24) * c);
+    uint32_t inv = 255 - sa;
+    uint32_t r = sr + Div255((d & 0xFF) * inv);
+    uint32_t g = sg + Div255(((d >> 8) & 0xFF) * inv);
+    uint32_t b = sb + Div255(((d >> 16) & 0xFF) * inv);
+    uint32_t a = sa + Div255((d >> 24) * inv);
+    return r | (g << 8) | (b << 16) | (a << 24);
+}
+
+void AccumulateScalar(float* cells, float* coverage, int n, bool even_odd) {
+    float acc = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        acc += cells[i];
+        cells[i] = 0.0f;
+        coverage[i] = ApplyFillRule(acc, even_odd);
+    }
+}
+
+void CompositeSolidScalar(uint32_t* dst, const float* coverage, int n, uint32_t color) {
+    for (int i = 0; i < n; ++i) {
+        dst[i] = BlendPixel(dst[i], color, CoverageToByte(coverage[i]));
+    }
+}
+
+void CompositeSpanScalar(uint32_t* dst, const float* coverage, const uint32_t* src, int n) {
+    for (int i = 0; i < n; ++i) {
+        dst[i] = BlendPixel(dst[i], src[i], CoverageToByte(coverage[i]));
+    }
+}
+
+// ============================================================================
+// SSE2
+// ============================================================================
+#if defined(VGCPU_REF_X86)
+
+inline __m128i Div255Sse2(__m128i x) {
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+/// Four coverage floats to per-channel replicated bytes (c | c<<8 | c<<16 | c<<24).
+inline __m128i CoverageBytesSse2(const float* coverage) {
+    __m128 cf = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(coverage), _mm_set1_ps(255.0f)),
+                           _mm_set1_ps(0.5f));
+    __m128i ci = _mm_cvttps_epi32(cf);
+    ci = _mm_or_si128(ci, _mm_slli_epi32(ci, 8));
+    return _mm_or_si128(ci, _mm_slli_epi32(ci, 16));
+}
+
+/// Blend two pixels held as 8 x u16 lanes.
+inline __m128i Blend2Sse2(__m128i d16, __m128i s16, __m128i c16) {
+    __m128i sc = Div255Sse2(_mm_mullo_epi16(s16, c16));
+    __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sc, _MM_SHUFFLE(3, 3, 3, 3)),
+                                     _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i inv = _mm_sub_epi16(_mm_set1_epi16(255), sa);
+    return _mm_add_epi16(sc, Div255Sse2(_mm_mullo_epi16(d16, inv)));
+}
+
+inline __m128i Blend4Sse2(__m128i d, __m128i s, __m128i c) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = Blend2Sse2(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(s, zero),
+                            _mm_unpacklo_epi8(c, zero));
+    __m128i hi = Blend2Sse2(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(s, zero),
+                            _mm_unpackhi_epi8(c, zero));
+    return _mm_packus_epi16(lo, hi);
+}
+
+void AccumulateSse2(float* cells, float* coverage, int n, bool even_odd) {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    __m128 carry = _mm_setzero_ps();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 x = _mm_loadu_ps(cells + i);
+        _mm_storeu_ps(cells + i, _mm_setzero_ps());
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+        x = _mm_add_ps(x, carry);
+        carry = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+
+        __m128 a = _mm_andnot_ps(sign, x);
+        if (even_odd) {
+            __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(a, half)));
+            a = _mm_sub_ps(a, _mm_mul_ps(t, two));
+            a = _mm_sub_ps(one, _mm_andnot_ps(sign, _mm_sub_ps(one, a)));
+        } else {
+            a = _mm_min_ps(a, one);
+        }
+        _mm_storeu_ps(coverage + i, a);
+    }
+    float acc = _mm_cvtss_f32(carry);
+    for (; i < n; ++i) {
+        acc += cells[i];
+        cells[i] = 0.0f;
+        coverage[i] = ApplyFillRule(acc, even_odd);
+    }
+}
+
+void CompositeSolidSse2(uint32_t* dst, const float* coverage, int n, uint32_t color) {
+    const __m128i s = _mm_set1_epi32(static_cast<int>(color));
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i out = Blend4Sse2(d, s, CoverageBytesSse2(coverage + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+    }
+    CompositeSolidScalar(dst + i, coverage + i, n - i, color);
+}
+
+void CompositeSpanSse2(uint32_t* dst, const float* coverage, const uint32_t* src, int n) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i out = Blend4Sse2(d, s, CoverageBytesSse2(coverage + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), out);
+    }
+    CompositeSpanScalar(dst + i, coverage + i, src + i, n - i);
+}
+
+#endif  // VGCPU_REF_X86
+
+// ============================================================================
+// AVX2 (8 pixels per iteration; unpack/pack stay within 128-bit lanes, preserving order)
+// ============================================================================
+#if defined(VGCPU_REF_HAS_AVX2)
+
+VGCPU_REF_AVX2_TARGET inline __m256i Div255Avx2(__m256i x) {
+    x = _mm256_add_epi16(x, _mm256_set1_epi16(128));
+    return _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+}
+
+VGCPU_REF_AVX2_TARGET inline __m256i CoverageBytesAvx2(const float* coverage) {
+    __m256 cf = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(coverage), _mm256_set1_ps(255.0f)),
+                              _mm256_set1_ps(0.5f));
+    __m256i ci = _mm256_cvttps_epi32(cf);
+    ci = _mm256_or_si256(ci, _mm256_slli_epi32(ci, 8));
+    return _mm256_or_si256(ci, _mm256_slli_epi32(ci, 16));
+}
+
+VGCPU_REF_AVX2_TARGET inline __m256i Blend4Avx2(__m256i d16, __m256i s16, __m256i c16) {
+    __m256i sc = Div255Avx2(_mm256_mullo_epi16(s16, c16));
+    __m256i sa = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(sc, _MM_SHUFFLE(3, 3, 3, 3)),
+                                        _MM_SHUFFLE(3, 3, 3, 3));
+    __m256i inv = _mm256_sub_epi16(_mm256_set1_epi16(255), sa);
+    return _mm256_add_epi16(sc, Div255Avx2(_mm256_mullo_epi16(d16, inv)));
+}
+
+VGCPU_REF_AVX2_TARGET inline __m256i Blend8Avx2(__m256i d, __m256i s, __m256i c) {
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo = Blend4Avx2(_mm256_unpacklo_epi8(d, zero), _mm256_unpacklo_epi8(s, zero),
+                            _mm256_unpacklo_epi8(c, zero));
+    __m256i hi = Blend4Avx2(_mm256_unpackhi_epi8(d, zero), _mm256_unpackhi_epi8(s, zero),
+                            _mm256_unpackhi_epi8(c, zero));
+    return _mm256_packus_epi16(lo, hi);
+}
+
+VGCPU_REF_AVX2_TARGET void AccumulateAvx2(float* cells, float* coverage, int n, bool even_odd) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    __m256 carry = _mm256_setzero_ps();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(cells + i);
+        _mm256_storeu_ps(cells + i, _mm256_setzero_ps());
+        // In-lane prefix sums, then propagate the low lane total into the high lane
+        x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 4)));
+        x = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 8)));
+        __m256 lane_totals = _mm256_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+        x = _mm256_add_ps(x, _mm256_permute2f128_ps(lane_totals, lane_totals, 0x08));
+        x = _mm256_add_ps(x, carry);
+        __m256 totals = _mm256_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+        carry = _mm256_permute2f128_ps(totals, totals, 0x11);
+
+        __m256 a = _mm256_andnot_ps(sign, x);
+        if (even_odd) {
+            __m256 t = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_mul_ps(a, half)));
+            a = _mm256_sub_ps(a, _mm256_mul_ps(t, two));
+            a = _mm256_sub_ps(one, _mm256_andnot_ps(sign, _mm256_sub_ps(one, a)));
+        } else {
+            a = _mm256_min_ps(a, one);
+        }
+        _mm256_storeu_ps(coverage + i, a);
+    }
+    float acc = _mm256_cvtss_f32(carry);
+    for (; i < n; ++i) {
+        acc += cells[i];
+        cells[i] = 0.0f;
+        coverage[i] = ApplyFillRule(acc, even_odd);
+    }
+}
+
+VGCPU_REF_AVX2_TARGET void CompositeSolidAvx2(uint32_t* dst, const float* coverage, int n,
+                                              uint32_t color) {
+    const __m256i s = _mm256_set1_epi32(static_cast<int>(color));
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i out = Blend8Avx2(d, s, CoverageBytesAvx2(coverage + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+    }
+    CompositeSolidSse2(dst + i, coverage + i, n - i, color);
+}
+
+VGCPU_REF_AVX2_TARGET void CompositeSpanAvx2(uint32_t* dst, const float* coverage,
+                                             const uint32_t* src, int n) {
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i out = Blend8Avx2(d, s, CoverageBytesAvx2(coverage + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), out);
+    }
+    CompositeSpanSse2(dst + i, coverage + i, src + i, n - i);
+}
+
+bool CpuHasAvx2() {
+#if defined(VGCPU_COMPILER_MSVC)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) {
+        return false;
+    }
+    __cpuid(regs, 1);
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx = (regs[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+#endif  // VGCPU_REF_HAS_AVX2
+
+// ============================================================================
+// NEON
+// ============================================================================
+#if defined(VGCPU_REF_NEON)
+
+inline uint16x8_t Div255Neon(uint16x8_t x) {
+    x = vaddq_u16(x, vdupq_n_u16(128));
+    return vshrq_n_u16(vaddq_u16(x, vshrq_n_u16(x, 8)), 8);
+}
+
+inline uint8x16_t CoverageBytesNeon(const float* coverage) {
+    float32x4_t cf =
+        vaddq_f32(vmulq_f32(vld1q_f32(coverage), vdupq_n_f32(255.0f)), vdupq_n_f32(0.5f));
+    uint32x4_t ci = vcvtq_u32_f32(cf);  // Truncates, matching the scalar cast
+    ci = vorrq_u32(ci, vshlq_n_u32(ci, 8));
+    ci = vorrq_u32(ci, vshlq_n_u32(ci, 16));
+    return vreinterpretq_u8_u32(ci);
+}
+
+/// Blend two pixels; `sc` and `d` are 8 x u16 lanes.
+inline uint16x8_t Blend2Neon(uint8x8_t d, uint8x8_t s, uint8x8_t c) {
+    uint16x8_t sc = Div255Neon(vmull_u8(s, c));
+    // Replicate each pixel's alpha (top u16 of each u64) across its four channels
+    uint64x2_t a = vshrq_n_u64(vreinterpretq_u64_u16(sc), 48);
+    a = vorrq_u64(a, vshlq_n_u64(a, 16));
+    a = vorrq_u64(a, vshlq_n_u64(a, 32));
+    uint16x8_t inv = vsubq_u16(vdupq_n_u16(255), vreinterpretq_u16_u64(a));
+    return vaddq_u16(sc, Div255Neon(vmulq_u16(vmovl_u8(d), inv)));
+}
+
+inline uint8x16_t Blend4Neon(uint8x16_t d, uint8x16_t s, uint8x16_t c) {
+    uint16x8_t lo = Blend2Neon(vget_low_u8(d), vget_low_u8(s), vget_low_u8(c));
+    uint16x8_t hi = Blend2Neon(vget_high_u8(d), vget_high_u8(s), vget_high_u8(c));
+    return vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi));
+}
+
+void AccumulateNeon(float* cells, float* coverage, int n, bool even_odd) {
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t carry = zero;
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        float32x4_t x = vld1q_f32(cells + i);
+        vst1q_f32(cells + i, zero);
+        x = vaddq_f32(x, vextq_f32(zero, x, 3));
+        x = vaddq_f32(x, vextq_f32(zero, x, 2));
+        x = vaddq_f32(x, carry);
+        carry = vdupq_n_f32(vgetq_lane_f32(x, 3));
+
+        float32x4_t a = vabsq_f32(x);
+        if (even_odd) {
+            float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(vmulq_n_f32(a, 0.5f)));
+            a = vsubq_f32(a, vmulq_n_f32(t, 2.0f));
+            a = vsubq_f32(one, vabsq_f32(vsubq_f32(one, a)));
+        } else {
+            a = vminq_f32(a, one);
+        }
+        vst1q_f32(coverage + i, a);
+    }
+    float acc = vgetq_lane_f32(carry, 0);
+    for (; i < n; ++i) {
+        acc += cells[i];
+        cells[i] = 0.0f;
+        coverage[i] = ApplyFillRule(acc, even_odd);
+    }
+}
+
+void CompositeSolidNeon(uint32_t* dst, const float* coverage, int n, uint32_t color) {
+    const uint8x16_t s = vreinterpretq_u8_u32(vdupq_n_u32(color));
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint8x16_t d = vld1q_u8(reinterpret_cast<const uint8_t*>(dst + i));
+        uint8x16_t out = Blend4Neon(d, s, CoverageBytesNeon(coverage + i));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), out);
+    }
+    CompositeSolidScalar(dst + i, coverage + i, n - i, color);
+}
+
+void CompositeSpanNeon(uint32_t* dst, const float* coverage, const uint32_t* src, int n) {
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        uint8x16_t d = vld1q_u8(reinterpret_cast<const uint8_t*>(dst + i));
+        uint8x16_t s = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint8x16_t out = Blend4Neon(d, s, CoverageBytesNeon(coverage + i));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), out);
+    }
+    CompositeSpanScalar(dst + i, coverage + i, src + i, n - i);
+}
+
+#endif  // VGCPU_REF_NEON
+
+Kernels MakeKernels(KernelIsa isa) {
+    Kernels k;
+    k.isa = KernelIsa::kScalar;
+    k.accumulate = AccumulateScalar;
+    k.composite_solid = CompositeSolidScalar;
+    k.composite_span = CompositeSpanScalar;
+
+    switch (isa) {
+#if defined(VGCPU_REF_X86)
+        case KernelIsa::kSse2:
+            k = {KernelIsa::kSse2, AccumulateSse2, CompositeSolidSse2, CompositeSpanSse2};
+            break;
+#endif
+#if defined(VGCPU_REF_HAS_AVX2)
+        case KernelIsa::kAvx2:
+            k = {KernelIsa::kAvx2, AccumulateAvx2, CompositeSolidAvx2, CompositeSpanAvx2};
+            break;
+#endif
+#if defined(VGCPU_REF_NEON)
+        case KernelIsa::kNeon:
+            k = {KernelIsa::kNeon, AccumulateNeon, CompositeSolidNeon, CompositeSpanNeon};
+            break;
+#endif
+        default:
+            break;
+    }
+    return k;
+}
+
+}  // namespace
+
+bool IsIsaAvailable(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::kScalar:
+            return true;
+        case KernelIsa::kSse2:
+#if defined(VGCPU_REF_X86)
+            return true;
+#else
+            return false;
+#endif
+        case KernelIsa::kAvx2:
+#if defined(VGCPU_REF_HAS_AVX2)
+        {
+            static const bool has_avx2 = CpuHasAvx2();
+            return has_avx2;
+        }
+#else
+            return false;
+#endif
+        case KernelIsa::kNeon:
+#if defined(VGCPU_REF_NEON)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+KernelIsa DetectBestIsa() {
+    for (auto isa : {KernelIsa::kAvx2, KernelIsa::kNeon, KernelIsa::kSse2}) {
+        if (IsIsaAvailable(isa)) {
+            return isa;
+        }
+    }
+    return KernelIsa::kScalar;
+}
+
+KernelIsa DetectBestIsa(pal::IsaLevel max_level) {
+    for (auto isa : {KernelIsa::kAvx2, KernelIsa::kNeon, KernelIsa::kSse2}) {
+        if (IsIsaAvailable(isa) && IsIsaWithinLevel(isa, max_level)) {
+            return isa;
+        }
+    }
+    return KernelIsa::kScalar;
+}
+
+bool IsIsaWithinLevel(KernelIsa isa, pal::IsaLevel max_level) {
+    switch (isa) {
+        case KernelIsa::kScalar:
+            return true;
+        case KernelIsa::kSse2:
+            return max_level >= pal::IsaLevel::kSse2 && max_level <= pal::IsaLevel::kAvx512;
+        case KernelIsa::kAvx2:
+            return max_level == pal::IsaLevel::kAvx2 || max_level == pal::IsaLevel::kAvx512;
+        case KernelIsa::kNeon:
+            return max_level == pal::IsaLevel::kNeon;
+    }
+    return false;
+}
+
+const Kernels& GetKernels(KernelIsa isa) {
+    static const Kernels kTables[] = {MakeKernels(KernelIsa::kScalar),
+                                      MakeKernels(KernelIsa::kSse2),
+                                      MakeKernels(KernelIsa::kAvx2),
+                                      MakeKernels(KernelIsa::kNeon)};
+    if (!IsIsaAvailable(isa)) {
+        isa = KernelIsa::kScalar;
+    }
+    return kTables[static_cast<int>(isa)];
+}
+
+const char* IsaName(KernelIsa isa) {
+    switch (isa) {
+        case KernelIsa::kScalar:
+            return "scalar";
+        case KernelIsa::kSse2:
+            return "sse2";
+        case KernelIsa::kAvx2:
+            return "avx2";
+        case KernelIsa::kNeon:
+            return "neon";
+    }
+    return "unknown";
+}
+
+}  // namespace vgcpu::ref
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#pragma once
+
+#include "pal/cpu_features.h"
+
+#include <cstdint>
+
+namespace vgcpu::ref {
+
+/// Instruction set used by the span kernels.
+enum class KernelIsa { kScalar, kSse2, kAvx2, kNeon };
+
+/// Span kernels of the reference rasterizer. All variants implement the same integer blending
+/// math, so SIMD and scalar output only differ by float rounding in the coverage prefix sum.
+struct Kernels {
+    KernelIsa isa = KernelIsa::kScalar;
+
+    /// Prefix-sum `n` accumulation cells into coverage in [0, 1] using the fill rule
+    /// (nonzero: min(|w|, 1); even-odd: triangle wave of |w|), zeroing the cells as it goes.
+    void (*accumulate)(float* cells, float* coverage, int n, bool even_odd) = nullptr;
+
+    /// Source-over blend a solid premultiplied RGBA8 color into `dst` with per-pixel coverage.
+    void (*composite_solid)(uint32_t* dst, const float* coverage, int n, uint32_t color) = nullptr;
+
+    /// Source-over blend per-pixel premultiplied RGBA8 colors into `dst` with per-pixel coverage.
+    void (*composite_span)(uint32_t* dst, const float* coverage, const uint32_t* src,
+                           int n) = nullptr;
+};
+
+/// Best instruction set supported by both the build and the running CPU.
+[[nodiscard]] KernelIsa DetectBestIsa();
+
+/// Best available instruction set that does not exceed `max_level` (AdapterArgs::max_isa).
+[[nodiscard]] KernelIsa DetectBestIsa(pal::IsaLevel max_level);
+
+/// Whether `isa` only uses instructions up to `max_level` (SSE2 kernels fit any x86 level
+/// from SSE2 up, AVX2 kernels need AVX2 or AVX-512).
+[[nodiscard]] bool IsIsaWithinLevel(KernelIsa isa, pal::IsaLevel max_level);
+
+/// Whether the kernels for `isa` can run on this build and CPU.
+[[nodiscard]] bool IsIsaAvailable(KernelIsa isa);
+
+/// Kernel table for `isa`; falls back to scalar when `isa` is unavailable.
+[[nodiscard]] const Kernels& GetKernels(KernelIsa isa);
+
+/// Short lowercase name ("scalar", "sse2", "avx2", "neon").
+[[nodiscard]] const char* IsaName(KernelIsa isa);
+
+}  // namespace vgcpu::ref
@@ -0,0 +1,500 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#include "adapters/vgcpu_ref/ref_rasterizer.h"
+
+#include "ir/prepared_scene.h"
+
+#include <cmath>
+#include <numbers>
+
+namespace vgcpu::ref {
+
+namespace {
+
+/// Upper bound on segments per curve, guards against degenerate control points.
+constexpr int kMaxCurveSegments = 100;
+
+/// Bounds on round cap/join polygon resolution.
+constexpr int kMinDiscSegments = 8;
+constexpr int kMaxDiscSegments = 256;
+
+/// Squared length below which consecutive stroke points are merged.
+constexpr float kDegenerateLengthSq = 1e-12f;
+
+/// Segment count from Wang's formula: n = sqrt(d(d-1)/8 * L / tol), where L is the largest
+/// second difference of the control polygon.
+int CurveSegments(float degree_factor, float dd, float tolerance) {
+    int n = static_cast<int>(std::ceil(std::sqrt(degree_factor * dd / tolerance)));
+    return std::clamp(n, 1, kMaxCurveSegments);
+}
+
+Point Sub(Point p, Point q) {
+    return {p.x - q.x, p.y - q.y};
+}
+
+Point Add(Point p, Point q) {
+    return {p.x + q.x, p.y + q.y};
+}
+
+Point Scale(Point p, float s) {
+    return {p.x * s, p.y * s};
+}
+
+float Cross(Point p, Point q) {
+    return p.x * q.y - p.y * q.x;
+}
+
+float Dot(Point p, Point q) {
+    return p.x * q.x + p.y * q.y;
+}
+
+Point Normalize(Point p) {
+    float len = std::sqrt(Dot(p, p));
+    return len > 0.0f ? Scale(p, 1.0f / len) : Point{};
+}
+
+/// Left normal of unit direction `u` scaled by `hw`.
+Point Normal(Point u, float hw) {
+    return {-u.y * hw, u.x * hw};
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Affine / Polygon
+// -----------------------------------------------------------------------------
+
+Affine Affine::Multiply(const Affine& m) const {
+    return {a * m.a + c * m.b,     b * m.a + d * m.b,     a * m.c + c * m.d,
+            b * m.c + d * m.d,     a * m.e + c * m.f + e, b * m.e + d * m.f + f};
+}
+
+Affine Affine::Inverse() const {
+    float det = a * d - b * c;
+    if (det == 0.0f || !std::isfinite(det)) {
+        return {};
+    }
+    float inv = 1.0f / det;
+    return {d * inv, -b * inv, -c * inv, a * inv, (c * f - d * e) * inv, (b * e - a * f) * inv};
+}
+
+float Affine::ScaleFactor() const {
+    return std::sqrt(std::abs(a * d - b * c));
+}
+
+void Polygon::EndContour(bool closed) {
+    uint32_t start = contour_ends.empty() ? 0 : contour_ends.back();
+    if (points.size() > start) {
+        contour_ends.push_back(static_cast<uint32_t>(points.size()));
+        contour_closed.push_back(closed ? 1 : 0);
+    }
+}
+
+void Polygon::Transform(const Affine& m) {
+    if (m.IsIdentity()) {
+        return;
+    }
+    for (auto& p : points) {
+        p = m.Apply(p);
+    }
+}
+
+void FlattenPath(const Path& path, const Affine& m, float tolerance, Polygon& out) {
+    const auto& pts = path.points;
+    size_t idx = 0;
+    Point cur{};
+    Point start{};
+    bool open = false;  // A contour is in progress in `out`
+
+    auto read = [&](size_t i) { return m.Apply({pts[i], pts[i + 1]}); };
+    auto begin_if_needed = [&]() {
+        if (!open) {
+            out.points.push_back(cur);
+            open = true;
+        }
+    };
+
+    for (auto verb : path.verbs) {
+        switch (verb) {
+            case ir::PathVerb::kMoveTo:
+                if (idx + 2 > pts.size())
+                    return;
+                out.EndContour(false);
+                cur = start = read(idx);
+                out.points.push_back(cur);
+                open = true;
+                idx += 2;
+                break;
+            case ir::PathVerb::kLineTo:
+                if (idx + 2 > pts.size())
+                    return;
+                begin_if_needed();
+                cur = read(idx);
+                out.points.push_back(cur);
+                idx += 2;
+                break;
+            case ir::PathVerb::kQuadTo: {
+                if (idx + 4 > pts.size())
+                    return;
+                begin_if_needed();
+                const Point p0 = cur, p1 = read(idx), p2 = read(idx + 2);
+                const float dd = std::hypot(p0.x - 2 * p1.x + p2.x, p0.y - 2 * p1.y + p2.y);
+                const int n = CurveSegments(0.25f, dd, tolerance);
+                for (int i = 1; i <= n; ++i) {
+                    const float t = static_cast<float>(i) / n, u = 1.0f - t;
+                    out.points.push_back({u * u * p0.x + 2 * u * t * p1.x + t * t * p2.x,
+                                          u * u * p0.y + 2 * u * t * p1.y + t * t * p2.y});
+                }
+                cur = p2;
+                idx += 4;
+                break;
+            }
+            case ir::PathVerb::kCubicTo: {
+                if (idx + 6 > pts.size())
+                    return;
+                begin_if_needed();
+                const Point p0 = cur, p1 = read(idx), p2 = read(idx + 2), p3 = read(idx + 4);
+                const float dd =
+                    std::max(std::hypot(p0.x - 2 * p1.x + p2.x, p0.y - 2 * p1.y + p2.y),
+                             std::hypot(p1.x - 2 * p2.x + p3.x, p1.y - 2 * p2.y + p3.y));
+                const int n = CurveSegments(0.75f, dd, tolerance);
+                for (int i = 1; i <= n; ++i) {
+                    const float t = static_cast<float>(i) / n, u = 1.0f - t;
+                    const float b0 = u * u * u, b1 = 3 * u * u * t, b2 = 3 * u * t * t,
+                                b3 = t * t * t;
+                    out.points.push_back({b0 * p0.x + b1 * p1.x + b2 * p2.x + b3 * p3.x,
+                                          b0 * p0.y + b1 * p1.y + b2 * p2.y + b3 * p3.y});
+                }
+                cur = p3;
+                idx += 6;
+                break;
+            }
+            case ir::PathVerb::kClose:
+                out.EndContour(true);
+                open = false;
+                cur = start;
+                break;
+        }
+    }
+    out.EndContour(false);
+}
+
+// -----------------------------------------------------------------------------
+// Stroker
+// -----------------------------------------------------------------------------
+
+void Stroker::Stroke(const Polygon& centerline, const StrokeStyle& style, float tolerance,
+                     Polygon& out) {
+    half_width_ = 0.5f * style.width;
+    if (!(half_width_ > 0.0f)) {
+        return;
+    }
+
+    // Circle resolution so that the chord error stays below the tolerance.
+    disc_.clear();
+    if (style.cap == ir::StrokeCap::kRound || style.join == ir::StrokeJoin::kRound) {
+        float ratio = std::clamp(1.0f - tolerance / half_width_, -1.0f, 0.9999f);
+        int n = static_cast<int>(std::ceil(std::numbers::pi_v<float> / std::acos(ratio)));
+        n = std::clamp(n, kMinDiscSegments, kMaxDiscSegments);
+        for (int i = 0; i < n; ++i) {
+            float t = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / n;
+            disc_.push_back({half_width_ * std::cos(t), half_width_ * std::sin(t)});
+        }
+    }
+
+    uint32_t begin = 0;
+    for (size_t c = 0; c < centerline.contour_ends.size(); ++c) {
+        const uint32_t end = centerline.contour_ends[c];
+        const bool closed = centerline.contour_closed[c] != 0;
+
+        // Drop repeated points (and the explicit closing point of closed contours).
+        scratch_.clear();
+        for (uint32_t i = begin; i < end; ++i) {
+            Point p = centerline.points[i];
+            if (scratch_.empty()) {
+                scratch_.push_back(p);
+            } else {
+                Point d = Sub(p, scratch_.back());
+                if (Dot(d, d) > kDegenerateLengthSq)
+                    scratch_.push_back(p);
+            }
+        }
+        begin = end;
+        if (closed && scratch_.size() > 1) {
+            Point d = Sub(scratch_.front(), scratch_.back());
+            if (Dot(d, d) <= kDegenerateLengthSq)
+                scratch_.pop_back();
+        }
+
+        const int n = static_cast<int>(scratch_.size());
+        if (n == 0) {
+            continue;
+        }
+        if (n == 1) {
+            // Zero-length subpath: only round and square caps paint anything.
+            if (style.cap != ir::StrokeCap::kButt) {
+                EmitCap(scratch_[0], {1.0f, 0.0f}, style, out);
+                EmitCap(scratch_[0], {-1.0f, 0.0f}, style, out);
+            }
+            continue;
+        }
+
+        const int segments = closed ? n : n - 1;
+        Point first_u{}, prev_u{};
+        for (int i = 0; i < segments; ++i) {
+            const Point p = scratch_[static_cast<size_t>(i)];
+            const Point q = scratch_[static_cast<size_t>((i + 1) % n)];
+            const Point u = Normalize(Sub(q, p));
+            const Point nrm = Normal(u, half_width_);
+            const Point quad[4] = {Add(p, nrm), Add(q, nrm), Sub(q, nrm), Sub(p, nrm)};
+            EmitConvex(quad, 4, out);
+            if (i == 0) {
+                first_u = u;
+            } else {
+                EmitJoin(p, prev_u, u, style, out);
+            }
+            prev_u = u;
+        }
+
+        if (closed) {
+            EmitJoin(scratch_[0], prev_u, first_u, style, out);
+        } else {
+            EmitCap(scratch_[0], Scale(first_u, -1.0f), style, out);
+            EmitCap(scratch_[static_cast<size_t>(n - 1)], prev_u, style, out);
+        }
+    }
+}
+
+void Stroker::EmitConvex(const Point* pts, int count, Polygon& out) {
+    float area = 0.0f;
+    for (int i = 0; i < count; ++i) {
+        area += Cross(pts[i], pts[(i + 1) % count]);
+    }
+    if (area == 0.0f) {
+        return;
+    }
+    // All pieces share one orientation so overlaps accumulate instead of cancelling.
+    if (area > 0.0f) {
+        for (int i = 0; i < count; ++i)
+            out.points.push_back(pts[i]);
+    } else {
+        for (int i = count - 1; i >= 0; --i)
+            out.points.push_back(pts[i]);
+    }
+    out.EndContour(true);
+}
+
+void Stroker::EmitDisc(Point center, Polygon& out) {
+    for (const auto& p : disc_) {
+        out.points.push_back(Add(center, p));
+    }
+    out.EndContour(true);
+}
+
+void Stroker::EmitJoin(Point p, Point u0, Point u1, const StrokeStyle& style, Polygon& out) {
+    const float cross = Cross(u0, u1);
+    const float dot = Dot(u0, u1);
+    if (std::abs(cross) < 1e-6f && dot > 0.0f) {
+        return;  // Collinear, the segment bodies already meet
+    }
+    if (style.join == ir::StrokeJoin::kRound) {
+        EmitDisc(p, out);
+        return;
+    }
+
+    // The gap opens on the side opposite to the turn direction.
+    const float side = cross > 0.0f ? -1.0f : 1.0f;
+    const Point a = Add(p, Scale(Normal(u0, half_width_), side));
+    const Point b = Add(p, Scale(Normal(u1, half_width_), side));
+
+    if (style.join == ir::StrokeJoin::kMiter) {
+        const float cos_half = std::sqrt(std::max(0.0f, 0.5f * (1.0f + dot)));
+        if (cos_half > 0.0f && 1.0f / cos_half <= style.miter_limit) {
+            const Point dir = Normalize(Add(Sub(a, p), Sub(b, p)));
+            const Point tip = Add(p, Scale(dir, half_width_ / cos_half));
+            const Point quad[4] = {p, a, tip, b};
+            EmitConvex(quad, 4, out);
+            return;
+        }
+    }
+    const Point tri[3] = {p, a, b};
+    EmitConvex(tri, 3, out);
+}
+
+void Stroker::EmitCap(Point p, Point u, const StrokeStyle& style, Polygon& out) {
+    switch (style.cap) {
+        case ir::StrokeCap::kButt:
+            break;
+        case ir::StrokeCap::kRound:
+            EmitDisc(p, out);
+            break;
+        case ir::StrokeCap::kSquare: {
+            const Point nrm = Normal(u, half_width_);
+            const Point ext = Scale(u, half_width_);
+            const Point quad[4] = {Add(p, nrm), Add(Add(p, nrm), ext), Add(Sub(p, nrm), ext),
+                                   Sub(p, nrm)};
+            EmitConvex(quad, 4, out);
+            break;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Rasterizer
+// -----------------------------------------------------------------------------
+
+void Rasterizer::Reset(int width, int height) {
+    width_ = std::max(width, 0);
+    height_ = std::max(height, 0);
+    cell_stride_ = width_ + 2;
+
+    // Cells are zeroed by every Sweep, so growing is the only time they need initializing.
+    const size_t cell_count = static_cast<size_t>(cell_stride_) * static_cast<size_t>(height_);
+    if (cells_.size() < cell_count) {
+        cells_.assign(cell_count, 0.0f);
+    }
+    if (coverage_.size() < static_cast<size_t>(cell_stride_)) {
+        coverage_.resize(static_cast<size_t>(cell_stride_));
+    }
+    row_min_.assign(static_cast<size_t>(height_), cell_stride_);
+    row_max_.assign(static_cast<size_t>(height_), 0);
+    dirty_y0_ = height_;
+    dirty_y1_ = 0;
+}
+
+void Rasterizer::AddPolygon(const Polygon& poly) {
+    uint32_t begin = 0;
+    for (uint32_t end : poly.contour_ends) {
+        if (end - begin >= 2) {
+            for (uint32_t i = begin; i + 1 < end; ++i) {
+                AddLine(poly.points[i], poly.points[i + 1]);
+            }
+            AddLine(poly.points[end - 1], poly.points[begin]);
+        }
+        begin = end;
+    }
+}
+
+void Rasterizer::AddLine(Point p0, Point p1) {
+    const float h = static_cast<float>(height_);
+    if (p0.y == p1.y || (p0.y <= 0.0f && p1.y <= 0.0f) || (p0.y >= h && p1.y >= h)) {
+        return;  // Horizontal or fully above/below the surface
+    }
+    if (!std::isfinite(p0.x) || !std::isfinite(p0.y) || !std::isfinite(p1.x) ||
+        !std::isfinite(p1.y)) {
+        return;
+    }
+
+    // Clip vertically: rows outside the surface are never swept.
+    auto clip_y = [&](Point& p, const Point& q, float y) {
+        p.x = p.x + (q.x - p.x) * (y - p.y) / (q.y - p.y);
+        p.y = y;
+    };
+    if (p0.y < 0.0f)
+        clip_y(p0, p1, 0.0f);
+    else if (p0.y > h)
+        clip_y(p0, p1, h);
+    if (p1.y < 0.0f)
+        clip_y(p1, p0, 0.0f);
+    else if (p1.y > h)
+        clip_y(p1, p0, h);
+
+    // Split at the left and right surface edges; pieces outside are projected onto the edge,
+    // which preserves the winding contribution of everything to their right.
+    const float w = static_cast<float>(width_);
+    const float bounds[2] = {0.0f, w};
+    Point pieces[4] = {p0};
+    int count = 1;
+    for (float bx : bounds) {
+        if ((p0.x < bx && p1.x > bx) || (p0.x > bx && p1.x < bx)) {
+            const float t = (bx - p0.x) / (p1.x - p0.x);
+            pieces[count++] = {bx, p0.y + (p1.y - p0.y) * t};
+        }
+    }
+    // Intersections are ordered along the segment by their parameter.
+    if (count == 3 && ((pieces[1].x > pieces[2].x) != (p0.x > p1.x))) {
+        std::swap(pieces[1], pieces[2]);
+    }
+    pieces[count++] = p1;
+
+    for (int i = 0; i + 1 < count; ++i) {
+        Point a = pieces[i];
+        Point b = pieces[i + 1];
+        a.x = std::clamp(a.x, 0.0f, w);
+        b.x = std::clamp(b.x, 0.0f, w);
+        DrawLine(a, b);
+    }
+}
+
+void Rasterizer::DrawLine(Point p0, Point p1) {
+    if (p0.y == p1.y) {
+        return;
+    }
+    float dir = 1.0f;
+    if (p0.y > p1.y) {
+        std::swap(p0, p1);
+        dir = -1.0f;
+    }
+
+    const float w = static_cast<float>(width_);
+    const float dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+    const int y_begin = static_cast<int>(p0.y);
+    const int y_end = std::min(height_, static_cast<int>(std::ceil(p1.y)));
+    dirty_y0_ = std::min(dirty_y0_, y_begin);
+    dirty_y1_ = std::max(dirty_y1_, y_end);
+
+    float x = p0.x;
+    for (int y = y_begin; y < y_end; ++y) {
+        float* row = cells_.data() + static_cast<size_t>(y) * cell_stride_;
+        const float dy =
+            std::min(static_cast<float>(y + 1), p1.y) - std::max(static_cast<float>(y), p0.y);
+        // Clamp so float drift never steps outside the guard cells.
+        const float x_next = std::clamp(x + dxdy * dy, 0.0f, w);
+        const float d = dy * dir;
+        const float x0 = std::min(x, x_next);
+        const float x1 = std::max(x, x_next);
+        const float x0_floor = std::floor(x0);
+        const int x0i = static_cast<int>(x0_floor);
+        const float x1_ceil = std::ceil(x1);
+        const int x1i = static_cast<int>(x1_ceil);
+        int& row_min = row_min_[static_cast<size_t>(y)];
+        int& row_max = row_max_[static_cast<size_t>(y)];
+        row_min = std::min(row_min, x0i);
+
+        if (x1i <= x0i + 1) {
+            // Edge stays within one pixel column: split the area at the mid x.
+            const float xmf = 0.5f * (x + x_next) - x0_floor;
+            row[x0i] += d - d * xmf;
+            row[x0i + 1] += d * xmf;
+            row_max = std::max(row_max, x0i + 2);
+        } else {
+            // Edge crosses several columns: trapezoid areas, constant in the middle.
+            const float s = 1.0f / (x1 - x0);
+            const float x0f = x0 - x0_floor;
+            const float a0 = 0.5f * s * (1.0f - x0f) * (1.0f - x0f);
+            const float x1f = x1 - x1_ceil + 1.0f;
+            const float am = 0.5f * s * x1f * x1f;
+            row[x0i] += d * a0;
+            if (x1i == x0i + 2) {
+                row[x0i + 1] += d * (1.0f - a0 - am);
+            } else {
+                const float a1 = s * (1.5f - x0f);
+                row[x0i + 1] += d * (a1 - a0);
+                for (int xi = x0i + 2; xi < x1i - 1; ++xi) {
+                    row[xi] += d * s;
+                }
+                const float a2 = a1 + static_cast<float>(x1i - x0i - 3) * s;
+                row[x1i - 1] += d * (1.0f - a2 - am);
+            }
+            row[x1i] += d * am;
+            row_max = std::max(row_max, x1i + 1);
+        }
+        x = x_next;
+    }
+}
+
+}  // namespace vgcpu::ref
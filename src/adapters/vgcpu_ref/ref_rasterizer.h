@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-07] Backend Adapters (Chapter 3) / [API-06-05] vgcpu_ref backend
+// (Chapter 4)
+
+#pragma once
+
+#include "adapters/vgcpu_ref/ref_kernels.h"
+#include "ir/ir_format.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace vgcpu {
+
+struct Path;
+
+namespace ref {
+
+struct Point {
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+/// Affine transform in IR layout: x' = a*x + c*y + e, y' = b*x + d*y + f.
+struct Affine {
+    float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f, e = 0.0f, f = 0.0f;
+
+    [[nodiscard]] Point Apply(Point p) const {
+        return {a * p.x + c * p.y + e, b * p.x + d * p.y + f};
+    }
+
+    /// Canvas-style concatenation: the result maps points through `m` first, then `*this`.
+    [[nodiscard]] Affine Multiply(const Affine& m) const;
+
+    /// Inverse transform; returns identity for singular matrices.
+    [[nodiscard]] Affine Inverse() const;
+
+    /// Average linear scale factor (sqrt |det|), used to size tolerances and stroke widths.
+    [[nodiscard]] float ScaleFactor() const;
+
+    [[nodiscard]] bool IsIdentity() const {
+        return a == 1.0f && b == 0.0f && c == 0.0f && d == 1.0f && e == 0.0f && f == 0.0f;
+    }
+};
+
+/// Flattened contours (polylines). Storage is reused across calls.
+struct Polygon {
+    std::vector<Point> points;
+    std::vector<uint32_t> contour_ends;  ///< Exclusive end index into `points` per contour
+    std::vector<uint8_t> contour_closed;
+
+    void Clear() {
+        points.clear();
+        contour_ends.clear();
+        contour_closed.clear();
+    }
+
+    /// Terminate the current contour (no-op when it is empty).
+    void EndContour(bool closed);
+
+    void Transform(const Affine& m);
+};
+
+/// Flatten an IR path into `out`, transforming by `m` before subdivision so that `tolerance`
+/// is measured in the output space.
+void FlattenPath(const Path& path, const Affine& m, float tolerance, Polygon& out);
+
+/// Stroke parameters (user space).
+struct StrokeStyle {
+    float width = 1.0f;
+    ir::StrokeCap cap = ir::StrokeCap::kButt;
+    ir::StrokeJoin join = ir::StrokeJoin::kMiter;
+    float miter_limit = 4.0f;  ///< SVG default
+};
+
+/// Polygonal stroker: emits every segment body, join and cap as a separate convex polygon with
+/// consistent orientation, so the union is rendered correctly with the nonzero rule.
+class Stroker {
+   public:
+    /// Stroke the contours of `centerline` into `out` (appends).
+    void Stroke(const Polygon& centerline, const StrokeStyle& style, float tolerance,
+                Polygon& out);
+
+   private:
+    void EmitConvex(const Point* pts, int count, Polygon& out);
+    void EmitDisc(Point center, Polygon& out);
+    void EmitJoin(Point p, Point u0, Point u1, const StrokeStyle& style, Polygon& out);
+    void EmitCap(Point p, Point u, const StrokeStyle& style, Polygon& out);
+
+    float half_width_ = 0.5f;
+    std::vector<Point> disc_;  ///< Unit circle for the current half width
+    std::vector<Point> scratch_;
+};
+
+/// Sparse-scanline analytic coverage rasterizer.
+/// Edges accumulate signed area into a per-row cell buffer; each touched row is then resolved
+/// with a SIMD prefix sum over only the cells between its leftmost and rightmost edge.
+class Rasterizer {
+   public:
+    /// Size the cell buffers for a `width` x `height` surface (allocates only when growing).
+    void Reset(int width, int height);
+
+    /// Add all contours of a device-space polygon (contours are implicitly closed).
+    void AddPolygon(const Polygon& poly);
+
+    /// Resolve touched rows into coverage and call `span(y, x, coverage, count)` for each.
+    /// Leaves the rasterizer empty for the next path.
+    template <typename SpanFn>
+    void Sweep(const Kernels& kernels, bool even_odd, SpanFn&& span) {
+        for (int y = dirty_y0_; y < dirty_y1_; ++y) {
+            int x0 = row_min_[static_cast<size_t>(y)];
+            int x1 = row_max_[static_cast<size_t>(y)];
+            if (x0 >= x1) {
+                continue;
+            }
+            row_min_[static_cast<size_t>(y)] = cell_stride_;
+            row_max_[static_cast<size_t>(y)] = 0;
+
+            float* cells = cells_.data() + static_cast<size_t>(y) * cell_stride_;
+            kernels.accumulate(cells + x0, coverage_.data(), x1 - x0, even_odd);
+            int count = std::min(x1, width_) - x0;
+            if (count > 0) {
+                span(y, x0, coverage_.data(), count);
+            }
+        }
+        dirty_y0_ = height_;
+        dirty_y1_ = 0;
+    }
+
+   private:
+    void AddLine(Point p0, Point p1);
+    void DrawLine(Point p0, Point p1);
+
+    int width_ = 0;
+    int height_ = 0;
+    int cell_stride_ = 0;  ///< width + 2 guard cells for the accumulation spill
+    std::vector<float> cells_;
+    std::vector<float> coverage_;
+    std::vector<int> row_min_;
+    std::vector<int> row_max_;
+    int dirty_y0_ = 0;
+    int dirty_y1_ = 0;
+};
+
+}  // namespace ref
+}  // namespace vgcpu
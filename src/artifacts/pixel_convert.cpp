@@ -0,0 +1,224 @@
+#include "vgcpu/artifacts/pixel_convert.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define VGCPU_CONVERT_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define VGCPU_CONVERT_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace vgcpu::artifacts {
+
+namespace {
+
+/// What a conversion does to each pixel, derived from the two formats.
+struct Plan {
+    bool swap_rb = false;
+    bool premultiply = false;
+    bool unpremultiply = false;
+};
+
+Plan MakePlan(PixelFormat src, PixelFormat dst) {
+    Plan plan;
+    plan.swap_rb = IsBgr(src) != IsBgr(dst);
+    plan.premultiply = !IsPremultiplied(src) && IsPremultiplied(dst);
+    plan.unpremultiply = IsPremultiplied(src) && !IsPremultiplied(dst);
+    return plan;
+}
+
+bool ValidSizes(std::span<const uint8_t> src, std::span<uint8_t> dst) {
+    return src.size() % 4 == 0 && dst.size() >= src.size();
+}
+
+/// round(c * a / 255) for c, a in [0, 255].
+inline uint32_t MulDiv255(uint32_t c, uint32_t a) {
+    const uint32_t t = c * a + 128;
+    return (t + (t >> 8)) >> 8;
+}
+
+/// round(c * 255 / a), clamped to 255; 0 for a == 0.
+inline uint32_t Unpremul(uint32_t c, uint32_t a) {
+    return a == 0 ? 0 : std::min<uint32_t>(255, (c * 255 + a / 2) / a);
+}
+
+void ConvertScalar(const uint8_t* src, uint8_t* dst, size_t count, const Plan& plan) {
+    for (size_t i = 0; i < count; ++i, src += 4, dst += 4) {
+        uint32_t c0 = src[0], c1 = src[1], c2 = src[2];
+        const uint32_t a = src[3];
+        if (plan.swap_rb) {
+            std::swap(c0, c2);
+        }
+        if (plan.premultiply) {
+            c0 = MulDiv255(c0, a);
+            c1 = MulDiv255(c1, a);
+            c2 = MulDiv255(c2, a);
+        } else if (plan.unpremultiply) {
+            c0 = Unpremul(c0, a);
+            c1 = Unpremul(c1, a);
+            c2 = Unpremul(c2, a);
+        }
+        dst[0] = static_cast<uint8_t>(c0);
+        dst[1] = static_cast<uint8_t>(c1);
+        dst[2] = static_cast<uint8_t>(c2);
+        dst[3] = static_cast<uint8_t>(a);
+    }
+}
+
+// The vector paths treat each pixel as a little-endian 32-bit word (channel 0 in the low byte)
+// and convert four pixels per iteration. Unpremultiplying divides in single precision: the
+// quotient c * 255 / a is correctly rounded and never lands within an ulp of a .5 boundary, so
+// adding 0.5 and truncating matches the scalar integer rounding exactly.
+
+#if defined(VGCPU_CONVERT_SSE2)
+
+size_t ConvertSimd(const uint8_t* src, uint8_t* dst, size_t count, const Plan& plan) {
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i ga_mask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i round = _mm_set1_epi32(128);
+    const __m128 k255 = _mm_set1_ps(255.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+        if (plan.swap_rb) {
+            const __m128i c0 = _mm_and_si128(p, byte_mask);
+            const __m128i c2 = _mm_and_si128(_mm_srli_epi32(p, 16), byte_mask);
+            p = _mm_or_si128(_mm_and_si128(p, ga_mask),
+                             _mm_or_si128(_mm_slli_epi32(c0, 16), c2));
+        }
+        if (plan.premultiply || plan.unpremultiply) {
+            __m128i c0 = _mm_and_si128(p, byte_mask);
+            __m128i c1 = _mm_and_si128(_mm_srli_epi32(p, 8), byte_mask);
+            __m128i c2 = _mm_and_si128(_mm_srli_epi32(p, 16), byte_mask);
+            const __m128i a = _mm_srli_epi32(p, 24);
+            if (plan.premultiply) {
+                // Products fit in the low 16 bits of each 32-bit lane.
+                auto mul = [&](__m128i c) {
+                    const __m128i t = _mm_add_epi32(_mm_mullo_epi16(c, a), round);
+                    return _mm_srli_epi32(_mm_add_epi32(t, _mm_srli_epi32(t, 8)), 8);
+                };
+                c0 = mul(c0);
+                c1 = mul(c1);
+                c2 = mul(c2);
+            } else {
+                const __m128 af = _mm_cvtepi32_ps(a);
+                const __m128i nonzero =
+                    _mm_castps_si128(_mm_cmpneq_ps(af, _mm_setzero_ps()));
+                auto div = [&](__m128i c) {
+                    __m128 q = _mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(c), k255), af);
+                    q = _mm_min_ps(_mm_add_ps(q, half), k255);  // NaN (0/0) becomes 255
+                    return _mm_and_si128(_mm_cvttps_epi32(q), nonzero);
+                };
+                c0 = div(c0);
+                c1 = div(c1);
+                c2 = div(c2);
+            }
+            p = _mm_or_si128(_mm_or_si128(c0, _mm_slli_epi32(c1, 8)),
+                             _mm_or_si128(_mm_slli_epi32(c2, 16), _mm_slli_epi32(a, 24)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), p);
+    }
+    return i;
+}
+
+#elif defined(VGCPU_CONVERT_NEON)
+
+size_t ConvertSimd(const uint8_t* src, uint8_t* dst, size_t count, const Plan& plan) {
+    const uint32x4_t byte_mask = vdupq_n_u32(0xFF);
+    const uint32x4_t ga_mask = vdupq_n_u32(0xFF00FF00u);
+    const uint32x4_t round = vdupq_n_u32(128);
+    const float32x4_t k255 = vdupq_n_f32(255.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32x4_t p = vreinterpretq_u32_u8(vld1q_u8(src + i * 4));
+        if (plan.swap_rb) {
+            const uint32x4_t c0 = vandq_u32(p, byte_mask);
+            const uint32x4_t c2 = vandq_u32(vshrq_n_u32(p, 16), byte_mask);
+            p = vorrq_u32(vandq_u32(p, ga_mask), vorrq_u32(vshlq_n_u32(c0, 16), c2));
+        }
+        if (plan.premultiply || plan.unpremultiply) {
+            uint32x4_t c0 = vandq_u32(p, byte_mask);
+            uint32x4_t c1 = vandq_u32(vshrq_n_u32(p, 8), byte_mask);
+            uint32x4_t c2 = vandq_u32(vshrq_n_u32(p, 16), byte_mask);
+            const uint32x4_t a = vshrq_n_u32(p, 24);
+            if (plan.premultiply) {
+                auto mul = [&](uint32x4_t c) {
+                    const uint32x4_t t = vaddq_u32(vmulq_u32(c, a), round);
+                    return vshrq_n_u32(vaddq_u32(t, vshrq_n_u32(t, 8)), 8);
+                };
+                c0 = mul(c0);
+                c1 = mul(c1);
+                c2 = mul(c2);
+            } else {
+                const float32x4_t af = vcvtq_f32_u32(a);
+                const uint32x4_t nonzero = vtstq_u32(a, a);
+                auto div = [&](uint32x4_t c) {
+                    float32x4_t q = vdivq_f32(vmulq_f32(vcvtq_f32_u32(c), k255), af);
+                    q = vminq_f32(vaddq_f32(q, half), k255);
+                    return vandq_u32(vcvtq_u32_f32(q), nonzero);
+                };
+                c0 = div(c0);
+                c1 = div(c1);
+                c2 = div(c2);
+            }
+            p = vorrq_u32(vorrq_u32(c0, vshlq_n_u32(c1, 8)),
+                          vorrq_u32(vshlq_n_u32(c2, 16), vshlq_n_u32(a, 24)));
+        }
+        vst1q_u8(dst + i * 4, vreinterpretq_u8_u32(p));
+    }
+    return i;
+}
+
+#endif
+
+}  // namespace
+
+bool convert_pixels(std::span<const uint8_t> src, PixelFormat src_format, std::span<uint8_t> dst,
+                    PixelFormat dst_format) {
+    if (!ValidSizes(src, dst)) {
+        return false;
+    }
+    const Plan plan = MakePlan(src_format, dst_format);
+    const size_t count = src.size() / 4;
+    if (!plan.swap_rb && !plan.premultiply && !plan.unpremultiply) {
+        if (src.data() != dst.data()) {
+            std::memcpy(dst.data(), src.data(), src.size());
+        }
+        return true;
+    }
+
+    size_t done = 0;
+#if defined(VGCPU_CONVERT_SSE2) || defined(VGCPU_CONVERT_NEON)
+    done = ConvertSimd(src.data(), dst.data(), count, plan);
+#endif
+    ConvertScalar(src.data() + done * 4, dst.data() + done * 4, count - done, plan);
+    return true;
+}
+
+bool convert_pixels_scalar(std::span<const uint8_t> src, PixelFormat src_format,
+                           std::span<uint8_t> dst, PixelFormat dst_format) {
+    if (!ValidSizes(src, dst)) {
+        return false;
+    }
+    ConvertScalar(src.data(), dst.data(), src.size() / 4, MakePlan(src_format, dst_format));
+    return true;
+}
+
+const char* convert_pixels_isa() {
+#if defined(VGCPU_CONVERT_SSE2)
+    return "sse2";
+#elif defined(VGCPU_CONVERT_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace vgcpu::artifacts
@@ -5,6 +5,10 @@
 
 #include "cli/cli_parser.h"
 
+#include "pal/affinity.h"
+#include "pal/memory.h"
+
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <sstream>
@@ -25,6 +29,28 @@ std::vector<std::string> SplitString(const std::string& s, char delimiter) {
     return tokens;
 }
 
+/// "n" -> 1, 2, 4, ... below n, then n; "a,b,c" -> that list (1 is added if missing, as every
+/// speedup is measured against it).
+std::vector<int> ParseThreadSweep(const std::string& s) {
+    std::vector<int> counts;
+    const auto tokens = SplitString(s, ',');
+    if (tokens.size() == 1) {
+        const int max_threads = std::stoi(tokens[0]);
+        for (int t = 1; t < max_threads; t *= 2) {
+            counts.push_back(t);
+        }
+        counts.push_back(std::max(1, max_threads));
+        return counts;
+    }
+    for (const auto& token : tokens) {
+        counts.push_back(std::stoi(token));
+    }
+    if (std::find(counts.begin(), counts.end(), 1) == counts.end()) {
+        counts.insert(counts.begin(), 1);
+    }
+    return counts;
+}
+
 }  // namespace
 
 void CliParser::PrintVersion() {
@@ -46,17 +72,58 @@ void CliParser::PrintHelp() {
     std::cout << "  --scene <id,...>       Select scenes (comma-separated)\n";
     std::cout << "  --all-backends         Include all available backends\n";
     std::cout << "  --all-scenes           Include all available scenes\n";
-    std::cout << "  --warmup-iters <n>     Warmup iterations (default: 3)\n";
+    std::cout << "  --variants             Also run quality/speed variants (e.g. cairo:aa=fast)\n";
+    std::cout << "  --isa <list|all>       Run capped at each SIMD level (e.g. native,sse2)\n";
+    std::cout << "  --warmup-iters <n|auto>\n";
+    std::cout << "                         Warmup iterations (default: 3); auto warms until\n";
+    std::cout << "                         frame times stop trending down (at least 3)\n";
+    std::cout << "  --max-warmup <n>       Auto warmup cap (default: 200)\n";
     std::cout << "  --iters <n>            Measurement iterations (default: 10)\n";
-    std::cout << "  --repetitions <n>      Run repetitions (default: 1)\n";
+    std::cout << "  --target-ci <frac>     Sample until the median's 95% CI is within +-frac\n";
+    std::cout << "                         (--iters becomes the minimum)\n";
+    std::cout << "  --max-iters <n>        Adaptive sampling cap (default: 1000)\n";
+    std::cout << "  --time-budget <sec>    Adaptive sampling time cap per case (default: 10)\n";
+    std::cout << "  --repetitions <n>      Runs per case on fresh backend instances (default: 1)\n";
     std::cout << "  --threads <n>          Thread count (default: 1)\n";
+    std::cout << "  --thread-sweep <n|list>\n";
+    std::cout << "                         Run parallel backends at 1, 2, 4, ... n threads (or a\n";
+    std::cout << "                         list, e.g. 1,3,6) and fit their speedup curves\n";
+    std::cout << "  --batch <n|auto>       Frames timed per sample (default: 1)\n";
+    std::cout << "  --pipeline-depth <k>   Also measure throughput with k frames in flight\n";
+    std::cout << "  --instances <n|cores>  Also render on n instances at once, one per core\n";
+    std::cout << "  --instance-time <sec>  Multi-instance rendering time (default: 2)\n";
+    std::cout << "  --jobs <n|auto>        Run n cases at once, each on its own core set\n";
+    std::cout << "  --cores-per-job <k>    Cores per job (default: largest thread count)\n";
+    std::cout << "  --isolate <case|backend>\n";
+    std::cout << "                         Run each case or backend in a forked child process\n";
+    std::cout << "  --case-timeout <sec>   Fail isolated cases that run longer (default: none)\n";
+    std::cout << "  --pin-cpu <id>         Pin the measuring thread to one CPU (OS numbering)\n";
+    std::cout << "  --worker-cpus <list>   Confine backend worker threads to CPUs (e.g. 2-5,8)\n";
+    std::cout << "  --sched-fifo <prio>    Run under SCHED_FIFO at prio (needs CAP_SYS_NICE)\n";
+    std::cout << "  --mlock                Lock the process memory in RAM (mlockall)\n";
+    std::cout << "  --prefault             Touch scene and output buffer pages before warmup\n";
+    std::cout << "  --isolate-strokes      Also time each backend's stroker and fill-only raster\n";
+    std::cout << "  --flatten <px>         Also time scenes with curves pre-flattened to <px>\n";
+    std::cout << "  --rotate-buffers <k>   Also time frames cold over k scene/buffer copies\n";
+    std::cout << "  --evict-llc            Also time frames cold, LLC evicted before each\n";
+    std::cout << "  --pad-stride           Pad output rows to dodge power-of-two strides\n";
+    std::cout << "  --surface-align <a>    Output buffer alignment: cacheline, page or bytes\n";
+    std::cout << "  --huge-pages <thp|hugetlb>\n";
+    std::cout << "                         Back output buffers with transparent or reserved\n";
+    std::cout << "                         huge pages (Linux)\n";
+    std::cout << "  --numa-local           Bind output buffers to the measuring CPU's NUMA node\n";
     std::cout << "  --out <path>           Output directory (default: .)\n";
     std::cout << "  --format <type>        Output format: json, csv, both (default: json)\n";
+    std::cout << "  --samples              Also write every raw sample to samples.vgcs (binary)\n";
+    std::cout << "  --sample-counters      Record page faults and context switches per sample\n";
     std::cout << "  --fail-fast            Stop on first failure\n";
+    std::cout << "  --strict-env           Refuse to run on a noisy machine (governor, turbo...)\n";
     std::cout << "  --png                  Save rendered images to output directory\n";
     std::cout << "  --compare-ssim         Compare result with golden images\n";
     std::cout << "  --golden-dir <path>    Golden image directory (default: assets/golden)\n";
+    std::cout << "  --baseline <id>        Report times net of a baseline backend (e.g. decode)\n";
     std::cout << "\nGeneral Options:\n";
+    std::cout << "  --plugin-dir <path>    Backend plugin directory (default: <exe dir>/plugins)\n";
     std::cout << "  --help, -h             Print this help message\n";
     std::cout << "  --version, -v          Print version\n";
 }
@@ -103,20 +170,113 @@ std::optional<CliOptions> CliParser::Parse(int argc, char* argv[]) {
             options.all_backends = true;
         } else if (arg == "--all-scenes") {
             options.all_scenes = true;
+        } else if (arg == "--variants") {
+            options.sweep_variants = true;
+        } else if (arg == "--isa" && i + 1 < argc) {
+            options.isa_levels = SplitString(argv[++i], ',');
         } else if (arg == "--warmup-iters" && i + 1 < argc) {
-            options.warmup_iters = std::stoi(argv[++i]);
+            const std::string value = argv[++i];
+            options.auto_warmup = value == "auto";
+            if (!options.auto_warmup) {
+                options.warmup_iters = std::stoi(value);
+            }
+        } else if (arg == "--max-warmup" && i + 1 < argc) {
+            options.max_warmup_iters = std::stoi(argv[++i]);
         } else if (arg == "--iters" && i + 1 < argc) {
             options.measurement_iters = std::stoi(argv[++i]);
+        } else if (arg == "--target-ci" && i + 1 < argc) {
+            options.target_ci = std::stod(argv[++i]);
+        } else if (arg == "--max-iters" && i + 1 < argc) {
+            options.max_iters = std::stoi(argv[++i]);
+        } else if (arg == "--time-budget" && i + 1 < argc) {
+            options.time_budget_s = std::stod(argv[++i]);
         } else if (arg == "--repetitions" && i + 1 < argc) {
             options.repetitions = std::stoi(argv[++i]);
         } else if (arg == "--threads" && i + 1 < argc) {
             options.threads = std::stoi(argv[++i]);
+        } else if (arg == "--thread-sweep" && i + 1 < argc) {
+            options.thread_sweep = ParseThreadSweep(argv[++i]);
+        } else if (arg == "--batch" && i + 1 < argc) {
+            const std::string value = argv[++i];
+            options.batch_frames = value == "auto" ? 0 : std::stoi(value);
+        } else if (arg == "--pipeline-depth" && i + 1 < argc) {
+            options.pipeline_depth = std::stoi(argv[++i]);
+        } else if (arg == "--instances" && i + 1 < argc) {
+            const std::string value = argv[++i];
+            options.instances = value == "cores" ? pal::GetAvailableCpuCount() : std::stoi(value);
+        } else if (arg == "--instance-time" && i + 1 < argc) {
+            options.instance_time_s = std::stod(argv[++i]);
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            const std::string value = argv[++i];
+            options.jobs = value == "auto" ? 0 : std::stoi(value);
+        } else if (arg == "--cores-per-job" && i + 1 < argc) {
+            options.cores_per_job = std::stoi(argv[++i]);
+        } else if (arg == "--isolate" && i + 1 < argc) {
+            options.isolation = argv[++i];
+            if (options.isolation != "case" && options.isolation != "backend") {
+                std::cerr << "Unknown isolation mode: " << options.isolation << "\n";
+                return std::nullopt;
+            }
+        } else if (arg == "--case-timeout" && i + 1 < argc) {
+            options.case_timeout_s = std::stod(argv[++i]);
+        } else if (arg == "--pin-cpu" && i + 1 < argc) {
+            options.pin_cpu = std::stoi(argv[++i]);
+        } else if (arg == "--worker-cpus" && i + 1 < argc) {
+            auto cpus = pal::ParseCpuList(argv[++i]);
+            if (!cpus) {
+                std::cerr << "Invalid CPU list: " << argv[i] << "\n";
+                return std::nullopt;
+            }
+            options.worker_cpus = *cpus;
+        } else if (arg == "--sched-fifo" && i + 1 < argc) {
+            options.fifo_priority = std::stoi(argv[++i]);
+        } else if (arg == "--mlock") {
+            options.lock_memory = true;
+        } else if (arg == "--prefault") {
+            options.prefault = true;
+        } else if (arg == "--isolate-strokes") {
+            options.isolate_strokes = true;
+        } else if (arg == "--flatten" && i + 1 < argc) {
+            options.flatten_tolerance = std::stof(argv[++i]);
+        } else if (arg == "--rotate-buffers" && i + 1 < argc) {
+            options.rotate_buffers = std::stoi(argv[++i]);
+        } else if (arg == "--evict-llc") {
+            options.evict_llc = true;
+        } else if (arg == "--pad-stride") {
+            options.pad_stride = true;
+        } else if (arg == "--surface-align" && i + 1 < argc) {
+            const std::string align = argv[++i];
+            if (align == "cacheline") {
+                options.surface_align = 64;
+            } else if (align == "page") {
+                options.surface_align = pal::GetPageSize();
+            } else {
+                options.surface_align = std::stoul(align);
+            }
+            if ((options.surface_align & (options.surface_align - 1)) != 0) {
+                std::cerr << "Alignment must be a power of two: " << align << "\n";
+                return std::nullopt;
+            }
+        } else if (arg == "--huge-pages" && i + 1 < argc) {
+            options.huge_pages = argv[++i];
+            if (options.huge_pages != "thp" && options.huge_pages != "hugetlb") {
+                std::cerr << "Unknown huge page mode: " << options.huge_pages << "\n";
+                return std::nullopt;
+            }
+        } else if (arg == "--numa-local") {
+            options.numa_local = true;
         } else if ((arg == "--out" || arg == "--output-dir") && i + 1 < argc) {
             options.output_dir = argv[++i];
         } else if (arg == "--format" && i + 1 < argc) {
             options.format = argv[++i];
+        } else if (arg == "--samples") {
+            options.write_samples = true;
+        } else if (arg == "--sample-counters") {
+            options.sample_counters = true;
         } else if (arg == "--fail-fast") {
             options.fail_fast = true;
+        } else if (arg == "--strict-env") {
+            options.strict_env = true;
         } else if (arg == "--timer" || arg == "--validate-timer") {
             options.validate_timer = true;
         } else if (arg == "--png") {
@@ -125,6 +285,10 @@ std::optional<CliOptions> CliParser::Parse(int argc, char* argv[]) {
             options.compare_ssim = true;
         } else if (arg == "--golden-dir" && i + 1 < argc) {
             options.golden_dir = argv[++i];
+        } else if (arg == "--baseline" && i + 1 < argc) {
+            options.baseline = argv[++i];
+        } else if (arg == "--plugin-dir" && i + 1 < argc) {
+            options.plugin_dir = argv[++i];
         } else if (arg == "--help" || arg == "-h") {
             options.help = true;
         } else {
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -30,27 +31,61 @@ struct CliOptions {
     // Selection
     std::vector<std::string> backends;
     std::vector<std::string> scenes;
+    std::vector<std::string> isa_levels;  // SIMD caps to sweep ("native", "avx2", ..., "all")
     bool all_backends = false;
     bool all_scenes = false;
+    bool sweep_variants = false;  // Also run registered quality/speed variants of each backend
 
     // Benchmark policy
-    int warmup_iters = 3;
-    int measurement_iters = 10;
+    int warmup_iters = 3;         // Fixed warmup count; the minimum when auto
+    bool auto_warmup = false;     // Warm until frame times settle (--warmup-iters auto)
+    int max_warmup_iters = 200;   // Auto warmup cap
+    int measurement_iters = 10;   // Fixed sample count; the minimum when adaptive
+    double target_ci = 0.0;       // Adaptive stop: median 95% CI half-width / p50; 0 = off
+    int max_iters = 1000;         // Adaptive: sample cap
+    double time_budget_s = 10.0;  // Adaptive: measured-loop time cap per case
     int repetitions = 1;
     int threads = 1;
+    std::vector<int> thread_sweep;  // Thread counts to sweep (--thread-sweep); empty = --threads
+    int batch_frames = 1;            // Frames per timed sample; 0 = auto
+    int pipeline_depth = 0;          // Frames in flight in throughput mode; 0 = off
+    int instances = 0;               // Concurrent instances, one per core; 0 = off
+    double instance_time_s = 2.0;    // Multi-instance rendering time
+    int jobs = 1;                    // Cases run at once on disjoint core sets; 0 = auto
+    int cores_per_job = 0;           // CPUs per job; 0 = the largest thread count
+    std::string isolation;           // Forked child per "case" or "backend"; empty = in-process
+    double case_timeout_s = 0.0;     // Isolation: per-case time limit; 0 = none
+    int pin_cpu = -1;                // OS CPU of the measuring thread; -1 = not pinned
+    std::vector<int> worker_cpus;    // OS CPUs for backend worker threads; empty = any
+    int fifo_priority = 0;           // SCHED_FIFO priority; 0 = normal scheduling
+    bool lock_memory = false;        // mlockall before running
+    bool prefault = false;           // Touch scene and output pages before warmup
+    bool isolate_strokes = false;    // Time strokers separately from fill rasterization
+    bool sample_counters = false;    // Record page faults/context switches per sample
+    float flatten_tolerance = 0.0f;  // Also time pre-flattened curves (px); 0 = off
+    int rotate_buffers = 0;          // Cold mode: scene copies/buffers rotated; 0 = off
+    bool evict_llc = false;          // Cold mode: evict the LLC before every frame
+    bool pad_stride = false;         // Pad output rows off power-of-two strides
+    size_t surface_align = 0;        // Output buffer alignment in bytes; 0 = allocator default
+    std::string huge_pages;          // Output buffer pages: "thp" or "hugetlb"; empty = base
+    bool numa_local = false;         // Bind output buffers to the measuring thread's node
 
     // Output
     std::string output_dir = ".";
     std::string format = "json";  // json, csv, both
+    bool write_samples = false;   // Also write raw samples to samples.vgcs
     bool print_summary = true;
 
     // Flags
     bool fail_fast = false;
+    bool strict_env = false;  // Refuse to run when DetectNoiseSources reports anything
     bool help = false;
     bool validate_timer = false;
     bool generate_png = false;
     bool compare_ssim = false;
     std::string golden_dir = "assets/golden";
+    std::string baseline;    // Backend subtracted from all others (e.g. "decode"); empty = off
+    std::string plugin_dir;  // Backend plugin directory; empty = "plugins" next to the executable
 };
 
 /// CLI argument parser.
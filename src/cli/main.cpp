@@ -4,24 +4,42 @@
 // Blueprint Reference: [ARCH-10-01] CLI Frontend (Chapter 3)
 
 #include "adapters/adapter_registry.h"
+#include "adapters/plugin_loader.h"
+#include "adapters/tiled/tiled_adapter.h"
 #include "assets/scene_registry.h"
 #include "cli/cli_parser.h"
 #include "harness/harness.h"
+#include "harness/isolation.h"
+#include "harness/scheduler.h"
 #include "ir/ir_loader.h"
+#include "pal/affinity.h"
+#include "pal/cpu_features.h"
 #include "pal/environment.h"
+#include "pal/memory.h"
+#include "pal/realtime.h"
 #include "pal/timer.h"
 #include "reporting/reporter.h"
 #include "vgcpu/internal/log.h"
 #include "vgcpu/internal/version.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 
 // Force linking of adapter implementations
 #ifdef VGCPU_ENABLE_NULL_BACKEND
 #include "adapters/null/null_adapter.h"
 #endif
 
+#ifdef VGCPU_ENABLE_DECODE_BACKEND
+#include "adapters/decode/decode_adapter.h"
+#endif
+
+#ifdef VGCPU_ENABLE_VGCPU_REF
+#include "adapters/vgcpu_ref/ref_adapter.h"
+#endif
+
 #ifdef VGCPU_ENABLE_PLUTOVG
 #include "adapters/plutovg/plutovg_adapter.h"
 #endif
@@ -80,6 +98,70 @@ void InitSceneRegistry() {
     }
 }
 
+/// Resolve --isa into the caps to run each backend under (nullopt = uncapped). "all" expands to
+/// native followed by every lower level the CPU supports. Returns nullopt on an unknown level or
+/// one this CPU lacks.
+std::optional<std::vector<std::optional<pal::IsaLevel>>> ResolveIsaCaps(
+    const std::vector<std::string>& names) {
+    std::vector<std::optional<pal::IsaLevel>> caps;
+    if (names.empty()) {
+        caps.emplace_back();
+        return caps;
+    }
+    for (const auto& name : names) {
+        if (name == "native") {
+            caps.emplace_back();
+        } else if (name == "all") {
+            caps.emplace_back();
+            const pal::IsaLevel highest = pal::HighestIsaLevel();
+            for (auto level : {pal::IsaLevel::kAvx2, pal::IsaLevel::kSse42, pal::IsaLevel::kSse2,
+                               pal::IsaLevel::kScalar}) {
+                if (level < highest && pal::IsIsaLevelAvailable(level)) {
+                    caps.emplace_back(level);
+                }
+            }
+        } else {
+            auto level = pal::ParseIsaLevel(name);
+            if (!level) {
+                VGCPU_LOG_ERROR("Unknown ISA level '" + name + "'");
+                return std::nullopt;
+            }
+            if (!pal::IsIsaLevelAvailable(*level)) {
+                VGCPU_LOG_ERROR("ISA level '" + name + "' is not available on this CPU");
+                return std::nullopt;
+            }
+            caps.emplace_back(level);
+        }
+    }
+    return caps;
+}
+
+/// Load the backend plugins a command needs. A run naming its backends loads only their plugins
+/// (plus the baseline's), so it pays no startup, RSS or i-cache cost for the others; list,
+/// metadata and --all-backends load every plugin in the directory.
+void LoadPlugins(const CliOptions& options, const std::filesystem::path& dir) {
+    std::vector<std::string> ids;
+    if (options.command == CliCommand::kRun && !options.all_backends && !options.backends.empty()) {
+        ids = options.backends;
+        if (!options.baseline.empty()) {
+            ids.push_back(options.baseline);
+        }
+        for (auto& id : ids) {
+            id = id.substr(0, id.find(kVariantSeparator));  // Variants live in the base's plugin
+        }
+    } else {
+        ids = DiscoverPlugins(dir);
+    }
+
+    for (const auto& id : ids) {
+        auto status = LoadBackendPlugin(dir, id);
+        // Unknown ids without a plugin are reported by the run itself
+        if (status.failed() && status.code != StatusCode::kNotFound) {
+            VGCPU_LOG_WARN("Failed to load backend plugin '" + id + "': " + status.message);
+        }
+    }
+}
+
 /// Handle the 'list' command.
 /// Blueprint Reference: [API-01-01] CLI list subcommand (Chapter 4) / [ARCH-13-01] (Chapter 3)
 int HandleList(const CliOptions& options) {
@@ -88,6 +170,9 @@ int HandleList(const CliOptions& options) {
     auto& registry = AdapterRegistry::Instance();
     for (const auto& id : registry.GetAdapterIds()) {
         std::cout << "  - " << id << "\n";
+        for (const auto& variant_id : registry.GetVariantIds(id)) {
+            std::cout << "      " << variant_id << "\n";
+        }
     }
     std::cout << "\nAvailable Scenes:\n";
     std::cout << "  - test/simple_rect (built-in test scene)\n";
@@ -115,9 +200,29 @@ int HandleMetadata(const CliOptions& options) {
     std::cout << "  OS:        " << env.os_name << " " << env.os_version << "\n";
     std::cout << "  Arch:      " << env.arch << "\n";
     std::cout << "  CPU:       " << env.cpu_model << "\n";
+    std::cout << "  ISA:       " << env.isa_level << " (";
+    for (size_t i = 0; i < env.cpu_features.size(); ++i) {
+        std::cout << (i > 0 ? " " : "") << env.cpu_features[i];
+    }
+    std::cout << ")\n";
     std::cout << "  Cores:     " << env.cpu_cores << "\n";
     std::cout << "  Memory:    " << (env.memory_bytes / (1024 * 1024)) << " MB\n";
     std::cout << "  Compiler:  " << env.compiler_name << " " << env.compiler_version << "\n";
+    std::cout << "  Governor:  " << (env.cpu_governor.empty() ? "unknown" : env.cpu_governor)
+              << "\n";
+    std::cout << "  Turbo:     " << (env.turbo.empty() ? "unknown" : env.turbo) << "\n";
+    std::cout << "  SMT:       " << (env.smt.empty() ? "unknown" : env.smt) << "\n";
+    std::cout << "  Isolated:  " << (env.isolated_cpus.empty() ? "none" : env.isolated_cpus)
+              << " (nohz_full: " << (env.nohz_full_cpus.empty() ? "none" : env.nohz_full_cpus)
+              << ")\n";
+    std::cout << "  THP:       " << (env.thp_mode.empty() ? "unknown" : env.thp_mode) << "\n";
+    std::cout << "  ASLR:      " << (env.aslr < 0 ? "unknown" : std::to_string(env.aslr)) << "\n";
+    std::cout << "  Load avg:  " << env.load_average_1m << "\n";
+    std::cout << "  Noise:     ";
+    for (size_t i = 0; i < env.noise.size(); ++i) {
+        std::cout << (i > 0 ? " " : "") << env.noise[i];
+    }
+    std::cout << (env.noise.empty() ? "none\n" : "\n");
     std::cout << "  CPU Time:  " << pal::GetCpuTimeSemantics() << "\n";
     std::cout << "  CPU Freq:  " << (pal::GetCpuFrequency() / 1'000'000.0) << " MHz (est)\n";
     std::cout << "\nBuild Info:\n";
@@ -171,6 +276,16 @@ int HandleValidate(const CliOptions& options) {
 int HandleRun(const CliOptions& options) {
     auto& registry = AdapterRegistry::Instance();
 
+    // Preflight: collected before any load of our own, and reported with the results
+    const auto environment = pal::CollectEnvironment();
+    for (const auto& source : environment.noise) {
+        VGCPU_LOG_WARN("Noisy environment: " + source);
+    }
+    if (options.strict_env && !environment.noise.empty()) {
+        VGCPU_LOG_ERROR("Refusing to run in a noisy environment (--strict-env)");
+        return 1;
+    }
+
     // Determine backends to use
     std::vector<std::string> backend_ids;
     if (options.all_backends || options.backends.empty()) {
@@ -179,6 +294,40 @@ int HandleRun(const CliOptions& options) {
         backend_ids = options.backends;
     }
 
+    // Expand each selected backend into its speed/quality variant matrix
+    if (options.sweep_variants) {
+        std::vector<std::string> expanded;
+        for (const auto& id : backend_ids) {
+            expanded.push_back(id);
+            for (const auto& variant_id : registry.GetVariantIds(id)) {
+                if (std::find(backend_ids.begin(), backend_ids.end(), variant_id) ==
+                    backend_ids.end()) {
+                    expanded.push_back(variant_id);
+                }
+            }
+        }
+        backend_ids = std::move(expanded);
+    }
+
+    // Tiled variants are compared against their inner backend run serially
+    for (size_t i = 0; i < backend_ids.size(); ++i) {
+        const std::string inner_id = TiledAdapter::InnerIdOf(backend_ids[i]);
+        if (!inner_id.empty() &&
+            std::find(backend_ids.begin(), backend_ids.end(), inner_id) == backend_ids.end()) {
+            backend_ids.push_back(inner_id);
+        }
+    }
+
+    // The baseline backend runs first so its timings can be subtracted from the others
+    if (!options.baseline.empty()) {
+        if (!registry.HasAdapter(options.baseline)) {
+            VGCPU_LOG_ERROR("Baseline backend '" + options.baseline + "' not found");
+            return 1;
+        }
+        std::erase(backend_ids, options.baseline);
+        backend_ids.insert(backend_ids.begin(), options.baseline);
+    }
+
     if (backend_ids.empty()) {
         VGCPU_LOG_ERROR("No backends available");
         return 1;
@@ -265,16 +414,132 @@ int HandleRun(const CliOptions& options) {
         scenes.push_back(ir::IrLoader::CreateTestScene(800, 600));
     }
 
+    const auto isa_caps = ResolveIsaCaps(options.isa_levels);
+    if (!isa_caps) {
+        return 1;
+    }
+
     // Setup benchmark policy
     BenchmarkPolicy policy;
     policy.warmup_iterations = options.warmup_iters;
+    policy.auto_warmup = options.auto_warmup;
+    policy.max_warmup_iterations = options.max_warmup_iters;
     policy.measurement_iterations = options.measurement_iters;
+    policy.target_ci = options.target_ci;
+    policy.max_iterations = options.max_iters;
+    policy.time_budget_s = options.time_budget_s;
     policy.repetitions = options.repetitions;
     policy.thread_count = options.threads;
+    policy.batch_frames = options.batch_frames;
+    policy.pipeline_depth = options.pipeline_depth;
+    policy.instances = options.instances;
+    policy.instance_time_s = options.instance_time_s;
+    policy.isolate_strokes = options.isolate_strokes;
+    policy.sample_counters = options.sample_counters;
+    policy.flatten_tolerance = options.flatten_tolerance;
+    policy.rotate_buffers = options.rotate_buffers;
+    policy.evict_llc = options.evict_llc;
     policy.generate_png = options.generate_png;
     policy.compare_ssim = options.compare_ssim;
     policy.golden_dir = options.golden_dir;
     policy.output_dir = options.output_dir.empty() ? "." : options.output_dir;
+    policy.baseline_backend = options.baseline;
+
+    // Parallel orchestration: bounded slots on disjoint core sets, each wide enough for the
+    // largest thread count a case runs with
+    int max_threads = std::max(1, policy.thread_count);
+    for (const int threads : options.thread_sweep) {
+        max_threads = std::max(max_threads, threads);
+    }
+    const int cpus = pal::GetAvailableCpuCount();
+    const std::vector<int> allowed_cpus = pal::GetAllowedCpus();
+    policy.cores_per_job = options.cores_per_job > 0 ? options.cores_per_job : max_threads;
+    policy.jobs = options.jobs > 0 ? options.jobs : std::max(1, cpus / policy.cores_per_job);
+    if (policy.jobs > 1 && policy.jobs * policy.cores_per_job > cpus) {
+        policy.jobs = std::max(1, cpus / policy.cores_per_job);
+        VGCPU_LOG_WARN("Only " + std::to_string(cpus) + " CPUs available, running " +
+                       std::to_string(policy.jobs) + " jobs of " +
+                       std::to_string(policy.cores_per_job) + " cores");
+    }
+    policy.isolation = options.isolation;
+    policy.case_timeout_s = options.case_timeout_s;
+    if (!policy.isolation.empty() && policy.jobs > 1) {
+        VGCPU_LOG_WARN("--isolate forks from a single-threaded orchestrator; ignored with --jobs");
+        policy.isolation.clear();
+    }
+    if (!policy.isolation.empty() && !IsolatedRunner::IsSupported()) {
+        VGCPU_LOG_WARN("Process isolation is not supported on this platform; running in-process");
+        policy.isolation.clear();
+    }
+    if (policy.jobs > 1 && policy.instances > 0) {
+        VGCPU_LOG_WARN("--instances pins across all cores and is ignored with --jobs");
+        policy.instances = 0;
+    }
+
+    // Execution controls. Whatever the OS refuses is dropped with a warning, so the report
+    // records what was applied; worker threads inherit the scheduling policy.
+    policy.orchestrator_cpu = options.pin_cpu;
+    policy.worker_cpus = options.worker_cpus;
+    policy.fifo_priority = options.fifo_priority;
+    policy.lock_memory = options.lock_memory;
+    policy.prefault = options.prefault;
+    if (policy.jobs > 1 && (policy.orchestrator_cpu >= 0 || !policy.worker_cpus.empty())) {
+        VGCPU_LOG_WARN("--pin-cpu and --worker-cpus are ignored with --jobs, which pins its slots");
+        policy.orchestrator_cpu = -1;
+        policy.worker_cpus.clear();
+    }
+    if (policy.orchestrator_cpu >= 0 && !pal::PinCurrentThreadToCpus({policy.orchestrator_cpu})) {
+        VGCPU_LOG_WARN("Cannot pin to CPU " + std::to_string(policy.orchestrator_cpu) +
+                       ", not pinning");
+        policy.orchestrator_cpu = -1;
+    }
+    if (policy.orchestrator_cpu >= 0 && policy.worker_cpus.empty()) {
+        policy.worker_cpus = allowed_cpus;  // Workers keep the CPUs the process started with
+    }
+    if (!policy.worker_cpus.empty() && !pal::PinCurrentThreadToCpus(policy.worker_cpus)) {
+        VGCPU_LOG_WARN("Cannot confine worker threads to the requested CPUs, not pinning");
+        policy.orchestrator_cpu = -1;
+        policy.worker_cpus.clear();
+        pal::PinCurrentThreadToCpus(allowed_cpus);
+    }
+    if (policy.fifo_priority > 0) {
+        auto status = pal::SetRealtimePriority(policy.fifo_priority);
+        if (status.failed()) {
+            VGCPU_LOG_WARN(status.message + ", using normal scheduling");
+            policy.fifo_priority = 0;
+        }
+    }
+    if (policy.lock_memory) {
+        auto status = pal::LockProcessMemory();
+        if (status.failed()) {
+            VGCPU_LOG_WARN(status.message + ", memory not locked");
+            policy.lock_memory = false;
+        }
+    }
+
+    // Output buffer layout and backing. Huge pages and NUMA binding are probed once here, so an
+    // unavailable setting falls back to base pages instead of failing every case.
+    policy.pad_stride = options.pad_stride;
+    auto& memory = policy.surface_memory;
+    memory.alignment = options.surface_align;
+    if (options.huge_pages == "thp") {
+        memory.huge_pages = pal::HugePages::kTransparent;
+    } else if (options.huge_pages == "hugetlb") {
+        memory.huge_pages = pal::HugePages::kExplicit;
+    }
+    if (options.numa_local) {
+        memory.numa = pal::NumaPlacement::kLocal;
+    }
+    if (memory.huge_pages != pal::HugePages::kOff || memory.numa == pal::NumaPlacement::kLocal) {
+        auto status = pal::ProbeMemoryPolicy(memory);
+        if (status.failed()) {
+            VGCPU_LOG_WARN("Huge pages/NUMA binding unavailable (" + status.message +
+                           "), using base pages");
+            memory.huge_pages = pal::HugePages::kOff;
+            memory.numa = pal::NumaPlacement::kFirstTouch;
+        }
+    }
+    std::vector<CaseSpec> scheduled;
 
     // Run benchmarks
     std::vector<CaseResult> results;
@@ -286,29 +551,150 @@ int HandleRun(const CliOptions& options) {
             continue;
         }
 
-        AdapterArgs args;
-        args.thread_count = policy.thread_count;
-        auto status = adapter->Initialize(args);
-        if (status.failed()) {
-            VGCPU_LOG_WARN("Failed to initialize '" + backend_id + "': " + status.message);
-            continue;
+        // Thread counts to run: the sweep, or --threads alone. A backend that serves as serial
+        // reference for its tiled variant runs single-threaded.
+        BenchmarkPolicy backend_policy = policy;
+        std::vector<int> thread_counts = options.thread_sweep;
+        if (thread_counts.empty()) {
+            thread_counts.push_back(policy.thread_count);
         }
+        const std::string tiled_id = AdapterRegistry::MakeVariantId(backend_id, kTiledParams);
+        if (std::find(backend_ids.begin(), backend_ids.end(), tiled_id) != backend_ids.end()) {
+            thread_counts = {1};
+        }
+
+        // Each ISA cap and thread count re-initializes the backend so its dispatch and worker
+        // pool are chosen for them
+        for (const auto& max_isa : *isa_caps) {
+            for (const int threads : thread_counts) {
+                backend_policy.max_isa = max_isa;
+                backend_policy.thread_count = threads;
+                AdapterArgs args;
+                args.thread_count = threads;
+                args.max_isa = max_isa;
+
+                // A sweep runs serial-only backends once, as a 1-thread reference
+                // (capabilities do not depend on initialization)
+                if (threads > 1 && !options.thread_sweep.empty() &&
+                    !adapter->GetCapabilities().supports_parallel_render) {
+                    continue;
+                }
+
+                // Scheduled runs: slots create and initialize their own instances
+                if (policy.jobs > 1) {
+                    for (const auto& scene : scenes) {
+                        scheduled.push_back({backend_id, args, backend_policy, &scene});
+                    }
+                    continue;
+                }
+
+                auto factory = [&registry, &backend_id] {
+                    return registry.CreateAdapter(backend_id);
+                };
+
+                // Scenes [first, last) on this configuration, each emitted when done. One
+                // instance runs them all, except that repetitions each get a fresh instance so
+                // allocator and cache state start over.
+                auto run_scenes = [&](size_t first, size_t last, const IsolatedRunner::Emit& emit) {
+                    const bool shared = backend_policy.repetitions <= 1;
+                    if (shared) {
+                        auto status =
+                            Harness::InitializeAdapter(*adapter, args, backend_policy);
+                        if (status.failed()) {
+                            VGCPU_LOG_WARN(
+                                "Failed to initialize '" + backend_id + "'" +
+                                (max_isa ? std::string(" at ") + pal::IsaLevelName(*max_isa)
+                                         : "") +
+                                ": " + status.message);
+                            return;
+                        }
+                    }
+                    for (size_t i = first; i < last; ++i) {
+                        auto result =
+                            shared ? Harness::RunCase(*adapter, scenes[i], backend_policy)
+                                   : Harness::RunRepeated(factory, args, scenes[i], backend_policy);
+
+                        // Multi-instance throughput of an executed case, against its 1-instance
+                        // time. Instances pin themselves within the worker CPUs.
+                        if (backend_policy.instances > 0 &&
+                            result.decision == CaseDecision::kExecute) {
+                            if (backend_policy.orchestrator_cpu >= 0) {
+                                pal::PinCurrentThreadToCpus(backend_policy.worker_cpus);
+                            }
+                            auto multi =
+                                Harness::RunInstances(factory, args, {&scenes[i]}, backend_policy,
+                                                      result.stats.wall_p50_ns);
+                            if (backend_policy.orchestrator_cpu >= 0) {
+                                pal::PinCurrentThreadToCpus({backend_policy.orchestrator_cpu});
+                            }
+                            if (multi.ok()) {
+                                result.multi_instance = multi.value();
+                            } else {
+                                result.reasons.push_back("MULTI_INSTANCE_FAILED:" +
+                                                         multi.status().message);
+                            }
+                        }
+                        emit(result);
+                    }
+                    if (shared) {
+                        adapter->Shutdown();
+                    }
+                };
+
+                if (policy.isolation.empty()) {
+                    run_scenes(0, scenes.size(),
+                               [&](const CaseResult& result) { results.push_back(result); });
+                    continue;
+                }
 
-        // Run each scene on this backend
-        for (const auto& scene : scenes) {
-            auto result = Harness::RunCase(*adapter, scene, policy);
-            results.push_back(result);
+                // Process isolation: a forked child per configuration, or per case
+                std::vector<CaseResult> expected;
+                for (const auto& scene : scenes) {
+                    expected.push_back(Harness::FailedCase(backend_id, scene, backend_policy, ""));
+                }
+                std::vector<CaseResult> isolated;
+                if (policy.isolation == "case") {
+                    for (size_t i = 0; i < scenes.size(); ++i) {
+                        auto one = IsolatedRunner::Run(
+                            {expected[i]},
+                            [&](size_t first, const IsolatedRunner::Emit& emit) {
+                                run_scenes(i + first, i + 1, emit);
+                            },
+                            policy.case_timeout_s);
+                        isolated.insert(isolated.end(), one.begin(), one.end());
+                    }
+                } else {
+                    isolated = IsolatedRunner::Run(
+                        expected,
+                        [&](size_t first, const IsolatedRunner::Emit& emit) {
+                            run_scenes(first, scenes.size(), emit);
+                        },
+                        policy.case_timeout_s);
+                }
+                results.insert(results.end(), isolated.begin(), isolated.end());
+            }
         }
+    }
+
+    if (!scheduled.empty()) {
+        VGCPU_LOG_INFO("Running " + std::to_string(scheduled.size()) + " cases in " +
+                       std::to_string(policy.jobs) + " jobs of " +
+                       std::to_string(policy.cores_per_job) + " cores");
+        auto factory = [&registry](const std::string& id) { return registry.CreateAdapter(id); };
+        results = CaseScheduler::Run(scheduled, factory, {policy.jobs, policy.cores_per_job});
+    }
 
-        adapter->Shutdown();
+    if (!policy.baseline_backend.empty()) {
+        Harness::ApplyBaseline(results, policy.baseline_backend);
     }
+    Harness::ApplyScaling(results);
 
     // Prepare metadata
     RunMetadata metadata;
     metadata.run_timestamp = pal::GetTimestamp();
     metadata.suite_version = VGCPU_VERSION_STRING;
     metadata.git_commit = VGCPU_GIT_COMMIT;
-    metadata.environment = pal::CollectEnvironment();
+    metadata.environment = environment;
     metadata.policy = policy;
 
     // Print summary
@@ -336,6 +722,15 @@ int HandleRun(const CliOptions& options) {
             VGCPU_LOG_ERROR("Error writing CSV: " + status.message);
         }
     }
+    if (options.write_samples) {
+        auto samples_path = out_dir / "samples.vgcs";
+        auto status = SampleWriter::Write(samples_path, results);
+        if (status.ok()) {
+            VGCPU_LOG_INFO("Sample output: " + samples_path.string());
+        } else {
+            VGCPU_LOG_ERROR("Error writing samples: " + status.message);
+        }
+    }
 
     return 0;
 }
@@ -348,6 +743,14 @@ int main(int argc, char* argv[]) {
     RegisterNullAdapter();
 #endif
 
+#ifdef VGCPU_ENABLE_DECODE_BACKEND
+    RegisterDecodeAdapter();
+#endif
+
+#ifdef VGCPU_ENABLE_VGCPU_REF
+    RegisterVgcpuRefAdapter();
+#endif
+
 #ifdef VGCPU_ENABLE_PLUTOVG
     RegisterPlutoVGAdapter();
 #endif
@@ -400,6 +803,15 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    // Backends built as plugins (VGCPU_BACKEND_PLUGINS) are loaded on demand
+    const std::filesystem::path plugin_dir =
+        options->plugin_dir.empty() ? std::filesystem::path(argv[0]).parent_path() / "plugins"
+                                    : std::filesystem::path(options->plugin_dir);
+    LoadPlugins(*options, plugin_dir);
+
+    // Tile-parallel wrappers of every single-threaded backend registered above
+    RegisterTiledVariants();
+
     switch (options->command) {
         case CliCommand::kHelp:
             CliParser::PrintHelp();
@@ -43,6 +43,18 @@ struct CapabilitySet {
     // Concurrency [REQ-35]
     bool supports_parallel_render = false;
 
+    // Pipelined frame submission (IBackendAdapter::SubmitFrame/WaitFrame overridden)
+    bool supports_async_submit = false;
+
+    // Runtime SIMD dispatch can be capped below the CPU's level (AdapterArgs::max_isa)
+    bool supports_isa_cap = false;
+
+    // kSetMatrix/kConcatMatrix/kSave/kRestore are applied (TiledAdapter's band translate needs it)
+    bool supports_transforms = false;
+
+    // Rows can be padded (SurfaceConfig::stride wider than width * 4)
+    bool supports_surface_stride = false;
+
     /// Create a CapabilitySet with all features enabled.
     static CapabilitySet All() { return {}; }
 
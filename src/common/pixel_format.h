@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-02] Common Types (Chapter 3)
+
+#pragma once
+
+#include <cstdint>
+
+namespace vgcpu {
+
+/// 32-bit pixel layouts, named by byte order in memory.
+/// Blueprint Reference: [API-06-05] SurfaceDesc (Chapter 4)
+enum class PixelFormat : uint8_t {
+    kRgba8Premul = 0,  ///< R,G,B,A bytes, premultiplied alpha (Skia, AGG, Vello, vgcpu_ref)
+    kBgra8Premul = 1,  ///< B,G,R,A bytes, premultiplied alpha (little-endian ARGB32 words)
+    kRgba8 = 2,        ///< R,G,B,A bytes, straight alpha (PNG artifacts, golden images)
+    kBgra8 = 3,        ///< B,G,R,A bytes, straight alpha
+};
+
+/// Stable lowercase name used in reports (e.g. "bgra8_premul").
+[[nodiscard]] inline const char* PixelFormatName(PixelFormat format) {
+    switch (format) {
+        case PixelFormat::kRgba8Premul:
+            return "rgba8_premul";
+        case PixelFormat::kBgra8Premul:
+            return "bgra8_premul";
+        case PixelFormat::kRgba8:
+            return "rgba8";
+        case PixelFormat::kBgra8:
+            return "bgra8";
+    }
+    return "unknown";
+}
+
+/// True if the red and blue bytes are swapped relative to RGBA.
+[[nodiscard]] constexpr bool IsBgr(PixelFormat format) {
+    return format == PixelFormat::kBgra8Premul || format == PixelFormat::kBgra8;
+}
+
+/// True if color channels are premultiplied by alpha.
+[[nodiscard]] constexpr bool IsPremultiplied(PixelFormat format) {
+    return format == PixelFormat::kRgba8Premul || format == PixelFormat::kBgra8Premul;
+}
+
+}  // namespace vgcpu
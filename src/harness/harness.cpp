@@ -6,20 +6,526 @@
 
 #include "harness/harness.h"
 
+#include "adapters/tiled/tiled_adapter.h"
+#include "adapters/transform_stack.h"
 #include "harness/statistics.h"
+#include "ir/path_flattener.h"
+#include "pal/affinity.h"
+#include "pal/cpu_features.h"
+#include "pal/memory.h"
+#include "pal/realtime.h"
 #include "pal/timer.h"
 #include "vgcpu/artifacts/naming.hpp"
+#include "vgcpu/artifacts/pixel_convert.hpp"
 #include "vgcpu/artifacts/png_reader.hpp"
 #include "vgcpu/artifacts/png_writer.hpp"
 #include "vgcpu/artifacts/ssim_compare.hpp"
 #include "vgcpu/internal/log.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
 #include <filesystem>
 #include <mutex>
+#include <new>
+#include <optional>
+#include <span>
+#include <thread>
 
 namespace vgcpu {
 
+namespace {
+
+/// Fault in the pages the measured loop will touch: the output buffer and the scene's command
+/// stream, paths and gradient stops (BenchmarkPolicy::prefault).
+void PrefaultScene(const PreparedScene& scene, SurfaceBuffer& buffer) {
+    pal::PrefaultWritable(buffer.data(), buffer.size());
+    pal::PrefaultReadable(scene.command_stream.data(), scene.command_stream.size());
+    for (const auto& path : scene.paths) {
+        pal::PrefaultReadable(path.verbs.data(), path.verbs.size() * sizeof(path.verbs[0]));
+        pal::PrefaultReadable(path.points.data(), path.points.size() * sizeof(path.points[0]));
+    }
+    for (const auto& paint : scene.paints) {
+        pal::PrefaultReadable(paint.stops.data(), paint.stops.size() * sizeof(paint.stops[0]));
+    }
+}
+
+/// Zero-filled output buffer for one frame of `config` under `memory`, so its pages are first
+/// touched by the calling thread.
+/// @return Fail if the allocator refuses (e.g. the hugetlbfs pool ran out).
+Result<SurfaceBuffer> AllocateSurface(const SurfaceConfig& config,
+                                      const pal::MemoryPolicy& memory) {
+    try {
+        return SurfaceBuffer(static_cast<size_t>(SurfaceStride(config)) * config.height,
+                             pal::SurfaceAllocator<uint8_t>(memory));
+    } catch (const std::bad_alloc&) {
+        return Status::Fail("Cannot allocate the output buffer under the surface memory policy");
+    }
+}
+
+/// Double the batch size until one untimed batch lasts kAutoBatchTargetNs.
+Result<int> CalibrateBatchFrames(IBackendAdapter& adapter, const PreparedScene& scene,
+                                 const SurfaceConfig& config, SurfaceBuffer& buffer) {
+    int frames = 1;
+    for (;;) {
+        auto start = pal::NowMonotonic();
+        auto status = adapter.RenderBatch(scene, config, buffer, frames);
+        auto elapsed_ns = pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic()));
+        if (status.failed()) {
+            return status;
+        }
+        if (elapsed_ns >= kAutoBatchTargetNs || frames >= kMaxAutoBatchFrames) {
+            return frames;
+        }
+        frames *= 2;
+    }
+}
+
+/// Auto-warmup settle test on the frame times so far: settled unless the newest kWarmupWindow
+/// frames are both significantly trending down (Mann-Kendall over the last two windows) and
+/// more than kWarmupSettleTolerance faster in median than the window before them.
+bool WarmupSettled(const std::vector<int64_t>& frame_ns) {
+    const auto window = static_cast<size_t>(kWarmupWindow);
+    if (frame_ns.size() < 2 * window) {
+        return false;
+    }
+    const std::vector<int64_t> recent(frame_ns.end() - static_cast<ptrdiff_t>(2 * window),
+                                      frame_ns.end());
+    std::vector<int64_t> older(recent.begin(), recent.begin() + static_cast<ptrdiff_t>(window));
+    std::vector<int64_t> newer(recent.begin() + static_cast<ptrdiff_t>(window), recent.end());
+    std::sort(older.begin(), older.end());
+    std::sort(newer.begin(), newer.end());
+    const auto older_median = static_cast<double>(ComputePercentile(older, 50.0));
+    const auto newer_median = static_cast<double>(ComputePercentile(newer, 50.0));
+    const bool faster = older_median > 0.0 &&
+                        (older_median - newer_median) / older_median > kWarmupSettleTolerance;
+    return !(faster && MannKendallZ(recent) <= -kZ95);
+}
+
+/// Frames rendered by the warmup phase.
+struct WarmupOutcome {
+    int frames = 0;
+    int64_t first_frame_ns = 0;
+    bool settled = true;  // False if auto warmup hit max_warmup_iterations first
+};
+
+/// Warmup loop: policy.warmup_iterations frames, or with auto_warmup at least that many and
+/// then until WarmupSettled(), capped at max_warmup_iterations. Frames are timed for the settle
+/// test and the first-frame time only; none of them reach the reported statistics.
+/// Blueprint Reference: [ARCH-13-02a] Warmup loop (Chapter 3)
+Result<WarmupOutcome> RunWarmup(IBackendAdapter& adapter, const PreparedScene& scene,
+                                const SurfaceConfig& config, SurfaceBuffer& buffer,
+                                const BenchmarkPolicy& policy) {
+    const int min_frames = std::max(0, policy.warmup_iterations);
+    const int max_frames =
+        policy.auto_warmup ? std::max(min_frames, policy.max_warmup_iterations) : min_frames;
+    std::vector<int64_t> frame_ns;
+    frame_ns.reserve(static_cast<size_t>(policy.auto_warmup ? 2 * kWarmupWindow : min_frames));
+
+    WarmupOutcome outcome;
+    outcome.settled = !policy.auto_warmup;
+    while (outcome.frames < max_frames) {
+        auto start = pal::NowMonotonic();
+        auto status = adapter.Render(scene, config, buffer);
+        auto elapsed_ns = pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic()));
+        if (status.failed()) {
+            return status;
+        }
+        frame_ns.push_back(elapsed_ns);
+        ++outcome.frames;
+        if (policy.auto_warmup && outcome.frames >= min_frames && WarmupSettled(frame_ns)) {
+            outcome.settled = true;
+            break;
+        }
+    }
+    if (!frame_ns.empty()) {
+        outcome.first_frame_ns = frame_ns.front();
+    }
+    return outcome;
+}
+
+/// How many timed batches the measured loop takes: a fixed count, or adaptive between
+/// `min_iterations` and `max_iterations` until the median's CI narrows to `target_ci`.
+struct SamplingPlan {
+    int min_iterations = 10;
+    int max_iterations = 10;
+    double target_ci = 0.0;  // 0 = fixed count
+    int64_t budget_ns = 0;   // Adaptive only; the minimum is always taken
+    bool counters = false;   // Read pal::ProcessCounters around each sample
+};
+
+SamplingPlan MakeSamplingPlan(const BenchmarkPolicy& policy) {
+    SamplingPlan plan;
+    plan.min_iterations = std::max(1, policy.measurement_iterations);
+    plan.max_iterations = plan.min_iterations;
+    plan.counters = policy.sample_counters;
+    if (policy.target_ci > 0.0) {
+        plan.target_ci = policy.target_ci;
+        plan.max_iterations = std::max(plan.min_iterations, policy.max_iterations);
+        plan.budget_ns = static_cast<int64_t>(std::max(0.0, policy.time_budget_s) * 1e9);
+    }
+    return plan;
+}
+
+/// Measured loop: timed batches of `batch_frames` frames as `plan` directs, with per-frame
+/// samples. In adaptive mode the stopping rule is re-evaluated every ~10% more samples.
+/// @param stop_reason If non-null, receives why an adaptive loop stopped ("ci",
+///        "max_iterations" or "time_budget"); left empty for a fixed count.
+/// @param raw If non-null, receives the samples in run order (and counters if planned).
+/// Blueprint Reference: [ARCH-13-02b] Measured loop (Chapter 3) / [REQ-21,22,23] (Chapter 3)
+Result<TimingStats> MeasureFrames(IBackendAdapter& adapter, const PreparedScene& scene,
+                                  const SurfaceConfig& config, SurfaceBuffer& buffer,
+                                  const SamplingPlan& plan, int batch_frames,
+                                  std::string* stop_reason = nullptr, CaseResult* raw = nullptr) {
+    std::vector<int64_t> wall_samples;
+    std::vector<int64_t> cpu_samples;
+    wall_samples.reserve(static_cast<size_t>(plan.min_iterations));
+    cpu_samples.reserve(static_cast<size_t>(plan.min_iterations));
+
+    // Counters are read outside the timed section, like the sample bookkeeping
+    pal::ProcessCounters before;
+    pal::ProcessCounters after;
+    std::vector<SampleCounter> counters;
+    if (raw && plan.counters && pal::ReadProcessCounters(before)) {
+        counters = {{"minor_faults", {}},
+                    {"major_faults", {}},
+                    {"voluntary_switches", {}},
+                    {"involuntary_switches", {}}};
+    }
+
+    std::string stop;
+    std::vector<int64_t> sorted;
+    int next_check = plan.min_iterations;
+    const auto loop_start = pal::NowMonotonic();
+    for (int i = 0; i < plan.max_iterations; ++i) {
+        if (!counters.empty()) {
+            (void)pal::ReadProcessCounters(before);
+        }
+
+        // Start timing
+        auto cpu_start = pal::GetCpuTime();
+        auto wall_start = pal::NowMonotonic();
+
+        // Timed section: ONLY rendering
+        auto status = adapter.RenderBatch(scene, config, buffer, batch_frames);
+
+        // End timing
+        auto wall_end = pal::NowMonotonic();
+        auto cpu_end = pal::GetCpuTime();
+
+        if (status.failed()) {
+            return status;
+        }
+
+        // Samples are per frame
+        wall_samples.push_back(pal::ToNanoseconds(pal::Elapsed(wall_start, wall_end)) /
+                               batch_frames);
+        cpu_samples.push_back(pal::ToNanoseconds(cpu_end - cpu_start) / batch_frames);
+        if (!counters.empty()) {
+            (void)pal::ReadProcessCounters(after);
+            counters[0].values.push_back(after.minor_faults - before.minor_faults);
+            counters[1].values.push_back(after.major_faults - before.major_faults);
+            counters[2].values.push_back(after.voluntary_switches - before.voluntary_switches);
+            counters[3].values.push_back(after.involuntary_switches - before.involuntary_switches);
+        }
+
+        const int n = i + 1;
+        if (plan.target_ci <= 0.0 || n < plan.min_iterations) {
+            continue;
+        }
+        if (n >= next_check) {
+            sorted = wall_samples;
+            std::sort(sorted.begin(), sorted.end());
+            if (RelativeMedianCi(sorted) <= plan.target_ci) {
+                stop = "ci";
+                break;
+            }
+            next_check = n + std::max(1, n / 10);
+        }
+        if (pal::ToNanoseconds(pal::Elapsed(loop_start, pal::NowMonotonic())) >= plan.budget_ns) {
+            stop = "time_budget";
+            break;
+        }
+    }
+    if (plan.target_ci > 0.0 && stop.empty()) {
+        stop = "max_iterations";
+    }
+    if (stop_reason) {
+        *stop_reason = stop;
+    }
+    if (raw) {
+        raw->wall_samples = wall_samples;
+        raw->cpu_samples = cpu_samples;
+        raw->sample_counters = std::move(counters);
+    }
+
+    return ComputeStats(wall_samples, cpu_samples);
+}
+
+/// Submit `frame_count` frames keeping `depth` in flight, one buffer per slot, and wait for
+/// each slot before reusing it. Every in-flight frame is drained before returning, also on
+/// failure, so the adapter never holds a buffer that is about to be freed.
+Result<ThroughputStats> RunPipelined(IBackendAdapter& adapter, const PreparedScene& scene,
+                                     const SurfaceConfig& config, const BenchmarkPolicy& policy,
+                                     int frame_count) {
+    const int depth = policy.pipeline_depth;
+    const auto slots = static_cast<size_t>(depth);
+    std::vector<SurfaceBuffer> buffers;
+    buffers.reserve(slots);
+    for (size_t slot = 0; slot < slots; ++slot) {
+        auto buffer = AllocateSurface(config, policy.surface_memory);
+        if (buffer.failed()) {
+            return buffer.status();
+        }
+        buffers.push_back(std::move(buffer.value()));
+    }
+    std::vector<pal::TimePoint> submitted(slots);
+    std::vector<int64_t> latencies;
+    latencies.reserve(static_cast<size_t>(frame_count));
+
+    Status failure = Status::Ok();
+    auto wait = [&](int frame) {
+        const auto slot = static_cast<uint32_t>(frame % depth);
+        auto status = adapter.WaitFrame(slot);
+        latencies.push_back(pal::ToNanoseconds(pal::Elapsed(submitted[slot], pal::NowMonotonic())));
+        if (status.failed() && failure.ok()) {
+            failure = status;
+        }
+    };
+
+    // Frames [first_pending, submitted_count) are in flight
+    int first_pending = 0;
+    int submitted_count = 0;
+    auto start = pal::NowMonotonic();
+    for (; submitted_count < frame_count && failure.ok(); ++submitted_count) {
+        if (submitted_count - first_pending == depth) {
+            wait(first_pending++);
+        }
+        const auto slot = static_cast<uint32_t>(submitted_count % depth);
+        submitted[slot] = pal::NowMonotonic();
+        auto status = adapter.SubmitFrame(scene, config, buffers[slot], slot);
+        if (status.failed()) {
+            failure = status;
+            break;  // Nothing in flight on this slot
+        }
+    }
+    while (first_pending < submitted_count) {
+        wait(first_pending++);
+    }
+    auto elapsed_ns = pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic()));
+    if (failure.failed()) {
+        return failure;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    ThroughputStats stats;
+    stats.pipeline_depth = depth;
+    stats.frame_count = frame_count;
+    stats.async = adapter.GetCapabilities().supports_async_submit;
+    stats.sustained_fps =
+        elapsed_ns > 0 ? static_cast<double>(frame_count) * 1e9 / static_cast<double>(elapsed_ns)
+                       : 0.0;
+    stats.latency_p50_ns = ComputePercentile(latencies, 50.0);
+    stats.latency_p90_ns = ComputePercentile(latencies, 90.0);
+    return stats;
+}
+
+/// Prepare a scene derived from `scene` (outlined strokes, flattened curves) and time it with
+/// the case's warmup and measured loop. The adapter is prepared for `scene` again afterwards.
+Result<TimingStats> MeasureDerivedScene(IBackendAdapter& adapter, const PreparedScene& derived,
+                                        const PreparedScene& scene, const SurfaceConfig& config,
+                                        const BenchmarkPolicy& policy, int batch_frames) {
+    auto status = adapter.Prepare(derived);
+    auto buffer = AllocateSurface(config, policy.surface_memory);
+    if (status.ok() && buffer.failed()) {
+        status = buffer.status();
+    }
+    if (status.ok()) {
+        auto warmup = RunWarmup(adapter, derived, config, buffer.value(), policy);
+        if (warmup.failed()) {
+            status = warmup.status();
+        }
+    }
+    Result<TimingStats> stats = status;
+    if (status.ok()) {
+        stats = MeasureFrames(adapter, derived, config, buffer.value(), MakeSamplingPlan(policy),
+                              batch_frames);
+    }
+
+    auto restore_status = adapter.Prepare(scene);
+    if (stats.ok() && restore_status.failed()) {
+        return restore_status;
+    }
+    return stats;
+}
+
+/// Outline the strokes once per measurement iteration to time the stroker, then time the
+/// fill-only scene like the original. Scenes without strokes return empty stats.
+Result<StrokeIsolationStats> RunStrokeIsolation(IBackendAdapter& adapter,
+                                                const PreparedScene& scene,
+                                                const SurfaceConfig& config,
+                                                const BenchmarkPolicy& policy, int batch_frames) {
+    StrokeIsolationStats stats;
+    std::optional<PreparedScene> fill_scene;
+    std::vector<int64_t> stroker_samples;
+    const int runs = std::max(1, policy.measurement_iterations);
+    for (int i = 0; i < runs; ++i) {
+        int64_t stroker_ns = 0;
+        auto outlined = Harness::OutlineStrokes(adapter, scene, &stroker_ns);
+        if (outlined.failed()) {
+            return outlined.status();
+        }
+        if (outlined.value().paths.size() == scene.paths.size()) {
+            return stats;  // No strokes to isolate
+        }
+        stroker_samples.push_back(stroker_ns);
+        if (!fill_scene) {
+            fill_scene = std::move(outlined.value());
+        }
+    }
+    std::sort(stroker_samples.begin(), stroker_samples.end());
+    stats.stroke_count = static_cast<int>(fill_scene->paths.size() - scene.paths.size());
+    stats.stroker_p50_ns = ComputePercentile(stroker_samples, 50.0);
+
+    auto fill_stats =
+        MeasureDerivedScene(adapter, *fill_scene, scene, config, policy, batch_frames);
+    if (fill_stats.failed()) {
+        return fill_stats.status();
+    }
+    stats.fill_wall_p50_ns = fill_stats.value().wall_p50_ns;
+    stats.fill_cpu_p50_ns = fill_stats.value().cpu_p50_ns;
+    return stats;
+}
+
+/// Flatten every path once per measurement iteration into one scene copy to time the flattener,
+/// then time the flattened scene like the original. Scenes without curves return empty stats.
+Result<FlattenStats> RunFlattened(IBackendAdapter& adapter, const PreparedScene& scene,
+                                  const SurfaceConfig& config, const BenchmarkPolicy& policy,
+                                  int batch_frames) {
+    FlattenStats stats;
+    if (!(policy.flatten_tolerance > 0.0f)) {
+        return Status::InvalidArg("Flattening tolerance must be positive");
+    }
+    auto scales = ir::PathScales(scene);
+    if (scales.failed()) {
+        return scales.status();
+    }
+
+    // Copied once outside the timer: samples cover path flattening only, into reused storage
+    PreparedScene flat_scene = scene;
+    std::vector<int64_t> flatten_samples;
+    const int runs = std::max(1, policy.measurement_iterations);
+    flatten_samples.reserve(static_cast<size_t>(runs));
+    for (int i = 0; i < runs; ++i) {
+        auto start = pal::NowMonotonic();
+        const int curves = ir::FlattenPaths(scene.paths, scales.value(), policy.flatten_tolerance,
+                                            flat_scene.paths);
+        flatten_samples.push_back(pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic())));
+        if (curves == 0) {
+            return stats;  // Nothing to flatten
+        }
+        stats.curve_count = curves;
+    }
+    std::sort(flatten_samples.begin(), flatten_samples.end());
+    stats.tolerance = policy.flatten_tolerance;
+    stats.flatten_p50_ns = ComputePercentile(flatten_samples, 50.0);
+
+    auto flat_stats =
+        MeasureDerivedScene(adapter, flat_scene, scene, config, policy, batch_frames);
+    if (flat_stats.failed()) {
+        return flat_stats.status();
+    }
+    stats.wall_p50_ns = flat_stats.value().wall_p50_ns;
+    stats.cpu_p50_ns = flat_stats.value().cpu_p50_ns;
+    return stats;
+}
+
+/// Displace the caches by writing and reading back one byte per cache line of `buffer`.
+void EvictCaches(std::vector<uint8_t>& buffer) {
+    constexpr size_t kLine = 64;
+    for (size_t i = 0; i < buffer.size(); i += kLine) {
+        buffer[i] = static_cast<uint8_t>(buffer[i] + 1);
+    }
+    uint8_t sum = 0;
+    for (size_t i = 0; i < buffer.size(); i += kLine) {
+        sum = static_cast<uint8_t>(sum + buffer[i]);
+    }
+    volatile uint8_t sink = sum;
+    (void)sink;
+}
+
+/// Time policy.measurement_iterations single frames with cold input and output buffers. Scene
+/// copies are identical to `scene`, so whatever the adapter prepared for it applies to them:
+/// only the command stream, path arrays and output buffers rotate, while the prepared native
+/// state stays warm unless the LLC is evicted. One untimed pass over the pool first keeps page
+/// faults of the fresh buffers out of the samples.
+Result<ColdBufferStats> RunColdBuffers(IBackendAdapter& adapter, const PreparedScene& scene,
+                                       const SurfaceConfig& config, const BenchmarkPolicy& policy,
+                                       int64_t warm_p50_ns) {
+    ColdBufferStats stats;
+    stats.rotation = std::max(1, policy.rotate_buffers);
+    const auto pool = static_cast<size_t>(stats.rotation);
+    const std::vector<PreparedScene> copies(pool - 1, scene);  // Slot 0 renders `scene` itself
+    std::vector<SurfaceBuffer> buffers;
+    buffers.reserve(pool);
+    for (size_t slot = 0; slot < pool; ++slot) {
+        auto buffer = AllocateSurface(config, policy.surface_memory);
+        if (buffer.failed()) {
+            return buffer.status();
+        }
+        buffers.push_back(std::move(buffer.value()));
+    }
+    std::vector<uint8_t> evict;
+    if (policy.evict_llc) {
+        const int64_t llc = pal::GetLastLevelCacheBytes();
+        stats.evict_bytes =
+            llc > 0 ? static_cast<int64_t>(static_cast<double>(llc) * kEvictLlcFactor)
+                    : kEvictFallbackBytes;
+        evict.resize(static_cast<size_t>(stats.evict_bytes));
+    }
+
+    for (size_t slot = 0; slot < pool; ++slot) {
+        auto status = adapter.Render(slot == 0 ? scene : copies[slot - 1], config, buffers[slot]);
+        if (status.failed()) {
+            return status;
+        }
+    }
+
+    std::vector<int64_t> wall_samples;
+    std::vector<int64_t> cpu_samples;
+    const int runs = std::max(1, policy.measurement_iterations);
+    for (int i = 0; i < runs; ++i) {
+        const size_t slot = static_cast<size_t>(i) % pool;
+        if (!evict.empty()) {
+            EvictCaches(evict);
+        }
+        auto cpu_start = pal::GetCpuTime();
+        auto wall_start = pal::NowMonotonic();
+        auto status = adapter.Render(slot == 0 ? scene : copies[slot - 1], config, buffers[slot]);
+        auto wall_end = pal::NowMonotonic();
+        auto cpu_end = pal::GetCpuTime();
+        if (status.failed()) {
+            return status;
+        }
+        wall_samples.push_back(pal::ToNanoseconds(pal::Elapsed(wall_start, wall_end)));
+        cpu_samples.push_back(pal::ToNanoseconds(cpu_end - cpu_start));
+    }
+
+    const TimingStats cold = ComputeStats(wall_samples, cpu_samples);
+    stats.wall_p50_ns = cold.wall_p50_ns;
+    stats.wall_p90_ns = cold.wall_p90_ns;
+    stats.cpu_p50_ns = cold.cpu_p50_ns;
+    if (warm_p50_ns > 0) {
+        stats.cold_warm_ratio =
+            static_cast<double>(stats.wall_p50_ns) / static_cast<double>(warm_p50_ns);
+    }
+    return stats;
+}
+
+}  // namespace
+
 CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene,
                             const BenchmarkPolicy& policy) {
     CaseResult result;
@@ -28,6 +534,10 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
     result.scene_hash = scene.scene_hash;
     result.width = static_cast<int>(scene.width);
     result.height = static_cast<int>(scene.height);
+    result.thread_count = policy.thread_count;
+    if (policy.max_isa) {
+        result.max_isa = pal::IsaLevelName(*policy.max_isa);
+    }
 
     // Check compatibility
     auto caps = adapter.GetCapabilities();
@@ -39,6 +549,21 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
         return result;
     }
 
+    // A cap below the CPU's level only means something to backends that can lower their dispatch
+    if (policy.max_isa && *policy.max_isa < pal::HighestIsaLevel() && !caps.supports_isa_cap) {
+        result.decision = CaseDecision::kSkip;
+        result.reasons.push_back("UNSUPPORTED_FEATURE:isa_cap");
+        return result;
+    }
+
+    // Padded rows need a backend that addresses the buffer through SurfaceConfig::stride
+    result.stride = policy.pad_stride ? PaddedStride(result.width) : result.width * 4;
+    if (result.stride != result.width * 4 && !caps.supports_surface_stride) {
+        result.decision = CaseDecision::kSkip;
+        result.reasons.push_back("UNSUPPORTED_FEATURE:surface_stride");
+        return result;
+    }
+
     RequiredFeatures required;  // TODO: Extract from scene
     std::string compat_reason = CheckCompatibility(caps, required);
     if (!compat_reason.empty()) {
@@ -59,6 +584,9 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
     SurfaceConfig config;
     config.width = static_cast<int>(scene.width);
     config.height = static_cast<int>(scene.height);
+    config.format = adapter.GetNativeFormat();
+    config.stride = result.stride;
+    result.pixel_format = PixelFormatName(config.format);
 
     // Preallocate output buffer (outside timed section)
     // Blueprint Reference: [REQ-21] Measured loop MUST NOT perform filesystem I/O (Chapter 3)
@@ -67,58 +595,129 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
     // older version or I misread. Let's use [REQ-21] (Ch3) and [REQ-71-01] (Ch5). NOTE: We use
     // resize() not reserve() to ensure adapters receive a correctly sized buffer. Adapters MUST NOT
     // call resize/fill themselves; the IR kClear command handles clearing.
-    std::vector<uint8_t> output_buffer;
-    output_buffer.resize(static_cast<size_t>(config.width) * config.height * 4);
+    auto surface = AllocateSurface(config, policy.surface_memory);
+    if (surface.failed()) {
+        result.decision = CaseDecision::kFail;
+        result.reasons.push_back("ALLOC_FAILED:" + surface.status().message);
+        return result;
+    }
+    SurfaceBuffer& output_buffer = surface.value();
+    if (policy.prefault) {
+        PrefaultScene(scene, output_buffer);
+    }
 
     // Warm-up phase (untimed for primary stats)
     // Blueprint Reference: [ARCH-13-02a] Warmup loop (Chapter 3)
-    for (int i = 0; i < policy.warmup_iterations; ++i) {
-        auto status = adapter.Render(scene, config, output_buffer);
-        if (status.failed()) {
+    auto warmup = RunWarmup(adapter, scene, config, output_buffer, policy);
+    if (warmup.failed()) {
+        result.decision = CaseDecision::kFail;
+        result.reasons.push_back("WARMUP_FAILED:" + warmup.status().message);
+        return result;
+    }
+    result.warmup_frames = warmup.value().frames;
+    result.first_frame_ns = warmup.value().first_frame_ns;
+    if (!warmup.value().settled) {
+        result.reasons.push_back("WARMUP_NOT_SETTLED:" + std::to_string(result.warmup_frames) +
+                                 " frames");
+    }
+
+    // Frames per timed sample: timer reads and the virtual call are amortized over the batch
+    int batch_frames = policy.batch_frames;
+    if (batch_frames <= 0) {
+        auto calibrated = CalibrateBatchFrames(adapter, scene, config, output_buffer);
+        if (calibrated.failed()) {
             result.decision = CaseDecision::kFail;
-            result.reasons.push_back("WARMUP_FAILED:" + status.message);
+            result.reasons.push_back("WARMUP_FAILED:" + calibrated.status().message);
             return result;
         }
+        batch_frames = calibrated.value();
     }
+    result.batch_frames = batch_frames;
 
     // Measurement phase
     // Blueprint Reference: [ARCH-13-02b] Measured loop (Chapter 3) / [REQ-21,22,23] (Chapter 3)
-    std::vector<int64_t> wall_samples;
-    std::vector<int64_t> cpu_samples;
-    wall_samples.reserve(static_cast<size_t>(policy.measurement_iterations));
-    cpu_samples.reserve(static_cast<size_t>(policy.measurement_iterations));
-
-    // Note: Overhead measurement removed for now - not actively used
-
-    for (int i = 0; i < policy.measurement_iterations; ++i) {
-        // Measure inter-call overhead (from end of last iteration to start of this one)
-        // Note: This is an approximation.
-
-        // Start timing
-        auto cpu_start = pal::GetCpuTime();
-        auto wall_start = pal::NowMonotonic();
-
-        // Timed section: ONLY rendering
-        auto status = adapter.Render(scene, config, output_buffer);
+    auto stats = MeasureFrames(adapter, scene, config, output_buffer, MakeSamplingPlan(policy),
+                               batch_frames, &result.sampling_stop, &result);
+    if (stats.failed()) {
+        result.decision = CaseDecision::kFail;
+        result.reasons.push_back("RENDER_FAILED:" + stats.status().message);
+        return result;
+    }
+    result.stats = stats.value();
 
-        // End timing
-        auto wall_end = pal::NowMonotonic();
-        auto cpu_end = pal::GetCpuTime();
+    // Throughput mode: overlapped frames, reported next to (not instead of) per-frame times
+    if (policy.pipeline_depth > 0) {
+        const int frame_count = std::max(policy.measurement_iterations * batch_frames,
+                                         policy.pipeline_depth * kPipelineFramesPerSlot);
+        auto throughput = RunPipelined(adapter, scene, config, policy, frame_count);
+        if (throughput.failed()) {
+            result.decision = CaseDecision::kFail;
+            result.reasons.push_back("RENDER_FAILED:" + throughput.status().message);
+            return result;
+        }
+        result.throughput = throughput.value();
+    }
 
-        if (status.failed()) {
+    // Stroker isolation: stroke outlines and fill-only rendering timed apart
+    if (policy.isolate_strokes) {
+        auto isolation = RunStrokeIsolation(adapter, scene, config, policy, batch_frames);
+        if (isolation.ok()) {
+            result.stroke_isolation = isolation.value();
+        } else if (isolation.status().code == StatusCode::kUnsupported) {
+            result.reasons.push_back("STROKE_ISOLATION_UNSUPPORTED:" +
+                                     isolation.status().message);
+        } else {
             result.decision = CaseDecision::kFail;
-            result.reasons.push_back("RENDER_FAILED:" + status.message);
+            result.reasons.push_back("STROKE_ISOLATION_FAILED:" + isolation.status().message);
             return result;
         }
+    }
 
-        wall_samples.push_back(pal::ToNanoseconds(pal::Elapsed(wall_start, wall_end)));
-        cpu_samples.push_back(pal::ToNanoseconds(cpu_end - cpu_start));
+    // Pre-flattened geometry: the same scene with curves already subdivided
+    if (policy.flatten_tolerance > 0.0f) {
+        auto flattened = RunFlattened(adapter, scene, config, policy, batch_frames);
+        if (flattened.failed()) {
+            result.decision = CaseDecision::kFail;
+            result.reasons.push_back("FLATTENED_FAILED:" + flattened.status().message);
+            return result;
+        }
+        result.flattened = flattened.value();
     }
 
-    // Compute statistics
-    result.stats = ComputeStats(wall_samples, cpu_samples);
+    // Cold buffers: rotated scene copies and output buffers, optionally with the LLC evicted
+    if (policy.rotate_buffers > 0 || policy.evict_llc) {
+        auto cold = RunColdBuffers(adapter, scene, config, policy, result.stats.wall_p50_ns);
+        if (cold.failed()) {
+            result.decision = CaseDecision::kFail;
+            result.reasons.push_back("COLD_BUFFERS_FAILED:" + cold.status().message);
+            return result;
+        }
+        result.cold_buffers = cold.value();
+    }
     result.decision = CaseDecision::kExecute;
 
+    // Artifacts and SSIM work on straight RGBA8. The backend rendered its native format, so
+    // convert once here, outside the measured loop, and record what the conversion cost.
+    // Padded rows are compacted on the way.
+    std::vector<uint8_t> artifact_pixels;
+    if (policy.generate_png || policy.compare_ssim) {
+        const size_t row_bytes = static_cast<size_t>(config.width) * 4;
+        const auto stride = static_cast<size_t>(SurfaceStride(config));
+        artifact_pixels.resize(row_bytes * config.height);
+        auto convert_start = pal::NowMonotonic();
+        if (stride == row_bytes) {
+            artifacts::convert_pixels(output_buffer, config.format, artifact_pixels,
+                                      PixelFormat::kRgba8);
+        } else {
+            for (size_t y = 0; y < static_cast<size_t>(config.height); ++y) {
+                const std::span<const uint8_t> row(output_buffer.data() + y * stride, row_bytes);
+                const std::span<uint8_t> out(artifact_pixels.data() + y * row_bytes, row_bytes);
+                artifacts::convert_pixels(row, config.format, out, PixelFormat::kRgba8);
+            }
+        }
+        result.convert_ns = pal::ToNanoseconds(pal::Elapsed(convert_start, pal::NowMonotonic()));
+    }
+
     // Artifact Generation
     if (policy.generate_png) {
         // [CONC-08-01] Serialize artifact I/O
@@ -133,7 +732,7 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
         std::error_code ec;
         std::filesystem::create_directories(out_path.parent_path(), ec);
 
-        if (artifacts::write_png(out_path.string(), result.width, result.height, output_buffer)) {
+        if (artifacts::write_png(out_path.string(), result.width, result.height, artifact_pixels)) {
             result.artifact_path = out_path.string();
         } else {
             VGCPU_LOG_ERROR("Failed to write artifact: " + out_path.string());
@@ -153,7 +752,7 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
             auto golden_pixels = artifacts::read_image(golden_path.string(), gw, gh);
             if (!golden_pixels.empty()) {
                 if (gw == result.width && gh == result.height) {
-                    auto ssim_res = artifacts::compute_ssim(gw, gh, output_buffer, gw * 4,
+                    auto ssim_res = artifacts::compute_ssim(gw, gh, artifact_pixels, gw * 4,
                                                             golden_pixels, gw * 4);
                     result.ssim_score = ssim_res.score;
                     result.ssim_passed = ssim_res.passed;
@@ -174,6 +773,497 @@ CaseResult Harness::RunCase(IBackendAdapter& adapter, const PreparedScene& scene
     return result;
 }
 
+int Harness::PaddedStride(int width) {
+    int stride = (width * 4 + kStrideAlignBytes - 1) / kStrideAlignBytes * kStrideAlignBytes;
+    if (stride % kStrideAliasBytes == 0) {
+        stride += kStrideAlignBytes;
+    }
+    return stride;
+}
+
+Status Harness::InitializeAdapter(IBackendAdapter& adapter, const AdapterArgs& args,
+                                  const BenchmarkPolicy& policy) {
+    if (policy.lock_memory) {
+        auto locked = pal::LockProcessMemory();
+        if (locked.failed()) {
+            return locked;
+        }
+    }
+    if (!policy.worker_cpus.empty() && !pal::PinCurrentThreadToCpus(policy.worker_cpus)) {
+        VGCPU_LOG_WARN("Could not confine worker threads to the requested CPUs");
+    }
+    auto status = adapter.Initialize(args);
+    if (policy.orchestrator_cpu >= 0 && !pal::PinCurrentThreadToCpus({policy.orchestrator_cpu})) {
+        VGCPU_LOG_WARN("Could not pin the measuring thread to CPU " +
+                       std::to_string(policy.orchestrator_cpu));
+    }
+    return status;
+}
+
+CaseResult Harness::RunRepeated(const AdapterFactory& factory, const AdapterArgs& args,
+                                const PreparedScene& scene, const BenchmarkPolicy& policy) {
+    const int count = std::max(1, policy.repetitions);
+    std::vector<CaseResult> runs;
+    runs.reserve(static_cast<size_t>(count));
+    for (int rep = 0; rep < count; ++rep) {
+        std::unique_ptr<IBackendAdapter> adapter;
+        Status status = Status::Ok();
+        {
+            std::lock_guard<std::mutex> lock(LifecycleMutex());
+            adapter = factory();
+            status = adapter ? InitializeAdapter(*adapter, args, policy)
+                             : Status::Fail("no adapter instance");
+        }
+        if (status.failed()) {
+            return FailedCase(adapter ? adapter->GetInfo().id : "", scene, policy,
+                              "INIT_FAILED:" + status.message);
+        }
+        runs.push_back(RunCase(*adapter, scene, policy));
+        {
+            std::lock_guard<std::mutex> lock(LifecycleMutex());
+            adapter->Shutdown();
+        }
+        if (runs.back().decision != CaseDecision::kExecute) {
+            return runs.back();
+        }
+    }
+    if (count == 1) {
+        return runs.front();
+    }
+
+    // Report the median repetition, so every field of the result comes from one coherent run
+    std::vector<TimingStats> stats;
+    std::vector<size_t> order(runs.size());
+    for (size_t i = 0; i < runs.size(); ++i) {
+        stats.push_back(runs[i].stats);
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return runs[a].stats.wall_p50_ns < runs[b].stats.wall_p50_ns;
+    });
+    CaseResult result = runs[order[(order.size() - 1) / 2]];
+    result.repetitions = ComputeRepetitionStats(stats);
+    return result;
+}
+
+CaseResult Harness::FailedCase(const std::string& backend_id, const PreparedScene& scene,
+                               const BenchmarkPolicy& policy, const std::string& reason) {
+    CaseResult result;
+    result.backend_id = backend_id;
+    result.scene_id = scene.scene_id;
+    result.scene_hash = scene.scene_hash;
+    result.width = static_cast<int>(scene.width);
+    result.height = static_cast<int>(scene.height);
+    result.thread_count = policy.thread_count;
+    if (policy.max_isa) {
+        result.max_isa = pal::IsaLevelName(*policy.max_isa);
+    }
+    result.decision = CaseDecision::kFail;
+    result.reasons.push_back(reason);
+    return result;
+}
+
+std::mutex& Harness::LifecycleMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+Result<MultiInstanceStats> Harness::RunInstances(const AdapterFactory& factory,
+                                                 const AdapterArgs& args,
+                                                 const std::vector<const PreparedScene*>& scenes,
+                                                 const BenchmarkPolicy& policy,
+                                                 int64_t single_frame_ns) {
+    if (policy.instances <= 0 || scenes.empty()) {
+        return Status::InvalidArg("Multi-instance run needs at least one instance and scene");
+    }
+    struct Instance {
+        InstanceStats stats;
+        std::vector<int64_t> latencies;
+        pal::TimePoint end;
+        Status status = Status::Ok();
+    };
+    std::vector<Instance> instances(static_cast<size_t>(policy.instances));
+    const int cpus = pal::GetAvailableCpuCount();
+    const auto run_time = std::chrono::duration_cast<pal::Duration>(
+        std::chrono::duration<double>(std::max(0.0, policy.instance_time_s)));
+
+    // Setup and teardown run one instance at a time; rendering waits for the common start
+    std::mutex gate_mutex;
+    std::condition_variable gate;
+    int ready = 0;
+    bool started = false;
+    pal::TimePoint start;
+
+    auto run = [&](size_t index) {
+        Instance& instance = instances[index];
+        const PreparedScene& scene = *scenes[index % scenes.size()];
+        instance.stats.scene_id = scene.scene_id;
+        // Record the OS CPU ID, which differs from the index under taskset or cpusets
+        std::vector<int> pinned;
+        if (pal::PinCurrentThread(static_cast<int>(index) % cpus)) {
+            pinned = pal::GetAllowedCpus();
+            if (!pinned.empty()) {
+                instance.stats.core = pinned.front();
+            }
+        }
+
+        std::unique_ptr<IBackendAdapter> adapter;
+        SurfaceConfig config;
+        SurfaceBuffer buffer;
+        auto setup = [&]() -> Status {
+            std::lock_guard<std::mutex> lock(LifecycleMutex());
+            adapter = factory();
+            auto status = adapter ? InitializeAdapter(*adapter, args, policy)
+                                  : Status::Fail("no adapter instance");
+            if (!pinned.empty()) {
+                (void)pal::PinCurrentThreadToCpus(pinned);  // Back from worker/orchestrator CPUs
+            }
+            if (status.failed()) {
+                adapter.reset();
+                return Status::Fail("INIT_FAILED:" + status.message);
+            }
+            status = adapter->Prepare(scene);
+            if (status.failed()) {
+                return Status::Fail("PREPARE_FAILED:" + status.message);
+            }
+            config.width = static_cast<int>(scene.width);
+            config.height = static_cast<int>(scene.height);
+            config.format = adapter->GetNativeFormat();
+            if (policy.pad_stride && adapter->GetCapabilities().supports_surface_stride) {
+                config.stride = PaddedStride(config.width);
+            }
+            auto surface = AllocateSurface(config, policy.surface_memory);
+            if (surface.failed()) {
+                return Status::Fail("ALLOC_FAILED:" + surface.status().message);
+            }
+            buffer = std::move(surface.value());
+            auto warmup = RunWarmup(*adapter, scene, config, buffer, policy);
+            if (warmup.failed()) {
+                return Status::Fail("WARMUP_FAILED:" + warmup.status().message);
+            }
+            return Status::Ok();
+        };
+        instance.status = setup();
+        {
+            std::unique_lock<std::mutex> lock(gate_mutex);
+            ++ready;
+            gate.notify_all();
+            gate.wait(lock, [&] { return started; });
+        }
+
+        // Frames back to back until the deadline; a frame started before it is completed. The
+        // first frame is timed from this thread's own wake-up, not from the gate's release.
+        instance.latencies.reserve(1024);
+        const auto deadline = start + run_time;
+        auto frame_start = pal::NowMonotonic();
+        while (instance.status.ok() && frame_start < deadline) {
+            auto status = adapter->Render(scene, config, buffer);
+            auto frame_end = pal::NowMonotonic();
+            if (status.failed()) {
+                instance.status = Status::Fail("RENDER_FAILED:" + status.message);
+                break;
+            }
+            instance.latencies.push_back(pal::ToNanoseconds(pal::Elapsed(frame_start, frame_end)));
+            frame_start = frame_end;
+        }
+        instance.end = frame_start;
+
+        if (adapter) {
+            std::lock_guard<std::mutex> lock(LifecycleMutex());
+            adapter->Shutdown();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(instances.size());
+    for (size_t i = 0; i < instances.size(); ++i) {
+        threads.emplace_back(run, i);
+    }
+    {
+        std::unique_lock<std::mutex> lock(gate_mutex);
+        gate.wait(lock, [&] { return ready == policy.instances; });
+        start = pal::NowMonotonic();
+        started = true;
+    }
+    gate.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    MultiInstanceStats stats;
+    stats.instance_count = policy.instances;
+    std::vector<int64_t> all_latencies;
+    pal::TimePoint end = start;
+    for (auto& instance : instances) {
+        if (instance.status.failed()) {
+            return instance.status;
+        }
+        std::sort(instance.latencies.begin(), instance.latencies.end());
+        instance.stats.frame_count = static_cast<int>(instance.latencies.size());
+        instance.stats.latency_p50_ns = ComputePercentile(instance.latencies, 50.0);
+        instance.stats.latency_p90_ns = ComputePercentile(instance.latencies, 90.0);
+        instance.stats.latency_p99_ns = ComputePercentile(instance.latencies, 99.0);
+        all_latencies.insert(all_latencies.end(), instance.latencies.begin(),
+                             instance.latencies.end());
+        end = std::max(end, instance.end);
+        stats.instances.push_back(instance.stats);
+    }
+
+    std::sort(all_latencies.begin(), all_latencies.end());
+    stats.frame_count = static_cast<int>(all_latencies.size());
+    stats.duration_s = pal::ToSeconds(pal::Elapsed(start, end));
+    stats.aggregate_fps =
+        stats.duration_s > 0.0 ? static_cast<double>(stats.frame_count) / stats.duration_s : 0.0;
+    if (single_frame_ns > 0) {
+        stats.scaling_efficiency = stats.aggregate_fps * static_cast<double>(single_frame_ns) /
+                                   1e9 / static_cast<double>(stats.instance_count);
+    }
+    stats.latency_p50_ns = ComputePercentile(all_latencies, 50.0);
+    stats.latency_p99_ns = ComputePercentile(all_latencies, 99.0);
+    return stats;
+}
+
+Result<PreparedScene> Harness::OutlineStrokes(IBackendAdapter& adapter, const PreparedScene& scene,
+                                              int64_t* stroker_ns) {
+    struct FillState {
+        uint16_t paint = 0;
+        uint8_t rule = static_cast<uint8_t>(ir::FillRule::kNonZero);
+        bool operator==(const FillState&) const = default;
+    };
+    struct State {
+        FillState fill;                    ///< Fill set by the scene
+        std::optional<FillState> emitted;  ///< Fill last sent in the rewritten stream
+        uint16_t stroke_paint = 0;
+        StrokeParams stroke;
+    };
+    struct Job {
+        uint16_t path_id;
+        StrokeParams stroke;
+    };
+
+    PreparedScene out = scene;
+    out.command_stream.clear();
+    out.command_stream.reserve(scene.command_stream.size());
+    std::vector<Job> jobs;
+
+    State state;
+    state.emitted = state.fill;
+    std::vector<State> stack;
+    TransformStack transforms;
+
+    auto emit = [&](ir::Opcode op, const uint8_t* payload, size_t size) {
+        out.command_stream.push_back(static_cast<uint8_t>(op));
+        out.command_stream.insert(out.command_stream.end(), payload, payload + size);
+    };
+    auto emit_fill = [&](const FillState& fill) {
+        if (state.emitted == fill) {
+            return;
+        }
+        uint8_t payload[3];
+        std::memcpy(payload, &fill.paint, sizeof(fill.paint));
+        payload[2] = fill.rule;
+        emit(ir::Opcode::kSetFill, payload, sizeof(payload));
+        state.emitted = fill;
+    };
+
+    const uint8_t* ptr = scene.command_stream.data();
+    const uint8_t* end = ptr + scene.command_stream.size();
+    while (ptr < end) {
+        const auto op = static_cast<ir::Opcode>(*ptr++);
+        const int size = ir::CommandPayloadSize(op);
+        if (size < 0) {
+            return Status::InvalidArg("Unknown opcode in command stream");
+        }
+        if (end - ptr < size) {
+            return Status::InvalidArg("Truncated command in command stream");
+        }
+
+        switch (op) {
+            case ir::Opcode::kSave:
+                stack.push_back(state);
+                transforms.Save();
+                emit(op, ptr, 0);
+                break;
+
+            case ir::Opcode::kRestore:
+                if (!stack.empty()) {
+                    state = stack.back();
+                    stack.pop_back();
+                }
+                // Backends differ on whether kRestore resets the fill, so send it again
+                state.emitted.reset();
+                transforms.Restore();
+                emit(op, ptr, 0);
+                break;
+
+            case ir::Opcode::kSetMatrix:
+            case ir::Opcode::kConcatMatrix:
+                transforms.Apply(op, ptr);
+                emit(op, ptr, static_cast<size_t>(size));
+                break;
+
+            case ir::Opcode::kSetFill:
+                std::memcpy(&state.fill.paint, ptr, sizeof(uint16_t));
+                state.fill.rule = ptr[2];
+                state.emitted = state.fill;
+                emit(op, ptr, static_cast<size_t>(size));
+                break;
+
+            case ir::Opcode::kSetStroke: {
+                // Dropped: the rewritten scene strokes nothing
+                float width = 0.0f;
+                std::memcpy(&state.stroke_paint, ptr, sizeof(uint16_t));
+                std::memcpy(&width, ptr + 2, sizeof(float));
+                state.stroke.width = width;
+                state.stroke.cap = ir::UnpackStrokeCap(ptr[6]);
+                state.stroke.join = ir::UnpackStrokeJoin(ptr[6]);
+                break;
+            }
+
+            case ir::Opcode::kFillPath:
+                emit_fill(state.fill);
+                emit(op, ptr, static_cast<size_t>(size));
+                break;
+
+            case ir::Opcode::kStrokePath: {
+                uint16_t path_id = 0;
+                std::memcpy(&path_id, ptr, sizeof(path_id));
+                if (path_id >= scene.paths.size()) {
+                    break;  // Backends skip it as well
+                }
+                const size_t outline_id = scene.paths.size() + jobs.size();
+                if (outline_id > UINT16_MAX) {
+                    return Status::InvalidArg("Too many stroked paths to outline");
+                }
+                const auto& m = transforms.Current();
+                Job job{path_id, state.stroke};
+                job.stroke.resolution_scale = std::sqrt(std::fabs(m[0] * m[3] - m[1] * m[2]));
+                jobs.push_back(job);
+
+                emit_fill({state.stroke_paint, static_cast<uint8_t>(ir::FillRule::kNonZero)});
+                const auto id = static_cast<uint16_t>(outline_id);
+                emit(ir::Opcode::kFillPath, reinterpret_cast<const uint8_t*>(&id), sizeof(id));
+                break;
+            }
+
+            default:
+                emit(op, ptr, static_cast<size_t>(size));
+                break;
+        }
+        ptr += size;
+        if (op == ir::Opcode::kEnd) {
+            break;
+        }
+    }
+
+    // Only the backend's stroker runs inside the timed section
+    std::vector<Path> outlines(jobs.size());
+    auto start = pal::NowMonotonic();
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto outline = adapter.StrokeToPath(scene.paths[jobs[i].path_id], jobs[i].stroke);
+        if (outline.failed()) {
+            return outline.status();
+        }
+        outlines[i] = std::move(outline.value());
+    }
+    if (stroker_ns) {
+        *stroker_ns = pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic()));
+    }
+
+    out.paths.insert(out.paths.end(), std::make_move_iterator(outlines.begin()),
+                     std::make_move_iterator(outlines.end()));
+    return out;
+}
+
+void Harness::ApplyBaseline(std::vector<CaseResult>& results, const std::string& baseline_id) {
+    auto find_baseline = [&](const CaseResult& r) -> const CaseResult* {
+        for (const auto& b : results) {
+            if (b.backend_id == baseline_id && b.decision == CaseDecision::kExecute &&
+                b.scene_id == r.scene_id && b.width == r.width && b.height == r.height) {
+                return &b;
+            }
+        }
+        return nullptr;
+    };
+
+    for (auto& r : results) {
+        if (r.decision != CaseDecision::kExecute || r.backend_id == baseline_id) {
+            continue;
+        }
+        const CaseResult* base = find_baseline(r);
+        if (!base) {
+            continue;
+        }
+        r.baseline_id = baseline_id;
+        r.net_wall_p50_ns = std::max<int64_t>(0, r.stats.wall_p50_ns - base->stats.wall_p50_ns);
+        r.net_cpu_p50_ns = std::max<int64_t>(0, r.stats.cpu_p50_ns - base->stats.cpu_p50_ns);
+    }
+}
+
+void Harness::ApplyScaling(std::vector<CaseResult>& results) {
+    auto same_case = [](const CaseResult& a, const CaseResult& b) {
+        return a.scene_id == b.scene_id && a.width == b.width && a.height == b.height &&
+               a.max_isa == b.max_isa;
+    };
+
+    for (auto& r : results) {
+        if (r.decision != CaseDecision::kExecute || r.stats.wall_p50_ns <= 0) {
+            continue;
+        }
+        // Tiled variants against their inner backend, thread sweeps against their 1-thread run
+        std::string reference_id = TiledAdapter::InnerIdOf(r.backend_id);
+        if (reference_id.empty()) {
+            if (r.thread_count <= 1) {
+                continue;
+            }
+            reference_id = r.backend_id;
+        }
+        auto serial = std::find_if(results.begin(), results.end(), [&](const CaseResult& s) {
+            return s.backend_id == reference_id && s.decision == CaseDecision::kExecute &&
+                   s.thread_count == 1 && same_case(s, r);
+        });
+        if (serial == results.end()) {
+            continue;
+        }
+        r.scaling_reference_id = reference_id;
+        r.speedup_vs_serial = static_cast<double>(serial->stats.wall_p50_ns) /
+                              static_cast<double>(r.stats.wall_p50_ns);
+        r.parallel_efficiency =
+            r.thread_count > 0 ? r.speedup_vs_serial / static_cast<double>(r.thread_count) : 0.0;
+    }
+
+    // Serial fraction over every thread count a backend ran a scene with
+    for (auto& r : results) {
+        if (r.scaling_reference_id.empty()) {
+            continue;
+        }
+        std::vector<std::pair<int, double>> points;
+        for (const auto& s : results) {
+            if (s.backend_id == r.backend_id && !s.scaling_reference_id.empty() &&
+                same_case(s, r)) {
+                points.emplace_back(s.thread_count, s.speedup_vs_serial);
+            }
+        }
+        r.serial_fraction = FitSerialFraction(points);
+    }
+}
+
+double Harness::FitSerialFraction(const std::vector<std::pair<int, double>>& points) {
+    // 1/S - 1/N = f * (1 - 1/N): a line through the origin in x = 1 - 1/N
+    double xy = 0.0;
+    double xx = 0.0;
+    for (const auto& [threads, speedup] : points) {
+        if (threads < 2 || !(speedup > 0.0)) {
+            continue;
+        }
+        const double inv_n = 1.0 / static_cast<double>(threads);
+        const double x = 1.0 - inv_n;
+        xy += x * (1.0 / speedup - inv_n);
+        xx += x * x;
+    }
+    return xx > 0.0 ? std::clamp(xy / xx, 0.0, 1.0) : 0.0;
+}
+
 std::string Harness::CheckCompatibility(const CapabilitySet& caps,
                                         const RequiredFeatures& required) {
     return vgcpu::CheckCompatibility(caps, required);
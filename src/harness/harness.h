@@ -10,9 +10,16 @@
 #include "common/capability_set.h"
 #include "common/status.h"
 #include "ir/prepared_scene.h"
+#include "pal/cpu_features.h"
+#include "pal/memory.h"
 
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace vgcpu {
@@ -20,24 +27,161 @@ namespace vgcpu {
 /// Benchmark policy configuration.
 /// Blueprint Reference: [ARCH-12-02a] RunConfig (Chapter 3) / [ARCH-14-A] CLI Frontend (Chapter 3)
 struct BenchmarkPolicy {
-    int warmup_iterations = 3;
-    int measurement_iterations = 10;
+    int warmup_iterations = 3;        // Fixed warmup count; the minimum when auto_warmup
+    bool auto_warmup = false;         // Warm until frame times settle (kWarmupWindow)
+    int max_warmup_iterations = 200;  // auto_warmup cap
+    int measurement_iterations = 10;  // Fixed sample count; the minimum when adaptive
+    double target_ci = 0.0;           // Adaptive stop: median 95% CI half-width / p50; 0 = off
+    int max_iterations = 1000;        // Adaptive: sample cap
+    double time_budget_s = 10.0;      // Adaptive: measured-loop time cap per case
     int repetitions = 1;
-    int thread_count = 1;  // 0 = backend default
+    int thread_count = 1;          // 0 = backend default
+    int batch_frames = 1;          // Frames per timed sample (RenderBatch); 0 = calibrate per case
+    int pipeline_depth = 0;        // Frames in flight in throughput mode (SubmitFrame); 0 = off
+    int instances = 0;             // Concurrent adapter instances, one per core; 0 = off
+    double instance_time_s = 2.0;  // Multi-instance: rendering time of every instance
+    int jobs = 1;                  // Cases run at once by CaseScheduler; 1 = serial
+    int cores_per_job = 1;         // CPUs of each CaseScheduler slot
+    bool isolate_strokes = false;  // Also time the backend stroker apart from rasterization
+    bool sample_counters = false;  // Also record page faults/context switches per sample
     bool generate_png = false;
     bool compare_ssim = false;
+    float flatten_tolerance = 0.0f;  // Also time with curves pre-flattened to this many px; 0 = off
     std::string golden_dir;
+    std::optional<pal::IsaLevel> max_isa;  // SIMD cap passed in AdapterArgs; unset = native
     std::string output_dir = ".";
+    std::string baseline_backend;  // Empty = no baseline subtraction (e.g. "decode")
+    std::string isolation;         // Forked child per "case" or "backend"; empty = in-process
+    double case_timeout_s = 0.0;   // Isolation: kill a child silent this long; 0 = no limit
+    int orchestrator_cpu = -1;     // OS CPU of the measuring thread; -1 = not pinned
+    std::vector<int> worker_cpus;  // OS CPUs backend worker threads inherit; empty = unrestricted
+    int fifo_priority = 0;         // SCHED_FIFO priority of the run's threads; 0 = normal
+    bool lock_memory = false;      // mlockall: pages stay resident, no major faults
+    bool prefault = false;         // Touch scene and output buffer pages before warmup
+    int rotate_buffers = 0;        // Cold-buffer mode: scene copies/buffers rotated; 0 = off
+    bool evict_llc = false;        // Cold-buffer mode: stream the LLC out before every frame
+    bool pad_stride = false;       // Pad output rows (Harness::PaddedStride); else width * 4
+    pal::MemoryPolicy surface_memory;  // Output buffer alignment, huge pages, NUMA placement
 };
 
 /// Timing statistics for a single benchmark case.
 /// Blueprint Reference: [ARCH-12-02c] SceneStats (Chapter 3) / [ARCH-12-02d] RunReport (Chapter 3)
+/// Tail and dispersion figures are computed for wall time only, after the measured loop.
 struct TimingStats {
-    int64_t wall_p50_ns = 0;  ///< Median wall time in nanoseconds
-    int64_t wall_p90_ns = 0;  ///< 90th percentile wall time
-    int64_t cpu_p50_ns = 0;   ///< Median CPU time in nanoseconds
-    int64_t cpu_p90_ns = 0;   ///< 90th percentile CPU time
-    int sample_count = 0;     ///< Number of samples
+    int64_t wall_p50_ns = 0;        ///< Median wall time in nanoseconds
+    int64_t wall_p90_ns = 0;        ///< 90th percentile wall time
+    int64_t cpu_p50_ns = 0;         ///< Median CPU time in nanoseconds
+    int64_t cpu_p90_ns = 0;         ///< 90th percentile CPU time
+    int sample_count = 0;           ///< Number of samples
+    int64_t wall_ci_low_ns = 0;     ///< 95% confidence interval of wall_p50_ns (order statistics)
+    int64_t wall_ci_high_ns = 0;    ///< Upper end of that interval
+    double wall_ci_rel = 0.0;       ///< Achieved precision: interval half-width / wall_p50_ns
+    double wall_mean_ns = 0.0;      ///< Mean wall time
+    double wall_stddev_ns = 0.0;    ///< Sample standard deviation of the wall times
+    int64_t wall_min_ns = 0;        ///< Fastest sample
+    int64_t wall_max_ns = 0;        ///< Slowest sample
+    int64_t wall_p95_ns = 0;        ///< 95th percentile wall time
+    int64_t wall_p99_ns = 0;        ///< 99th percentile wall time
+    int64_t wall_p999_ns = 0;       ///< 99.9th percentile wall time (max below 1000 samples)
+    int64_t wall_mad_ns = 0;        ///< Median absolute deviation from wall_p50_ns (unscaled)
+    int64_t wall_boot_low_ns = 0;   ///< 95% bootstrap percentile interval of wall_p50_ns
+    int64_t wall_boot_high_ns = 0;  ///< Upper end of the bootstrap interval
+    int wall_outliers = 0;          ///< Samples beyond 1.5 IQR of the quartiles (Tukey fences)
+    int wall_far_outliers = 0;      ///< Samples beyond 3 IQR of the quartiles (subset of above)
+};
+
+/// Pipelined throughput of a benchmark case (BenchmarkPolicy::pipeline_depth > 0).
+/// Frames are submitted with up to `pipeline_depth` in flight, the way a compositor overlaps
+/// frames, so throughput and latency diverge: sustained_fps counts completed frames over the
+/// whole run, latency is each frame's submit-to-completion time including its queueing.
+struct ThroughputStats {
+    int pipeline_depth = 0;        ///< Frames in flight; 0 = throughput mode not run
+    int frame_count = 0;         ///< Frames submitted
+    bool async = false;          ///< Backend overlaps frames (supports_async_submit)
+    double sustained_fps = 0.0;  ///< frame_count / wall time of the pipelined run
+    int64_t latency_p50_ns = 0;  ///< Median submit-to-completion time
+    int64_t latency_p90_ns = 0;  ///< 90th percentile submit-to-completion time
+};
+
+/// One adapter instance of a multi-instance run.
+struct InstanceStats {
+    int core = -1;               ///< OS ID of the CPU the instance ran on; -1 = not pinned
+    std::string scene_id;        ///< Scene the instance rendered
+    int frame_count = 0;         ///< Frames completed within the run
+    int64_t latency_p50_ns = 0;  ///< Median frame time
+    int64_t latency_p90_ns = 0;  ///< 90th percentile frame time
+    int64_t latency_p99_ns = 0;  ///< 99th percentile frame time
+};
+
+/// Independent adapter instances rendering concurrently, each on its own core with its own
+/// buffer (BenchmarkPolicy::instances), the way a server renders many documents at once. An
+/// aggregate rate below instance_count times the single-instance rate exposes what instances
+/// share: locks and allocators inside the library, last-level cache, memory bandwidth.
+struct MultiInstanceStats {
+    int instance_count = 0;           ///< Instances run; 0 = multi-instance mode not run
+    double duration_s = 0.0;          ///< Common start to the last instance's last frame
+    int frame_count = 0;              ///< Frames completed by all instances
+    double aggregate_fps = 0.0;       ///< frame_count / duration_s
+    double scaling_efficiency = 0.0;  ///< aggregate_fps / (instance_count * 1-instance fps)
+    int64_t latency_p50_ns = 0;       ///< Median frame time over all instances
+    int64_t latency_p99_ns = 0;       ///< 99th percentile frame time over all instances
+    std::vector<InstanceStats> instances;
+};
+
+/// Stroker and rasterizer cost of a stroked scene (BenchmarkPolicy::isolate_strokes).
+/// The backend's own stroker turns every stroked path into a fill outline (IBackendAdapter::
+/// StrokeToPath), then the resulting fill-only scene goes through the regular measured loop, so
+/// stroker_p50_ns + fill_wall_p50_ns can be set against the combined stroke timings in `stats`.
+struct StrokeIsolationStats {
+    int stroke_count = 0;          ///< StrokePath commands outlined; 0 = not run or unsupported
+    int64_t stroker_p50_ns = 0;    ///< Median time to outline every stroke of one frame
+    int64_t fill_wall_p50_ns = 0;  ///< Median wall time of one frame of the fill-only scene
+    int64_t fill_cpu_p50_ns = 0;   ///< Median CPU time of one frame of the fill-only scene
+};
+
+/// Timings of the case's scene with every curve flattened at prepare time
+/// (BenchmarkPolicy::flatten_tolerance, see ir::FlattenScene). Backends then rasterize only
+/// line segments, so stats.wall_p50_ns - wall_p50_ns estimates their curve-subdivision cost.
+struct FlattenStats {
+    float tolerance = 0.0f;      ///< Device-pixel tolerance; 0 = not run or no curves
+    int curve_count = 0;         ///< Quad and cubic verbs replaced by line segments
+    int64_t flatten_p50_ns = 0;  ///< Median time to flatten every path (ir::FlattenPaths, no copy)
+    int64_t wall_p50_ns = 0;     ///< Median wall time of one frame of the flattened scene
+    int64_t cpu_p50_ns = 0;      ///< Median CPU time of one frame of the flattened scene
+};
+
+/// Frame times with cold input and output buffers (BenchmarkPolicy::rotate_buffers,
+/// evict_llc). Each sample renders one frame from the next of `rotation` scene copies (command
+/// stream and path arrays) into the next of as many output buffers, the way a compositor meets
+/// fresh memory every frame. The adapter keeps the native objects it built in Prepare, so they
+/// stay cache-resident unless `evict_bytes` are streamed through the caches before each frame.
+/// Set against the warm `stats` of the same case. A backend that rebuilds per-buffer state when
+/// the output buffer changes (Blend2D binds a context to each buffer, and rebuilds one per frame
+/// beyond 16 rotated buffers) pays that rebuild in every cold sample, so its cold_warm_ratio
+/// measures the rebuild too and is not comparable with other backends'.
+struct ColdBufferStats {
+    int rotation = 0;              ///< Scene copies and buffers rotated through; 0 = not run
+    int64_t evict_bytes = 0;       ///< Streamed before every frame; 0 = no eviction
+    int64_t wall_p50_ns = 0;       ///< Median cold frame wall time
+    int64_t wall_p90_ns = 0;       ///< 90th percentile cold frame wall time
+    int64_t cpu_p50_ns = 0;        ///< Median cold frame CPU time
+    double cold_warm_ratio = 0.0;  ///< wall_p50_ns / stats.wall_p50_ns (warm), see above
+};
+
+/// Spread of a case run BenchmarkPolicy::repetitions times, each on a fresh adapter instance.
+/// Without run-to-run differences between_stddev_ns is about within_stddev_ns / sqrt(samples per
+/// repetition); a larger value means the runs themselves differ (allocator, cache, placement).
+struct RepetitionStats {
+    int count = 0;                     ///< Repetitions run; 0 = single run
+    std::vector<int64_t> wall_p50_ns;  ///< Median wall time of each repetition, in run order
+    double within_stddev_ns = 0.0;     ///< Pooled in-run standard deviation of the wall times
+    double between_stddev_ns = 0.0;    ///< Standard deviation of the repetitions' mean wall times
+};
+
+/// A per-sample counter column, aligned with CaseResult::wall_samples.
+struct SampleCounter {
+    std::string name;             ///< e.g. "minor_faults" (pal::ProcessCounters field names)
+    std::vector<int64_t> values;  ///< Change over each timed sample (a whole batch, not a frame)
 };
 
 /// Execution outcome for a benchmark case.
@@ -51,19 +195,54 @@ enum class CaseDecision {
 };
 
 /// Result for a single benchmark case.
+/// New fields must also be listed in the process-isolation wire format (isolation.cpp).
 struct CaseResult {
     std::string backend_id;
     std::string scene_id;
     std::string scene_hash;
     int width = 0;
     int height = 0;
+    int stride = 0;                ///< Output row stride in bytes the case rendered with
+    int thread_count = 1;          ///< Policy thread count the case ran with (0 = backend default)
+    int batch_frames = 1;          ///< Frames per timed sample; stats are per frame
+    std::string max_isa;           ///< ISA cap the case ran under (IsaLevelName); empty = native
+    std::string sampling_stop;     ///< Adaptive stop reason: ci, max_iterations or time_budget
+    int warmup_frames = 0;         ///< Untimed frames rendered before the measured loop
+    int64_t first_frame_ns = 0;    ///< Wall time of the first (cold) frame; 0 = no warmup
+    int slot = -1;                 ///< Worker slot of a parallel run (CaseScheduler); -1 = serial
+    int first_core = -1;           ///< OS ID of the slot's first CPU; -1 = not pinned
+    int core_count = 0;            ///< CPUs in the slot's core set
 
     CaseDecision decision = CaseDecision::kSkip;
     std::vector<std::string> reasons;
 
     TimingStats stats;
+    ThroughputStats throughput;             ///< Filled only in throughput mode
+    StrokeIsolationStats stroke_isolation;  ///< Filled only with isolate_strokes
+    FlattenStats flattened;                 ///< Filled only with flatten_tolerance > 0
+    RepetitionStats repetitions;            ///< Filled only by RunRepeated with repetitions > 1
+    MultiInstanceStats multi_instance;      ///< Filled only by RunInstances (instances > 0)
+    ColdBufferStats cold_buffers;           ///< Filled only with rotate_buffers or evict_llc
+
+    // Baseline subtraction (set by Harness::ApplyBaseline)
+    std::string baseline_id;      ///< Backend whose timings were subtracted; empty if none
+    int64_t net_wall_p50_ns = 0;  ///< wall_p50_ns minus the baseline's, clamped at 0
+    int64_t net_cpu_p50_ns = 0;   ///< cpu_p50_ns minus the baseline's, clamped at 0
+
+    // Parallel scaling of tiled variants and thread sweeps (set by Harness::ApplyScaling)
+    std::string scaling_reference_id;  ///< Serial inner backend, or the backend itself at 1 thread
+    double speedup_vs_serial = 0.0;    ///< Serial wall_p50_ns / this case's wall_p50_ns
+    double parallel_efficiency = 0.0;  ///< speedup_vs_serial / thread_count (0 if unknown)
+    double serial_fraction = 0.0;      ///< Amdahl fit over the backend's thread counts (0..1)
+
+    // Raw samples of the measured loop in run order (the per-frame values `stats` is made of)
+    std::vector<int64_t> wall_samples;
+    std::vector<int64_t> cpu_samples;
+    std::vector<SampleCounter> sample_counters;  ///< Filled only with sample_counters
 
     // Artifacts
+    std::string pixel_format;  ///< Native format the backend rendered (PixelFormatName)
+    int64_t convert_ns = 0;    ///< Untimed conversion to straight RGBA8 for artifacts/SSIM
     std::string artifact_path;
     std::string golden_path;
     double ssim_score = 0.0;
@@ -71,6 +250,40 @@ struct CaseResult {
     std::string ssim_message;
 };
 
+/// Target duration of one timed sample when BenchmarkPolicy::batch_frames is 0 (auto): long
+/// enough that timer reads and the CPU-time syscall are noise next to the batch.
+inline constexpr int64_t kAutoBatchTargetNs = 1'000'000;
+
+/// Upper bound on automatically chosen batch sizes.
+inline constexpr int kMaxAutoBatchFrames = 1 << 16;
+
+/// Frames of a pipelined throughput run per frame in flight, so the fill and drain of the
+/// pipeline stay a small share of the run.
+inline constexpr int kPipelineFramesPerSlot = 8;
+
+/// Eviction buffer of BenchmarkPolicy::evict_llc, as a multiple of the last-level cache size
+/// (large enough to displace it despite non-LRU replacement).
+inline constexpr double kEvictLlcFactor = 1.5;
+
+/// Eviction buffer size when the last-level cache size is unknown.
+inline constexpr int64_t kEvictFallbackBytes = int64_t{64} << 20;
+
+/// Row alignment of BenchmarkPolicy::pad_stride: one cache line.
+inline constexpr int kStrideAlignBytes = 64;
+
+/// Rows a multiple of this many bytes apart fall on the same few L1 sets and 4 KiB alias
+/// offsets, so column-wise access (vertical edges, tall spans) thrashes; pad_stride adds a
+/// cache line to such strides.
+inline constexpr int kStrideAliasBytes = 1024;
+
+/// Sliding window of BenchmarkPolicy::auto_warmup: the last two windows of frame times are
+/// compared for a downward trend (see WarmupSettled in harness.cpp).
+inline constexpr int kWarmupWindow = 8;
+
+/// Median speed-up between the two windows below which warmup counts as settled even if the
+/// trend test is significant (a slow drift not worth more warmup frames).
+inline constexpr double kWarmupSettleTolerance = 0.05;
+
 /// Full benchmark run result.
 /// Blueprint Reference: [API-01-02] Report schemas (Chapter 4) / [REQ-48] CSV/JSON output (Chapter
 /// 4)
@@ -93,6 +306,90 @@ class Harness {
     static CaseResult RunCase(IBackendAdapter& adapter, const PreparedScene& scene,
                               const BenchmarkPolicy& policy);
 
+    /// Output row stride for `width` pixels with BenchmarkPolicy::pad_stride: width * 4 rounded
+    /// up to kStrideAlignBytes, plus one more cache line when a multiple of kStrideAliasBytes
+    /// (power-of-two widths from 256 px up).
+    [[nodiscard]] static int PaddedStride(int width);
+
+    /// Initialize `adapter` with `args` under the execution controls of `policy`: with
+    /// lock_memory the process memory is locked again (locks do not survive a fork), and with
+    /// worker_cpus the calling thread holds that CPU set while the backend starts its worker
+    /// threads, which inherit it, before moving to orchestrator_cpu for measurement.
+    /// @return The adapter's status, or the mlockall failure.
+    static Status InitializeAdapter(IBackendAdapter& adapter, const AdapterArgs& args,
+                                    const BenchmarkPolicy& policy);
+
+    /// Creates a new, uninitialized adapter instance (e.g. AdapterRegistry::CreateAdapter).
+    using AdapterFactory = std::function<std::unique_ptr<IBackendAdapter>()>;
+
+    /// Run a case policy.repetitions times, each on a fresh adapter from `factory` that is
+    /// initialized with `args`, prepared, measured and shut down, so allocator and cache state
+    /// do not carry over between repetitions. The result is the repetition with the median
+    /// wall_p50_ns, with the spread of all of them in CaseResult::repetitions. A repetition that
+    /// does not execute ends the case with its own result.
+    /// @return Fail with INIT_FAILED if an instance cannot be created or initialized.
+    static CaseResult RunRepeated(const AdapterFactory& factory, const AdapterArgs& args,
+                                  const PreparedScene& scene, const BenchmarkPolicy& policy);
+
+    /// Render concurrently on policy.instances fresh adapters from `factory`, each initialized
+    /// with `args` through InitializeAdapter on its own thread, pinned to its own core (wrapping
+    /// past the available CPU count) and with its own output buffer; instance i renders
+    /// scenes[i % scenes.size()].
+    /// Setup (initialize, prepare, policy.warmup_iterations frames) is serialized on
+    /// LifecycleMutex(), as library initialization is not assumed thread-safe, and happens on
+    /// the pinned thread so the instance's memory is first touched there. All instances then
+    /// start together and render back to back for policy.instance_time_s.
+    /// @param single_frame_ns Single-instance frame time (wall_p50_ns) for scaling_efficiency;
+    /// 0 = unknown.
+    /// @return The first instance failure, as INIT_FAILED/PREPARE_FAILED/RENDER_FAILED status.
+    static Result<MultiInstanceStats> RunInstances(const AdapterFactory& factory,
+                                                   const AdapterArgs& args,
+                                                   const std::vector<const PreparedScene*>& scenes,
+                                                   const BenchmarkPolicy& policy,
+                                                   int64_t single_frame_ns = 0);
+
+    /// A failed result for a case that did not get to run: identity fields of `scene` and
+    /// `policy`, decision kFail and `reason`.
+    static CaseResult FailedCase(const std::string& backend_id, const PreparedScene& scene,
+                                 const BenchmarkPolicy& policy, const std::string& reason);
+
+    /// Process-wide lock held while adapters are created, initialized and shut down by
+    /// concurrent runs (RunRepeated, RunInstances, CaseScheduler): libraries' global setup is
+    /// not assumed thread-safe. Rendering never takes it.
+    static std::mutex& LifecycleMutex();
+
+    /// Fill-only copy of `scene` for stroker isolation: each StrokePath becomes a nonzero fill,
+    /// in the stroke's paint, of the outline adapter.StrokeToPath returns (appended to the path
+    /// table). SetStroke commands are dropped and fill state is restored before the scene's own
+    /// fills, so fills render exactly as before.
+    /// @param stroker_ns If non-null, receives the time spent in StrokeToPath (whole scene).
+    /// @return Unsupported from the adapter, or InvalidArg for a malformed command stream.
+    static Result<PreparedScene> OutlineStrokes(IBackendAdapter& adapter,
+                                                const PreparedScene& scene,
+                                                int64_t* stroker_ns = nullptr);
+
+    /// Subtract a baseline backend's median timings from every executed case of the same scene
+    /// and size, filling CaseResult::net_*_p50_ns. Cases without a matching executed baseline
+    /// (and the baseline's own cases) are left untouched.
+    /// @param results Case results of the run, updated in place.
+    /// @param baseline_id Backend ID used as the baseline (typically "decode").
+    static void ApplyBaseline(std::vector<CaseResult>& results, const std::string& baseline_id);
+
+    /// Compare every executed tiled variant ("<id>:tiled") with the executed serial case of its
+    /// inner backend, and every case run with thread_count > 1 with the same backend's
+    /// single-threaded case (thread sweeps), for the same scene and size, filling
+    /// CaseResult::speedup_vs_serial and CaseResult::parallel_efficiency. Cases of one backend
+    /// and scene at several thread counts also get CaseResult::serial_fraction, the Amdahl
+    /// serial fraction f of speedup = 1 / (f + (1 - f) / threads) fitted by least squares.
+    /// Cases without a serial reference are left untouched.
+    /// @param results Case results of the run, updated in place.
+    static void ApplyScaling(std::vector<CaseResult>& results);
+
+    /// Least-squares Amdahl serial fraction of (thread count, speedup) points, clamped to
+    /// [0, 1]; points with fewer than 2 threads or no speedup are ignored.
+    /// @return 0 if no point qualifies.
+    static double FitSerialFraction(const std::vector<std::pair<int, double>>& points);
+
     /// Check if a scene is compatible with a backend.
     /// @param caps Backend capabilities.
     /// @param required Scene feature requirements.
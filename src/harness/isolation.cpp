@@ -0,0 +1,273 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-08] Benchmark Harness (Chapter 3) / [ARCH-13-01] Run lifecycle
+// state machine (Chapter 3)
+
+#include "harness/isolation.h"
+
+#include "pal/timer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <nlohmann/json.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define VGCPU_HAS_FORK 1
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace vgcpu {
+
+// Field lists of the wire format; a CaseResult field missing here does not survive isolation
+NLOHMANN_JSON_SERIALIZE_ENUM(CaseDecision, {
+                                               {CaseDecision::kExecute, "execute"},
+                                               {CaseDecision::kSkip, "skip"},
+                                               {CaseDecision::kFail, "fail"},
+                                               {CaseDecision::kFallback, "fallback"},
+                                           })
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(
+    TimingStats, wall_p50_ns, wall_p90_ns, cpu_p50_ns, cpu_p90_ns, sample_count, wall_ci_low_ns,
+    wall_ci_high_ns, wall_ci_rel, wall_mean_ns, wall_stddev_ns, wall_min_ns, wall_max_ns,
+    wall_p95_ns, wall_p99_ns, wall_p999_ns, wall_mad_ns, wall_boot_low_ns, wall_boot_high_ns,
+    wall_outliers, wall_far_outliers)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ThroughputStats, pipeline_depth, frame_count, async,
+                                                sustained_fps, latency_p50_ns, latency_p90_ns)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(StrokeIsolationStats, stroke_count, stroker_p50_ns,
+                                                fill_wall_p50_ns, fill_cpu_p50_ns)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(FlattenStats, tolerance, curve_count,
+                                                flatten_p50_ns, wall_p50_ns, cpu_p50_ns)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(RepetitionStats, count, wall_p50_ns,
+                                                within_stddev_ns, between_stddev_ns)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(InstanceStats, core, scene_id, frame_count,
+                                                latency_p50_ns, latency_p90_ns, latency_p99_ns)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(MultiInstanceStats, instance_count, duration_s,
+                                                frame_count, aggregate_fps, scaling_efficiency,
+                                                latency_p50_ns, latency_p99_ns, instances)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(ColdBufferStats, rotation, evict_bytes, wall_p50_ns,
+                                                wall_p90_ns, cpu_p50_ns, cold_warm_ratio)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(SampleCounter, name, values)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(
+    CaseResult, backend_id, scene_id, scene_hash, width, height, stride, thread_count,
+    batch_frames, max_isa, sampling_stop, warmup_frames, first_frame_ns, slot, first_core,
+    core_count, decision, reasons, stats, throughput, stroke_isolation, flattened, repetitions,
+    multi_instance, cold_buffers, baseline_id, net_wall_p50_ns, net_cpu_p50_ns,
+    scaling_reference_id, speedup_vs_serial, parallel_efficiency, serial_fraction, wall_samples,
+    cpu_samples, sample_counters, pixel_format, convert_ns, artifact_path, golden_path, ssim_score,
+    ssim_passed, ssim_message)
+
+namespace {
+
+#if defined(VGCPU_HAS_FORK)
+
+/// Exit code of a child whose work threw.
+constexpr int kChildExceptionExit = 70;
+
+bool WriteAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        const ssize_t written = write(fd, data, size);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+/// How one child ended.
+struct ChildOutcome {
+    std::vector<CaseResult> results;  ///< Decoded results, in order
+    std::string failure;              ///< Reason for the case it was running; empty = clean exit
+};
+
+/// Fork a child running `work` from case `first`, and read its length-prefixed results until it
+/// exits, breaks the protocol or stays silent for `timeout_s`.
+ChildOutcome RunChild(const IsolatedRunner::Work& work, size_t first, double timeout_s) {
+    ChildOutcome outcome;
+    int fds[2];
+    if (pipe(fds) != 0) {
+        outcome.failure = std::string("FORK_FAILED:") + std::strerror(errno);
+        return outcome;
+    }
+
+    // Buffered output would otherwise be written by both processes
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+    const pid_t pid = fork();
+    if (pid < 0) {
+        outcome.failure = std::string("FORK_FAILED:") + std::strerror(errno);
+        close(fds[0]);
+        close(fds[1]);
+        return outcome;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        int code = 0;
+        try {
+            work(first, [&](const CaseResult& result) {
+                const std::string payload = IsolatedRunner::Encode(result);
+                const auto size = static_cast<uint32_t>(payload.size());
+                if (!WriteAll(fds[1], reinterpret_cast<const char*>(&size), sizeof(size)) ||
+                    !WriteAll(fds[1], payload.data(), payload.size())) {
+                    _exit(kChildExceptionExit);
+                }
+            });
+        } catch (...) {
+            code = kChildExceptionExit;
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+        _exit(code);  // No static destructors or atexit handlers of the parent's image
+    }
+    close(fds[1]);
+
+    const auto timeout = std::chrono::duration_cast<pal::Duration>(
+        std::chrono::duration<double>(std::max(0.0, timeout_s)));
+    auto deadline = pal::NowMonotonic() + timeout;
+    std::string buffer;
+    bool timed_out = false;
+    bool corrupt = false;
+    char chunk[65536];
+    for (;;) {
+        int wait_ms = -1;
+        if (timeout_s > 0.0) {
+            const auto left = deadline - pal::NowMonotonic();
+            wait_ms = static_cast<int>(std::max<int64_t>(
+                0, std::chrono::duration_cast<std::chrono::milliseconds>(left).count() + 1));
+        }
+        pollfd pfd{fds[0], POLLIN, 0};
+        const int ready = poll(&pfd, 1, wait_ms);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready == 0) {
+            timed_out = true;
+            break;
+        }
+        const ssize_t got = read(fds[0], chunk, sizeof(chunk));
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            break;  // Child closed the pipe (exited)
+        }
+        buffer.append(chunk, static_cast<size_t>(got));
+
+        // Every complete frame is a finished case and restarts the timeout
+        uint32_t size = 0;
+        while (buffer.size() >= sizeof(size)) {
+            std::memcpy(&size, buffer.data(), sizeof(size));
+            if (buffer.size() - sizeof(size) < size) {
+                break;
+            }
+            auto result = IsolatedRunner::Decode(buffer.substr(sizeof(size), size));
+            buffer.erase(0, sizeof(size) + size);
+            if (result.failed()) {
+                corrupt = true;
+                break;
+            }
+            outcome.results.push_back(std::move(result.value()));
+            deadline = pal::NowMonotonic() + timeout;
+        }
+        if (corrupt) {
+            break;
+        }
+    }
+    if (timed_out || corrupt) {
+        kill(pid, SIGKILL);
+    }
+    close(fds[0]);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {
+    }
+    if (timed_out) {
+        outcome.failure = "TIMEOUT:no result after " + std::to_string(timeout_s) + "s";
+    } else if (corrupt) {
+        outcome.failure = "CHILD_FAILED:malformed result";
+    } else if (WIFSIGNALED(status)) {
+        const char* name = strsignal(WTERMSIG(status));
+        outcome.failure = "CRASHED:" + std::string(name ? name : "signal") + " (" +
+                          std::to_string(WTERMSIG(status)) + ")";
+    } else if (WIFEXITED(status) && WEXITSTATUS(status) != 0) {
+        outcome.failure = "EXITED:status " + std::to_string(WEXITSTATUS(status));
+    }
+    return outcome;
+}
+
+#endif
+
+}  // namespace
+
+bool IsolatedRunner::IsSupported() {
+#if defined(VGCPU_HAS_FORK)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<CaseResult> IsolatedRunner::Run(const std::vector<CaseResult>& expected,
+                                            const Work& work, double timeout_s) {
+    std::vector<CaseResult> results;
+#if defined(VGCPU_HAS_FORK)
+    size_t next = 0;
+    while (next < expected.size()) {
+        auto outcome = RunChild(work, next, timeout_s);
+        for (auto& result : outcome.results) {
+            if (next < expected.size()) {
+                results.push_back(std::move(result));
+                ++next;
+            }
+        }
+        if (outcome.failure.empty() || next == expected.size()) {
+            break;  // Done, or a clean exit that skipped the rest
+        }
+
+        // The case the child was running fails; the next child resumes after it
+        CaseResult failed = expected[next++];
+        failed.decision = CaseDecision::kFail;
+        failed.reasons = {outcome.failure};
+        results.push_back(std::move(failed));
+    }
+#else
+    (void)work;
+    (void)timeout_s;
+    for (auto failed : expected) {
+        failed.decision = CaseDecision::kFail;
+        failed.reasons = {"UNSUPPORTED_FEATURE:process_isolation"};
+        results.push_back(std::move(failed));
+    }
+#endif
+    return results;
+}
+
+std::string IsolatedRunner::Encode(const CaseResult& result) {
+    return nlohmann::json(result).dump();
+}
+
+Result<CaseResult> IsolatedRunner::Decode(const std::string& data) {
+    try {
+        return nlohmann::json::parse(data).get<CaseResult>();
+    } catch (const nlohmann::json::exception& e) {
+        return Status::InvalidArg(std::string("Malformed case result: ") + e.what());
+    }
+}
+
+}  // namespace vgcpu
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-08] Benchmark Harness (Chapter 3) / [ARCH-13-01] Run lifecycle
+// state machine (Chapter 3)
+
+#pragma once
+
+#include "common/status.h"
+#include "harness/harness.h"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace vgcpu {
+
+/// Runs cases in child processes forked from the calling process, the fork server: it holds the
+/// registered backends and prepared scenes but has initialized no backend, so each child starts
+/// from that clean image and heap fragmentation, leaked threads and global state of a backend die
+/// with its child. Results stream back over a pipe one case at a time, so a crash or timeout
+/// fails only the case that was running. POSIX only.
+class IsolatedRunner {
+   public:
+    /// Sends one finished case to the parent.
+    using Emit = std::function<void(const CaseResult&)>;
+
+    /// Runs the cases from index `first` of the run's case list, in order, emitting each.
+    using Work = std::function<void(size_t first, const Emit& emit)>;
+
+    /// True where cases can run in forked children (not on Windows).
+    static bool IsSupported();
+
+    /// Run `work` in a child and collect one result per entry of `expected` (placeholders with
+    /// the cases' identity fields). A child that is killed by a signal, exits with an error or
+    /// reports nothing for `timeout_s` seconds fails the case it was running with CRASHED,
+    /// EXITED or TIMEOUT, and a new child resumes at the next case. Cases a child leaves
+    /// unreported on a clean exit are dropped, as in-process runs skip a backend that fails to
+    /// initialize.
+    /// @param timeout_s Per-case time limit in seconds; 0 = none.
+    static std::vector<CaseResult> Run(const std::vector<CaseResult>& expected, const Work& work,
+                                       double timeout_s);
+
+    /// Wire format of one result (JSON).
+    static std::string Encode(const CaseResult& result);
+
+    /// Parse Encode() output.
+    /// @return InvalidArg if `data` is not an encoded result.
+    static Result<CaseResult> Decode(const std::string& data);
+};
+
+}  // namespace vgcpu
@@ -0,0 +1,135 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-08] Benchmark Harness (Chapter 3) / [DEC-CONC-02] Parallel
+// benchmarking (Chapter 6)
+
+#include "harness/scheduler.h"
+
+#include "pal/affinity.h"
+#include "vgcpu/internal/log.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace vgcpu {
+
+namespace {
+
+bool SameConfiguration(const CaseSpec& a, const CaseSpec& b) {
+    return a.backend_id == b.backend_id && a.args.thread_count == b.args.thread_count &&
+           a.args.max_isa == b.args.max_isa;
+}
+
+/// Run the cases at `indices` in order, reusing an instance per backend configuration.
+void RunSlot(const std::vector<CaseSpec>& cases, const std::vector<size_t>& indices,
+             const CaseScheduler::BackendFactory& factory, std::vector<CaseResult>& results) {
+    std::unique_ptr<IBackendAdapter> adapter;
+    const CaseSpec* configured = nullptr;  // Configuration `adapter` was initialized with
+    Status init_status = Status::Ok();
+    auto shutdown = [&] {
+        if (adapter) {
+            std::lock_guard<std::mutex> lock(Harness::LifecycleMutex());
+            adapter->Shutdown();
+            adapter.reset();
+        }
+        configured = nullptr;
+    };
+
+    for (const size_t index : indices) {
+        const CaseSpec& spec = cases[index];
+
+        // Repetitions each get a fresh instance, so allocator and cache state start over
+        if (spec.policy.repetitions > 1) {
+            shutdown();
+            auto instance = [&] { return factory(spec.backend_id); };
+            results[index] = Harness::RunRepeated(instance, spec.args, *spec.scene, spec.policy);
+            continue;
+        }
+
+        if (configured == nullptr || !SameConfiguration(*configured, spec)) {
+            shutdown();
+            std::lock_guard<std::mutex> lock(Harness::LifecycleMutex());
+            adapter = factory(spec.backend_id);
+            init_status =
+                adapter ? adapter->Initialize(spec.args) : Status::Fail("no adapter instance");
+            if (init_status.failed()) {
+                VGCPU_LOG_WARN("Failed to initialize '" + spec.backend_id +
+                               "': " + init_status.message);
+                adapter.reset();
+            }
+            configured = &spec;
+        }
+        results[index] = adapter ? Harness::RunCase(*adapter, *spec.scene, spec.policy)
+                                 : Harness::FailedCase(spec.backend_id, *spec.scene, spec.policy,
+                                                       "INIT_FAILED:" + init_status.message);
+    }
+    shutdown();
+}
+
+}  // namespace
+
+std::vector<int> CaseScheduler::AssignSlots(const std::vector<CaseSpec>& cases, int jobs) {
+    jobs = std::max(1, jobs);
+    std::map<std::pair<std::string, std::string>, int> groups;
+    std::vector<int> slots;
+    slots.reserve(cases.size());
+    for (const auto& spec : cases) {
+        const auto key = std::make_pair(spec.backend_id, spec.scene->scene_id);
+        const auto group = groups.emplace(key, static_cast<int>(groups.size())).first->second;
+        slots.push_back(group % jobs);
+    }
+    return slots;
+}
+
+std::vector<CaseResult> CaseScheduler::Run(const std::vector<CaseSpec>& cases,
+                                           const BackendFactory& factory,
+                                           const SchedulerConfig& config) {
+    const int jobs = std::max(1, config.jobs);
+    const int cores = std::max(1, config.cores_per_job);
+    std::vector<CaseResult> results(cases.size());
+    const auto slots = AssignSlots(cases, jobs);
+    std::vector<std::vector<size_t>> slot_cases(static_cast<size_t>(jobs));
+    for (size_t i = 0; i < cases.size(); ++i) {
+        slot_cases[static_cast<size_t>(slots[i])].push_back(i);
+    }
+
+    if (jobs == 1) {
+        RunSlot(cases, slot_cases[0], factory, results);
+        return results;
+    }
+
+    // Slots without cases start no thread and no adapter. Each slot records the OS CPU IDs it
+    // ended up on, which differ from the slot's index range under taskset or cpusets.
+    std::vector<std::thread> workers;
+    std::vector<std::vector<int>> pinned(static_cast<size_t>(jobs));
+    for (int slot = 0; slot < jobs; ++slot) {
+        if (slot_cases[static_cast<size_t>(slot)].empty()) {
+            continue;
+        }
+        workers.emplace_back([&, slot] {
+            if (pal::PinCurrentThread(slot * cores, cores)) {
+                pinned[static_cast<size_t>(slot)] = pal::GetAllowedCpus();
+            }
+            RunSlot(cases, slot_cases[static_cast<size_t>(slot)], factory, results);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < cases.size(); ++i) {
+        const auto& cpus = pinned[static_cast<size_t>(slots[i])];
+        results[i].slot = slots[i];
+        if (!cpus.empty()) {
+            results[i].first_core = cpus.front();
+            results[i].core_count = static_cast<int>(cpus.size());
+        }
+    }
+    return results;
+}
+
+}  // namespace vgcpu
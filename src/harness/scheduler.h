@@ -0,0 +1,56 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-08] Benchmark Harness (Chapter 3) / [DEC-CONC-02] Parallel
+// benchmarking (Chapter 6)
+
+#pragma once
+
+#include "adapters/adapter_interface.h"
+#include "harness/harness.h"
+#include "ir/prepared_scene.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vgcpu {
+
+/// One case of a run matrix: a backend configuration and a scene.
+struct CaseSpec {
+    std::string backend_id;
+    AdapterArgs args;                      ///< Thread count and ISA cap the backend runs with
+    BenchmarkPolicy policy;                ///< thread_count and max_isa matching `args`
+    const PreparedScene* scene = nullptr;  ///< Must outlive CaseScheduler::Run
+};
+
+/// Bounded pool of worker slots, each on its own core set.
+struct SchedulerConfig {
+    int jobs = 1;           ///< Worker slots; 1 = run serially on the calling thread, unpinned
+    int cores_per_job = 1;  ///< Slot s owns CPUs [s * cores_per_job, (s + 1) * cores_per_job)
+};
+
+/// Runs independent cases concurrently on disjoint core sets ([DEC-CONC-02]).
+/// Every slot is a thread pinned to its core set (backend worker pools created on it inherit the
+/// set) that runs its cases in matrix order, reusing one adapter instance while consecutive cases
+/// share a backend configuration. Results come back in matrix order whatever the timing.
+class CaseScheduler {
+   public:
+    /// Creates an uninitialized adapter for a backend ID (e.g. AdapterRegistry::CreateAdapter).
+    using BackendFactory = std::function<std::unique_ptr<IBackendAdapter>(const std::string&)>;
+
+    /// Deterministic slot of every case. Cases of one backend and scene share an artifact path
+    /// ([CONC-03-02]), so they go to the same slot and write it in matrix order; these groups are
+    /// dealt round-robin in order of first appearance.
+    static std::vector<int> AssignSlots(const std::vector<CaseSpec>& cases, int jobs);
+
+    /// Run every case (RunCase, or RunRepeated with repetitions > 1) and record its slot and
+    /// the OS CPU IDs its slot was pinned to. An instance that fails to initialize fails its
+    /// cases with INIT_FAILED.
+    static std::vector<CaseResult> Run(const std::vector<CaseSpec>& cases,
+                                       const BackendFactory& factory,
+                                       const SchedulerConfig& config);
+};
+
+}  // namespace vgcpu
@@ -7,6 +7,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <random>
+#include <tuple>
 
 namespace vgcpu {
 
@@ -29,6 +31,116 @@ int64_t ComputePercentile(const std::vector<int64_t>& sorted, double percentile)
                                 static_cast<double>(sorted[upper]) * fraction);
 }
 
+std::pair<int64_t, int64_t> MedianConfidenceInterval(const std::vector<int64_t>& sorted,
+                                                     double z) {
+    if (sorted.empty()) {
+        return {0, 0};
+    }
+    const double n = static_cast<double>(sorted.size());
+    const double spread = z * std::sqrt(n) / 2.0;
+    // 1-based ranks j = floor(n/2 - spread), k = ceil(1 + n/2 + spread)
+    const double j = std::floor(n / 2.0 - spread);
+    const double k = std::ceil(1.0 + n / 2.0 + spread);
+    const auto low = static_cast<size_t>(std::clamp(j, 1.0, n)) - 1;
+    const auto high = static_cast<size_t>(std::clamp(k, 1.0, n)) - 1;
+    return {sorted[low], sorted[high]};
+}
+
+double RelativeMedianCi(const std::vector<int64_t>& sorted, double z) {
+    const int64_t median = ComputePercentile(sorted, 50.0);
+    if (median <= 0) {
+        return 0.0;
+    }
+    const auto [low, high] = MedianConfidenceInterval(sorted, z);
+    return static_cast<double>(high - low) / 2.0 / static_cast<double>(median);
+}
+
+std::pair<int64_t, int64_t> BootstrapMedianInterval(const std::vector<int64_t>& sorted,
+                                                    int resamples) {
+    if (sorted.empty() || resamples <= 0) {
+        return {0, 0};
+    }
+    std::mt19937_64 rng(0x9E3779B97F4A7C15ull);
+    std::uniform_int_distribution<size_t> pick(0, sorted.size() - 1);
+    std::vector<int64_t> resample(sorted.size());
+    std::vector<int64_t> medians;
+    medians.reserve(static_cast<size_t>(resamples));
+    for (int r = 0; r < resamples; ++r) {
+        for (auto& value : resample) {
+            value = sorted[pick(rng)];
+        }
+        // Median by selection: O(n) per resample instead of a full sort
+        const auto mid = resample.begin() + static_cast<ptrdiff_t>(resample.size() / 2);
+        std::nth_element(resample.begin(), mid, resample.end());
+        int64_t median = *mid;
+        if (resample.size() % 2 == 0) {
+            const int64_t lower = *std::max_element(resample.begin(), mid);
+            median = lower + (median - lower) / 2;
+        }
+        medians.push_back(median);
+    }
+    std::sort(medians.begin(), medians.end());
+    return {ComputePercentile(medians, 2.5), ComputePercentile(medians, 97.5)};
+}
+
+int64_t MedianAbsoluteDeviation(const std::vector<int64_t>& sorted) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    const int64_t median = ComputePercentile(sorted, 50.0);
+    std::vector<int64_t> deviations;
+    deviations.reserve(sorted.size());
+    for (const auto value : sorted) {
+        deviations.push_back(value > median ? value - median : median - value);
+    }
+    std::sort(deviations.begin(), deviations.end());
+    return ComputePercentile(deviations, 50.0);
+}
+
+RepetitionStats ComputeRepetitionStats(const std::vector<TimingStats>& runs) {
+    RepetitionStats stats;
+    stats.count = static_cast<int>(runs.size());
+    double pooled_ss = 0.0;
+    double pooled_df = 0.0;
+    double mean_sum = 0.0;
+    for (const auto& run : runs) {
+        stats.wall_p50_ns.push_back(run.wall_p50_ns);
+        const double df = std::max(0, run.sample_count - 1);
+        pooled_ss += df * run.wall_stddev_ns * run.wall_stddev_ns;
+        pooled_df += df;
+        mean_sum += run.wall_mean_ns;
+    }
+    if (pooled_df > 0.0) {
+        stats.within_stddev_ns = std::sqrt(pooled_ss / pooled_df);
+    }
+    if (runs.size() > 1) {
+        const double grand_mean = mean_sum / static_cast<double>(runs.size());
+        double ss = 0.0;
+        for (const auto& run : runs) {
+            ss += (run.wall_mean_ns - grand_mean) * (run.wall_mean_ns - grand_mean);
+        }
+        stats.between_stddev_ns = std::sqrt(ss / static_cast<double>(runs.size() - 1));
+    }
+    return stats;
+}
+
+double MannKendallZ(const std::vector<int64_t>& samples) {
+    const size_t n = samples.size();
+    if (n < 3) {
+        return 0.0;
+    }
+    int64_t s = 0;
+    for (size_t i = 0; i + 1 < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            s += (samples[j] > samples[i]) - (samples[j] < samples[i]);
+        }
+    }
+    const double count = static_cast<double>(n);
+    const double variance = count * (count - 1.0) * (2.0 * count + 5.0) / 18.0;
+    const double corrected = static_cast<double>(s > 0 ? s - 1 : (s < 0 ? s + 1 : 0));
+    return corrected / std::sqrt(variance);
+}
+
 TimingStats ComputeStats(std::vector<int64_t>& wall_samples, std::vector<int64_t>& cpu_samples) {
     TimingStats stats;
 
@@ -50,6 +162,49 @@ TimingStats ComputeStats(std::vector<int64_t>& wall_samples, std::vector<int64_t
     stats.cpu_p50_ns = ComputePercentile(cpu_samples, 50.0);
     stats.cpu_p90_ns = ComputePercentile(cpu_samples, 90.0);
 
+    // Precision of the median (what adaptive sampling converges on)
+    std::tie(stats.wall_ci_low_ns, stats.wall_ci_high_ns) = MedianConfidenceInterval(wall_samples);
+    stats.wall_ci_rel = RelativeMedianCi(wall_samples);
+
+    // Moments, for splitting variance into in-run and run-to-run parts
+    double sum = 0.0;
+    for (const auto sample : wall_samples) {
+        sum += static_cast<double>(sample);
+    }
+    stats.wall_mean_ns = sum / static_cast<double>(wall_samples.size());
+    if (wall_samples.size() > 1) {
+        double ss = 0.0;
+        for (const auto sample : wall_samples) {
+            const double d = static_cast<double>(sample) - stats.wall_mean_ns;
+            ss += d * d;
+        }
+        stats.wall_stddev_ns = std::sqrt(ss / static_cast<double>(wall_samples.size() - 1));
+    }
+
+    // Tail latency and robust dispersion
+    stats.wall_min_ns = wall_samples.front();
+    stats.wall_max_ns = wall_samples.back();
+    stats.wall_p95_ns = ComputePercentile(wall_samples, 95.0);
+    stats.wall_p99_ns = ComputePercentile(wall_samples, 99.0);
+    stats.wall_p999_ns = ComputePercentile(wall_samples, 99.9);
+    stats.wall_mad_ns = MedianAbsoluteDeviation(wall_samples);
+    std::tie(stats.wall_boot_low_ns, stats.wall_boot_high_ns) =
+        BootstrapMedianInterval(wall_samples);
+
+    // Tukey fences on the quartiles
+    const auto q1 = static_cast<double>(ComputePercentile(wall_samples, 25.0));
+    const auto q3 = static_cast<double>(ComputePercentile(wall_samples, 75.0));
+    const double iqr = q3 - q1;
+    for (const auto sample : wall_samples) {
+        const auto value = static_cast<double>(sample);
+        if (value < q1 - 1.5 * iqr || value > q3 + 1.5 * iqr) {
+            ++stats.wall_outliers;
+        }
+        if (value < q1 - 3.0 * iqr || value > q3 + 3.0 * iqr) {
+            ++stats.wall_far_outliers;
+        }
+    }
+
     return stats;
 }
 
@@ -8,6 +8,7 @@
 #include "harness/harness.h"
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace vgcpu {
@@ -22,4 +23,39 @@ TimingStats ComputeStats(std::vector<int64_t>& wall_samples, std::vector<int64_t
 /// Compute the median (p50) of a sorted array.
 int64_t ComputePercentile(const std::vector<int64_t>& sorted, double percentile);
 
+/// Two-sided 95% normal quantile.
+inline constexpr double kZ95 = 1.959964;
+
+/// Distribution-free confidence interval of the median of a sorted array: the order statistics
+/// n/2 -/+ z*sqrt(n)/2 (normal approximation to the binomial), clamped to the sample range.
+/// @return {low, high}; {0, 0} for an empty array.
+std::pair<int64_t, int64_t> MedianConfidenceInterval(const std::vector<int64_t>& sorted,
+                                                     double z = kZ95);
+
+/// Half-width of MedianConfidenceInterval relative to the median; 0 when the median is 0.
+double RelativeMedianCi(const std::vector<int64_t>& sorted, double z = kZ95);
+
+/// Bootstrap resamples behind TimingStats::wall_boot_*; the generator has a fixed seed, so
+/// identical samples always give identical intervals.
+inline constexpr int kBootstrapResamples = 1000;
+
+/// 95% bootstrap percentile interval of the median of a sorted array: the 2.5th and 97.5th
+/// percentiles of the medians of `resamples` resamples drawn with replacement.
+/// @return {low, high}; {0, 0} for an empty array.
+std::pair<int64_t, int64_t> BootstrapMedianInterval(const std::vector<int64_t>& sorted,
+                                                    int resamples = kBootstrapResamples);
+
+/// Median absolute deviation of a sorted array from its median (not scaled to sigma).
+int64_t MedianAbsoluteDeviation(const std::vector<int64_t>& sorted);
+
+/// Within- and between-repetition spread of one case's repetitions (one-way ANOVA terms on
+/// the wall times): pooled in-run standard deviation and standard deviation of the run means.
+/// @param runs Statistics of each repetition, in run order.
+RepetitionStats ComputeRepetitionStats(const std::vector<TimingStats>& runs);
+
+/// Mann-Kendall trend test on samples in time order: the normal-approximation z score of
+/// S = sum of sign(x[j] - x[i]) over i < j (continuity corrected, ties not adjusted).
+/// Below -kZ95 the samples are getting significantly smaller; 0 for fewer than 3 samples.
+double MannKendallZ(const std::vector<int64_t>& samples);
+
 }  // namespace vgcpu
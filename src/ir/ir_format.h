@@ -73,6 +73,29 @@ enum class Opcode : uint8_t {
     kStrokePath = 0x41,    ///< Stroke path at index (path_id:u16)
 };
 
+/// Payload size in bytes of a command, or -1 for an unknown opcode.
+inline int CommandPayloadSize(Opcode op) {
+    switch (op) {
+        case Opcode::kEnd:
+        case Opcode::kSave:
+        case Opcode::kRestore:
+            return 0;
+        case Opcode::kClear:
+            return 4;
+        case Opcode::kSetMatrix:
+        case Opcode::kConcatMatrix:
+            return 24;
+        case Opcode::kSetFill:
+            return 3;
+        case Opcode::kSetStroke:
+            return 7;
+        case Opcode::kFillPath:
+        case Opcode::kStrokePath:
+            return 2;
+    }
+    return -1;
+}
+
 /// Fill rule encoding (u8 in SetFill).
 /// Blueprint Reference: [ARCH-10-05] IR Loader / Decoder (Chapter 3) / [ARCH-14-B] SetFill (Chapter
 /// 3)
@@ -0,0 +1,334 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-12-01d] PreparedScene (Chapter 3) / [API-06-04] PrepareScene (Chapter
+// 4)
+
+#include "ir/path_flattener.h"
+
+#include "ir/ir_format.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+#define VGCPU_FLATTEN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define VGCPU_FLATTEN_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace vgcpu {
+namespace ir {
+
+namespace {
+
+/// One coordinate of a curve in power basis: ((a * t + b) * t + c) * t + d.
+struct Poly {
+    float a = 0.0f;
+    float b = 0.0f;
+    float c = 0.0f;
+    float d = 0.0f;
+};
+
+/// Segment count from Wang's formula: n = sqrt(d(d-1)/8 * L / tol), where L is the largest
+/// second difference of the control polygon.
+int CurveSegments(float degree_factor, float dd, float tolerance) {
+    const float n = std::ceil(std::sqrt(degree_factor * dd / tolerance));
+    if (!(n >= 1.0f)) {
+        return 1;  // Also catches NaN
+    }
+    return n >= static_cast<float>(kMaxFlattenSegments) ? kMaxFlattenSegments
+                                                        : static_cast<int>(n);
+}
+
+/// Write points i = first..n of t = i * dt as interleaved x, y pairs to `out`.
+void EvalScalar(const Poly& x, const Poly& y, int first, int n, float dt, float* out) {
+    for (int i = first; i <= n; ++i, out += 2) {
+        const float t = static_cast<float>(i) * dt;
+        out[0] = ((x.a * t + x.b) * t + x.c) * t + x.d;
+        out[1] = ((y.a * t + y.b) * t + y.c) * t + y.d;
+    }
+}
+
+#if defined(VGCPU_FLATTEN_SSE2)
+
+/// Vector part of EvalScalar starting at i = 1; returns the first index left for the tail.
+int EvalSimd(const Poly& x, const Poly& y, int n, float dt, float* out) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128i lanes = _mm_setr_epi32(0, 1, 2, 3);
+    auto horner = [](const Poly& p, __m128 t) {
+        __m128 v = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p.a), t), _mm_set1_ps(p.b));
+        v = _mm_add_ps(_mm_mul_ps(v, t), _mm_set1_ps(p.c));
+        return _mm_add_ps(_mm_mul_ps(v, t), _mm_set1_ps(p.d));
+    };
+
+    int i = 1;
+    for (; i + 3 <= n; i += 4, out += 8) {
+        const __m128 t =
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(i), lanes)), vdt);
+        const __m128 px = horner(x, t);
+        const __m128 py = horner(y, t);
+        _mm_storeu_ps(out, _mm_unpacklo_ps(px, py));
+        _mm_storeu_ps(out + 4, _mm_unpackhi_ps(px, py));
+    }
+    return i;
+}
+
+#elif defined(VGCPU_FLATTEN_NEON)
+
+int EvalSimd(const Poly& x, const Poly& y, int n, float dt, float* out) {
+    const float32x4_t vdt = vdupq_n_f32(dt);
+    const int32_t lane_init[4] = {0, 1, 2, 3};
+    const int32x4_t lanes = vld1q_s32(lane_init);
+    auto horner = [](const Poly& p, float32x4_t t) {
+        float32x4_t v = vaddq_f32(vmulq_f32(vdupq_n_f32(p.a), t), vdupq_n_f32(p.b));
+        v = vaddq_f32(vmulq_f32(v, t), vdupq_n_f32(p.c));
+        return vaddq_f32(vmulq_f32(v, t), vdupq_n_f32(p.d));
+    };
+
+    int i = 1;
+    for (; i + 3 <= n; i += 4, out += 8) {
+        const float32x4_t t = vmulq_f32(vcvtq_f32_s32(vaddq_s32(vdupq_n_s32(i), lanes)), vdt);
+        float32x4x2_t xy;
+        xy.val[0] = horner(x, t);
+        xy.val[1] = horner(y, t);
+        vst2q_f32(out, xy);  // Interleaves x, y
+    }
+    return i;
+}
+
+#endif
+
+/// Append the points of a curve after its start point (t = 1/n .. 1) as line segments.
+void AppendCurve(const Poly& x, const Poly& y, int n, float end_x, float end_y, Path& out) {
+    const size_t base = out.points.size();
+    out.points.resize(base + static_cast<size_t>(n) * 2);
+    out.verbs.insert(out.verbs.end(), static_cast<size_t>(n), PathVerb::kLineTo);
+
+    float* dst = out.points.data() + base;
+    const float dt = 1.0f / static_cast<float>(n);
+    int first = 1;
+#if defined(VGCPU_FLATTEN_SSE2) || defined(VGCPU_FLATTEN_NEON)
+    first = EvalSimd(x, y, n, dt, dst);
+#endif
+    EvalScalar(x, y, first, n, dt, dst + static_cast<size_t>(first - 1) * 2);
+
+    // Keep endpoints exact so closed contours and joins line up
+    dst[static_cast<size_t>(n) * 2 - 2] = end_x;
+    dst[static_cast<size_t>(n) * 2 - 1] = end_y;
+}
+
+}  // namespace
+
+float MaxScale(const std::array<float, 4>& m) {
+    const float sum = m[0] * m[0] + m[1] * m[1] + m[2] * m[2] + m[3] * m[3];
+    const float det = m[0] * m[3] - m[1] * m[2];
+    const float disc = std::sqrt(std::max(0.0f, sum * sum - 4.0f * det * det));
+    return std::sqrt((sum + disc) * 0.5f);
+}
+
+Path FlattenPath(const Path& path, float tolerance, int* curve_count) {
+    Path out;
+    out.verbs.reserve(path.verbs.size());
+    out.points.reserve(path.points.size());
+    FlattenPathInto(path, tolerance, out, curve_count);
+    return out;
+}
+
+void FlattenPathInto(const Path& path, float tolerance, Path& out, int* curve_count) {
+    const size_t point_count = path.points.size() / 2;
+    const float* pts = path.points.data();
+    size_t pt = 0;  // Next point index
+    float cur_x = 0.0f;
+    float cur_y = 0.0f;
+    float start_x = 0.0f;  // First point of the current contour
+    float start_y = 0.0f;
+    auto emit = [&](PathVerb verb, size_t index) {
+        cur_x = pts[index * 2];
+        cur_y = pts[index * 2 + 1];
+        out.verbs.push_back(verb);
+        out.points.push_back(cur_x);
+        out.points.push_back(cur_y);
+    };
+
+    for (const auto verb : path.verbs) {
+        switch (verb) {
+            case PathVerb::kMoveTo:
+            case PathVerb::kLineTo:
+                if (pt + 1 > point_count) {
+                    return;
+                }
+                emit(verb, pt++);
+                if (verb == PathVerb::kMoveTo) {
+                    start_x = cur_x;
+                    start_y = cur_y;
+                }
+                break;
+
+            case PathVerb::kQuadTo: {
+                if (pt + 2 > point_count) {
+                    return;
+                }
+                const float* p = pts + pt * 2;
+                const float ddx = cur_x - 2.0f * p[0] + p[2];
+                const float ddy = cur_y - 2.0f * p[1] + p[3];
+                const int n = CurveSegments(0.25f, std::hypot(ddx, ddy), tolerance);
+                const Poly x{0.0f, ddx, 2.0f * (p[0] - cur_x), cur_x};
+                const Poly y{0.0f, ddy, 2.0f * (p[1] - cur_y), cur_y};
+                AppendCurve(x, y, n, p[2], p[3], out);
+                cur_x = p[2];
+                cur_y = p[3];
+                pt += 2;
+                if (curve_count) {
+                    ++*curve_count;
+                }
+                break;
+            }
+
+            case PathVerb::kCubicTo: {
+                if (pt + 3 > point_count) {
+                    return;
+                }
+                const float* p = pts + pt * 2;
+                const float dd0 =
+                    std::hypot(cur_x - 2.0f * p[0] + p[2], cur_y - 2.0f * p[1] + p[3]);
+                const float dd1 = std::hypot(p[0] - 2.0f * p[2] + p[4], p[1] - 2.0f * p[3] + p[5]);
+                const int n = CurveSegments(0.75f, std::max(dd0, dd1), tolerance);
+                const Poly x{-cur_x + 3.0f * (p[0] - p[2]) + p[4],
+                             3.0f * (cur_x - 2.0f * p[0] + p[2]), 3.0f * (p[0] - cur_x), cur_x};
+                const Poly y{-cur_y + 3.0f * (p[1] - p[3]) + p[5],
+                             3.0f * (cur_y - 2.0f * p[1] + p[3]), 3.0f * (p[1] - cur_y), cur_y};
+                AppendCurve(x, y, n, p[4], p[5], out);
+                cur_x = p[4];
+                cur_y = p[5];
+                pt += 3;
+                if (curve_count) {
+                    ++*curve_count;
+                }
+                break;
+            }
+
+            case PathVerb::kClose:
+                // A curve after kClose starts from the closed contour's start point
+                out.verbs.push_back(PathVerb::kClose);
+                cur_x = start_x;
+                cur_y = start_y;
+                break;
+        }
+    }
+}
+
+Result<std::vector<float>> PathScales(const PreparedScene& scene) {
+    // Linear part of the CTM only; translation does not change the flattening error
+    using Linear = std::array<float, 4>;
+    std::vector<float> path_scale(scene.paths.size(), 0.0f);
+    Linear ctm = {1.0f, 0.0f, 0.0f, 1.0f};
+    std::vector<Linear> stack;
+
+    const uint8_t* ptr = scene.command_stream.data();
+    const uint8_t* end = ptr + scene.command_stream.size();
+    while (ptr < end) {
+        const auto op = static_cast<Opcode>(*ptr++);
+        const int size = CommandPayloadSize(op);
+        if (size < 0) {
+            return Status::InvalidArg("Unknown opcode in command stream");
+        }
+        if (end - ptr < size) {
+            return Status::InvalidArg("Truncated command in command stream");
+        }
+
+        switch (op) {
+            case Opcode::kSave:
+                stack.push_back(ctm);
+                break;
+            case Opcode::kRestore:
+                if (!stack.empty()) {
+                    ctm = stack.back();
+                    stack.pop_back();
+                }
+                break;
+            case Opcode::kSetMatrix:
+            case Opcode::kConcatMatrix: {
+                float m[6];
+                std::memcpy(m, ptr, sizeof(m));
+                if (op == Opcode::kSetMatrix) {
+                    ctm = {m[0], m[1], m[2], m[3]};
+                } else {
+                    ctm = {ctm[0] * m[0] + ctm[2] * m[1], ctm[1] * m[0] + ctm[3] * m[1],
+                           ctm[0] * m[2] + ctm[2] * m[3], ctm[1] * m[2] + ctm[3] * m[3]};
+                }
+                break;
+            }
+            case Opcode::kFillPath:
+            case Opcode::kStrokePath: {
+                uint16_t path_id = 0;
+                std::memcpy(&path_id, ptr, sizeof(path_id));
+                if (path_id < path_scale.size()) {
+                    path_scale[path_id] = std::max(path_scale[path_id], MaxScale(ctm));
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        ptr += size;
+        if (op == Opcode::kEnd) {
+            break;
+        }
+    }
+
+    for (auto& scale : path_scale) {
+        if (!(scale > 0.0f)) {
+            scale = 1.0f;  // Undrawn or degenerate
+        }
+    }
+    return path_scale;
+}
+
+int FlattenPaths(const std::vector<Path>& paths, const std::vector<float>& scales,
+                 float tolerance, std::vector<Path>& out) {
+    int curves = 0;
+    for (size_t i = 0; i < paths.size() && i < out.size(); ++i) {
+        const float scale = i < scales.size() ? scales[i] : 1.0f;
+        out[i].verbs.clear();
+        out[i].points.clear();
+        FlattenPathInto(paths[i], tolerance / scale, out[i], &curves);
+    }
+    return curves;
+}
+
+Result<PreparedScene> FlattenScene(const PreparedScene& scene, float tolerance,
+                                   int* curve_count) {
+    if (!(tolerance > 0.0f)) {
+        return Status::InvalidArg("Flattening tolerance must be positive");
+    }
+    auto scales = PathScales(scene);
+    if (scales.failed()) {
+        return scales.status();
+    }
+
+    PreparedScene out = scene;
+    const int curves = FlattenPaths(scene.paths, scales.value(), tolerance, out.paths);
+    if (curve_count) {
+        *curve_count = curves;
+    }
+    return out;
+}
+
+const char* FlattenIsa() {
+#if defined(VGCPU_FLATTEN_SSE2)
+    return "sse2";
+#elif defined(VGCPU_FLATTEN_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}  // namespace ir
+}  // namespace vgcpu
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-12-01d] PreparedScene (Chapter 3) / [API-06-04] PrepareScene (Chapter
+// 4)
+
+#pragma once
+
+#include "common/status.h"
+#include "ir/prepared_scene.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace vgcpu {
+namespace ir {
+
+/// Default flattening tolerance in device pixels (same as the decode baseline and vgcpu_ref).
+inline constexpr float kDefaultFlattenTolerance = 0.25f;
+
+/// Upper bound on line segments per curve, guards against degenerate control points.
+inline constexpr int kMaxFlattenSegments = 1024;
+
+/// Replace every quad and cubic of `path` with line segments that stay within `tolerance` of
+/// the curve (segment counts from Wang's formula). Points on each curve are evaluated four at a
+/// time in power-basis form with SSE2 or NEON when available. Curve endpoints are kept exact.
+/// @param curve_count If non-null, incremented by the number of curves replaced.
+Path FlattenPath(const Path& path, float tolerance, int* curve_count = nullptr);
+
+/// FlattenPath appending to `out`, so a caller flattening every frame reuses its capacity.
+void FlattenPathInto(const Path& path, float tolerance, Path& out, int* curve_count = nullptr);
+
+/// Largest stretch (major singular value) of the linear part {a, b, c, d} of an IR matrix.
+/// Dividing a device-space tolerance by it gives the user-space tolerance of a transformed path.
+[[nodiscard]] float MaxScale(const std::array<float, 4>& linear);
+
+/// Largest scale each path of `scene` is drawn with, from the linear part of the CTM at every
+/// FillPath/StrokePath; 1 for undrawn paths and degenerate transforms.
+/// @return InvalidArg for a malformed command stream.
+Result<std::vector<float>> PathScales(const PreparedScene& scene);
+
+/// Flatten paths[i] into out[i] at `tolerance / scales[i]`, reusing the capacity of `out`
+/// (sized to match `paths`). This is the per-scene work FlattenScene times apart from copying.
+/// @return Number of curves replaced.
+int FlattenPaths(const std::vector<Path>& paths, const std::vector<float>& scales,
+                 float tolerance, std::vector<Path>& out);
+
+/// Copy of `scene` whose paths contain only move/line/close verbs, for timing backends without
+/// their curve subdivision. `tolerance` is in device pixels: each path is flattened for the
+/// largest scale any of its draws applies, so transformed instances stay within tolerance.
+/// The command stream is unchanged.
+/// @param curve_count If non-null, receives the number of curves replaced in the whole scene.
+/// @return InvalidArg for a non-positive tolerance or a malformed command stream.
+Result<PreparedScene> FlattenScene(const PreparedScene& scene, float tolerance,
+                                   int* curve_count = nullptr);
+
+/// Instruction set used to evaluate curve points ("sse2", "neon" or "scalar").
+const char* FlattenIsa();
+
+}  // namespace ir
+}  // namespace vgcpu
@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#include "pal/affinity.h"
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace vgcpu {
+namespace pal {
+
+namespace {
+
+/// Upper bound on CPU IDs in a parsed list (Linux CPU_SETSIZE), against runaway ranges.
+constexpr int kMaxCpuId = 1024;
+
+}  // namespace
+
+int GetAvailableCpuCount() {
+#if defined(__linux__)
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        return CPU_COUNT(&set) > 0 ? CPU_COUNT(&set) : 1;
+    }
+#endif
+    const unsigned count = std::thread::hardware_concurrency();
+    return count > 0 ? static_cast<int>(count) : 1;
+}
+
+bool PinCurrentThread(int first_cpu, int cpu_count) {
+    if (first_cpu < 0 || cpu_count < 1) {
+        return false;
+    }
+#if defined(__linux__)
+    // Map the indices onto the CPUs the process is allowed on (taskset, cgroup cpusets)
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    int seen = 0;
+    for (int id = 0; id < CPU_SETSIZE && seen < first_cpu + cpu_count; ++id) {
+        if (CPU_ISSET(id, &allowed) && seen++ >= first_cpu) {
+            CPU_SET(id, &set);
+        }
+    }
+    if (CPU_COUNT(&set) != cpu_count) {
+        return false;
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;  // 0 = calling thread
+#elif defined(_WIN32)
+    if (first_cpu + cpu_count > static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+        return false;  // Beyond the first processor group
+    }
+    DWORD_PTR mask = 0;
+    for (int cpu = first_cpu; cpu < first_cpu + cpu_count; ++cpu) {
+        mask |= DWORD_PTR{1} << cpu;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+    return false;  // macOS only offers affinity hints
+#endif
+}
+
+std::vector<int> GetAllowedCpus() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int id = 0; id < CPU_SETSIZE; ++id) {
+            if (CPU_ISSET(id, &set)) {
+                cpus.push_back(id);
+            }
+        }
+    }
+#elif defined(_WIN32)
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask)) {
+        for (int id = 0; id < static_cast<int>(sizeof(DWORD_PTR) * 8); ++id) {
+            if (process_mask & (DWORD_PTR{1} << id)) {
+                cpus.push_back(id);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+std::optional<std::vector<int>> ParseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        const auto dash = range.find('-');
+        int first = 0;
+        int last = 0;
+        try {
+            size_t used = 0;
+            first = std::stoi(range.substr(0, dash), &used);
+            if (used != (dash == std::string::npos ? range.size() : dash)) {
+                return std::nullopt;
+            }
+            last = first;
+            if (dash != std::string::npos) {
+                last = std::stoi(range.substr(dash + 1), &used);
+                if (used != range.size() - dash - 1) {
+                    return std::nullopt;
+                }
+            }
+        } catch (...) {
+            return std::nullopt;
+        }
+        if (first < 0 || last < first || last >= kMaxCpuId) {
+            return std::nullopt;
+        }
+        for (int id = first; id <= last; ++id) {
+            cpus.push_back(id);
+        }
+    }
+    if (cpus.empty()) {
+        return std::nullopt;
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+bool PinCurrentThreadToCpus(const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return false;
+    }
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int id : cpus) {
+        if (id < 0 || id >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(id, &set);
+    }
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#elif defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (const int id : cpus) {
+        if (id < 0 || id >= static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+            return false;  // Beyond the first processor group
+        }
+        mask |= DWORD_PTR{1} << id;
+    }
+    return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#else
+    return false;
+#endif
+}
+
+}  // namespace pal
+}  // namespace vgcpu
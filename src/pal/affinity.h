@@ -0,0 +1,38 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vgcpu {
+namespace pal {
+
+/// Number of logical CPUs the process may run on (at least 1).
+[[nodiscard]] int GetAvailableCpuCount();
+
+/// Restrict the calling thread to `cpu_count` logical CPUs from `first_cpu` on (0-based, in the
+/// order of the process's allowed CPUs). Threads it creates afterwards inherit the set on Linux.
+/// Returns false where unsupported (macOS), if the range exceeds the allowed CPUs or if the OS
+/// refuses.
+bool PinCurrentThread(int first_cpu, int cpu_count = 1);
+
+/// OS IDs of the logical CPUs the calling thread may run on, ascending. Empty where the OS does
+/// not report them (macOS).
+[[nodiscard]] std::vector<int> GetAllowedCpus();
+
+/// Parse a CPU list in taskset/cpuset syntax ("0-3,8"): OS CPU IDs, ascending and unique.
+/// nullopt if malformed or empty.
+[[nodiscard]] std::optional<std::vector<int>> ParseCpuList(const std::string& list);
+
+/// Restrict the calling thread to the given OS CPU IDs (as in GetAllowedCpus, not indices).
+/// Threads it creates afterwards inherit the set on Linux. Returns false where unsupported
+/// (macOS), for an empty or out-of-range list or if the OS refuses.
+bool PinCurrentThreadToCpus(const std::vector<int>& cpus);
+
+}  // namespace pal
+}  // namespace vgcpu
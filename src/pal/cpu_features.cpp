@@ -0,0 +1,215 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+// Blueprint Reference: [ARCH-12-02d] RunReport environment metadata (Chapter 3)
+
+#include "pal/cpu_features.h"
+
+#include "vgcpu/internal/export.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define VGCPU_PAL_X86 1
+#if defined(VGCPU_COMPILER_MSVC)
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define VGCPU_PAL_ARM64 1
+#endif
+
+#if defined(__linux__)
+#include <fstream>
+#include <string>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#include <sys/types.h>
+#endif
+
+namespace vgcpu {
+namespace pal {
+
+namespace {
+
+#if defined(VGCPU_PAL_X86) && defined(VGCPU_COMPILER_MSVC)
+
+CpuFeatures DetectX86() {
+    CpuFeatures f;
+    int regs[4];
+    __cpuid(regs, 0);
+    const int max_leaf = regs[0];
+    __cpuid(regs, 1);
+    f.sse2 = (regs[3] & (1 << 26)) != 0;
+    f.sse4_2 = (regs[2] & (1 << 20)) != 0;
+
+    // AVX and AVX-512 also need the OS to save their register state (XCR0)
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool avx = (regs[2] & (1 << 28)) != 0;
+    const unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+    const bool ymm_state = (xcr0 & 0x6) == 0x6;
+    const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+    if (max_leaf >= 7) {
+        __cpuidex(regs, 7, 0);
+        f.avx2 = avx && ymm_state && (regs[1] & (1 << 5)) != 0;
+        const int avx512_fbwdqvl = (1 << 16) | (1 << 30) | (1 << 17) | (1 << 31);
+        f.avx512 = f.avx2 && zmm_state && (regs[1] & avx512_fbwdqvl) == avx512_fbwdqvl;
+    }
+    return f;
+}
+
+#elif defined(VGCPU_PAL_X86)
+
+CpuFeatures DetectX86() {
+    // The builtins check XCR0 for AVX/AVX-512 register state as well as CPUID
+    __builtin_cpu_init();
+    CpuFeatures f;
+    f.sse2 = __builtin_cpu_supports("sse2");
+    f.sse4_2 = __builtin_cpu_supports("sse4.2");
+    f.avx2 = __builtin_cpu_supports("avx2");
+    f.avx512 = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+               __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+    return f;
+}
+
+#endif
+
+CpuFeatures Detect() {
+#if defined(VGCPU_PAL_X86)
+    return DetectX86();
+#elif defined(VGCPU_PAL_ARM64)
+    CpuFeatures f;
+    f.neon = true;  // Mandatory on AArch64
+    return f;
+#else
+    return {};
+#endif
+}
+
+}  // namespace
+
+const CpuFeatures& DetectCpuFeatures() {
+    static const CpuFeatures features = Detect();
+    return features;
+}
+
+std::vector<std::string> CpuFeatureNames(const CpuFeatures& features) {
+    std::vector<std::string> names;
+    if (features.sse2) {
+        names.emplace_back("sse2");
+    }
+    if (features.sse4_2) {
+        names.emplace_back("sse4.2");
+    }
+    if (features.avx2) {
+        names.emplace_back("avx2");
+    }
+    if (features.avx512) {
+        names.emplace_back("avx512");
+    }
+    if (features.neon) {
+        names.emplace_back("neon");
+    }
+    return names;
+}
+
+int64_t GetLastLevelCacheBytes() {
+    int64_t bytes = 0;
+#if defined(__linux__)
+    // index0..N, sizes like "32K" or "307200K"; the highest level is the last-level cache
+    int best_level = 0;
+    for (int index = 0;; ++index) {
+        const std::string dir =
+            "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::ifstream level_file(dir + "level");
+        std::ifstream size_file(dir + "size");
+        int level = 0;
+        int64_t size = 0;
+        std::string unit;
+        if (!(level_file >> level) || !(size_file >> size)) {
+            break;
+        }
+        size_file >> unit;
+        const int64_t scale = unit == "K" ? 1024 : unit == "M" ? 1024 * 1024 : 1;
+        if (level >= best_level) {
+            best_level = level;
+            bytes = size * scale;
+        }
+    }
+#elif defined(__APPLE__)
+    for (const char* name : {"hw.l3cachesize", "hw.l2cachesize"}) {
+        int64_t size = 0;
+        size_t length = sizeof(size);
+        if (sysctlbyname(name, &size, &length, nullptr, 0) == 0 && size > 0) {
+            bytes = size;
+            break;
+        }
+    }
+#endif
+    return bytes;
+}
+
+IsaLevel HighestIsaLevel() {
+    for (auto level :
+         {IsaLevel::kAvx512, IsaLevel::kAvx2, IsaLevel::kSse42, IsaLevel::kSse2, IsaLevel::kNeon}) {
+        if (IsIsaLevelAvailable(level)) {
+            return level;
+        }
+    }
+    return IsaLevel::kScalar;
+}
+
+bool IsIsaLevelAvailable(IsaLevel level) {
+    const CpuFeatures& f = DetectCpuFeatures();
+    switch (level) {
+        case IsaLevel::kScalar:
+            return true;
+        case IsaLevel::kSse2:
+            return f.sse2;
+        case IsaLevel::kSse42:
+            return f.sse2 && f.sse4_2;
+        case IsaLevel::kAvx2:
+            return f.sse4_2 && f.avx2;
+        case IsaLevel::kAvx512:
+            return f.avx2 && f.avx512;
+        case IsaLevel::kNeon:
+            return f.neon;
+    }
+    return false;
+}
+
+const char* IsaLevelName(IsaLevel level) {
+    switch (level) {
+        case IsaLevel::kScalar:
+            return "scalar";
+        case IsaLevel::kSse2:
+            return "sse2";
+        case IsaLevel::kSse42:
+            return "sse4.2";
+        case IsaLevel::kAvx2:
+            return "avx2";
+        case IsaLevel::kAvx512:
+            return "avx512";
+        case IsaLevel::kNeon:
+            return "neon";
+    }
+    return "unknown";
+}
+
+std::optional<IsaLevel> ParseIsaLevel(const std::string& name) {
+    for (auto level : {IsaLevel::kScalar, IsaLevel::kSse2, IsaLevel::kSse42, IsaLevel::kAvx2,
+                       IsaLevel::kAvx512, IsaLevel::kNeon}) {
+        if (name == IsaLevelName(level)) {
+            return level;
+        }
+    }
+    if (name == "sse42") {
+        return IsaLevel::kSse42;
+    }
+    if (name == "avx-512") {
+        return IsaLevel::kAvx512;
+    }
+    return std::nullopt;
+}
+
+}  // namespace pal
+}  // namespace vgcpu
@@ -0,0 +1,59 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+// Blueprint Reference: [ARCH-12-02d] RunReport environment metadata (Chapter 3)
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vgcpu {
+namespace pal {
+
+/// SIMD instruction set levels a run can be capped at. x86 levels are ordered, each implying
+/// the ones below it; NEON is the only level above scalar on ARM.
+enum class IsaLevel {
+    kScalar,  ///< No SIMD dispatch
+    kSse2,    ///< x86-64 baseline
+    kSse42,   ///< SSE4.2 (and SSE3/SSSE3/SSE4.1)
+    kAvx2,    ///< AVX2 (and AVX, FMA)
+    kAvx512,  ///< AVX-512 F/BW/DQ/VL
+    kNeon,    ///< AArch64 Advanced SIMD
+};
+
+/// SIMD features of the host CPU, usable by the OS (AVX state enabled in XCR0).
+struct CpuFeatures {
+    bool sse2 = false;
+    bool sse4_2 = false;
+    bool avx2 = false;
+    bool avx512 = false;  ///< F, BW, DQ and VL together (the subset SIMD libraries dispatch on)
+    bool neon = false;
+};
+
+/// Detect the host CPU's SIMD features (cached after the first call).
+[[nodiscard]] const CpuFeatures& DetectCpuFeatures();
+
+/// Names of the detected features, lowest first (e.g. {"sse2", "sse4.2", "avx2"}).
+[[nodiscard]] std::vector<std::string> CpuFeatureNames(const CpuFeatures& features);
+
+/// Size in bytes of the largest (last-level) CPU cache, as seen from CPU 0; 0 if unknown.
+[[nodiscard]] int64_t GetLastLevelCacheBytes();
+
+/// Highest level the host CPU supports.
+[[nodiscard]] IsaLevel HighestIsaLevel();
+
+/// True if the host CPU supports `level` (x86 levels are unavailable on ARM and vice versa).
+[[nodiscard]] bool IsIsaLevelAvailable(IsaLevel level);
+
+/// Lowercase name: "scalar", "sse2", "sse4.2", "avx2", "avx512" or "neon".
+[[nodiscard]] const char* IsaLevelName(IsaLevel level);
+
+/// Parse an IsaLevelName; also accepts "sse42" and "avx-512". nullopt if unknown.
+[[nodiscard]] std::optional<IsaLevel> ParseIsaLevel(const std::string& name);
+
+}  // namespace pal
+}  // namespace vgcpu
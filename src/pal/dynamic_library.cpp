@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#include "pal/dynamic_library.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace vgcpu {
+namespace pal {
+
+DynamicLibrary::~DynamicLibrary() {
+    Close();
+}
+
+DynamicLibrary::DynamicLibrary(DynamicLibrary&& other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr)) {}
+
+DynamicLibrary& DynamicLibrary::operator=(DynamicLibrary&& other) noexcept {
+    if (this != &other) {
+        Close();
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+Result<DynamicLibrary> DynamicLibrary::Open(const std::string& path) {
+    DynamicLibrary library;
+#if defined(_WIN32)
+    library.handle_ = static_cast<void*>(LoadLibraryA(path.c_str()));
+    if (!library.handle_) {
+        return Status::IOError("LoadLibrary failed for " + path + " (error " +
+                               std::to_string(GetLastError()) + ")");
+    }
+#else
+    // RTLD_LOCAL keeps each plugin's statically linked copies of shared code apart.
+    library.handle_ = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!library.handle_) {
+        const char* error = dlerror();
+        return Status::IOError(error ? error : "dlopen failed for " + path);
+    }
+#endif
+    return library;
+}
+
+void* DynamicLibrary::GetSymbol(const char* name) const {
+    if (!handle_) {
+        return nullptr;
+    }
+#if defined(_WIN32)
+    return reinterpret_cast<void*>(GetProcAddress(static_cast<HMODULE>(handle_), name));
+#else
+    return dlsym(handle_, name);
+#endif
+}
+
+const char* DynamicLibrary::Suffix() {
+#if defined(_WIN32)
+    return ".dll";
+#elif defined(__APPLE__)
+    return ".dylib";
+#else
+    return ".so";
+#endif
+}
+
+void DynamicLibrary::Close() {
+    if (!handle_) {
+        return;
+    }
+#if defined(_WIN32)
+    FreeLibrary(static_cast<HMODULE>(handle_));
+#else
+    dlclose(handle_);
+#endif
+    handle_ = nullptr;
+}
+
+}  // namespace pal
+}  // namespace vgcpu
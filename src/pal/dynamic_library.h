@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#pragma once
+
+#include "common/status.h"
+
+#include <string>
+
+namespace vgcpu {
+namespace pal {
+
+/// Handle to a shared library loaded at runtime (dlopen / LoadLibrary).
+/// Move-only; the library is unloaded when the owning handle is destroyed.
+class DynamicLibrary {
+   public:
+    DynamicLibrary() = default;
+    ~DynamicLibrary();
+
+    DynamicLibrary(DynamicLibrary&& other) noexcept;
+    DynamicLibrary& operator=(DynamicLibrary&& other) noexcept;
+    DynamicLibrary(const DynamicLibrary&) = delete;
+    DynamicLibrary& operator=(const DynamicLibrary&) = delete;
+
+    /// Load the library at `path`. Symbols are resolved immediately and kept local to it.
+    /// @return IOError carrying the loader's message on failure.
+    [[nodiscard]] static Result<DynamicLibrary> Open(const std::string& path);
+
+    /// Address of an exported symbol, or nullptr if absent.
+    [[nodiscard]] void* GetSymbol(const char* name) const;
+
+    [[nodiscard]] bool IsOpen() const { return handle_ != nullptr; }
+
+    /// Platform file suffix of loadable modules (".so", ".dylib" or ".dll").
+    [[nodiscard]] static const char* Suffix();
+
+   private:
+    void Close();
+
+    void* handle_ = nullptr;
+};
+
+}  // namespace pal
+}  // namespace vgcpu
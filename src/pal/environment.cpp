@@ -6,7 +6,11 @@
 
 #include "pal/environment.h"
 
+#include "pal/cpu_features.h"
+
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
 #include <iomanip>
 #include <sstream>
@@ -30,6 +34,71 @@
 namespace vgcpu {
 namespace pal {
 
+namespace {
+
+#if defined(__linux__)
+
+/// First line of a sysfs/procfs file; empty if it does not exist (kernel or driver without it).
+std::string ReadFirstLine(const std::string& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+/// Noise-relevant kernel and CPU settings.
+void CollectNoiseSources(EnvironmentInfo& info) {
+    // Governors of all online CPUs, distinct, in CPU order
+    std::vector<std::string> governors;
+    for (int cpu = 0; cpu < info.cpu_cores; ++cpu) {
+        const auto governor = ReadFirstLine("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                            "/cpufreq/scaling_governor");
+        if (!governor.empty() &&
+            std::find(governors.begin(), governors.end(), governor) == governors.end()) {
+            governors.push_back(governor);
+        }
+    }
+    for (const auto& governor : governors) {
+        info.cpu_governor += (info.cpu_governor.empty() ? "" : ",") + governor;
+    }
+
+    // intel_pstate has its own switch (inverted); acpi-cpufreq and amd-pstate use "boost"
+    const auto no_turbo = ReadFirstLine("/sys/devices/system/cpu/intel_pstate/no_turbo");
+    auto boost = ReadFirstLine("/sys/devices/system/cpu/cpufreq/boost");
+    if (boost.empty()) {
+        boost = ReadFirstLine("/sys/devices/system/cpu/cpu0/cpufreq/boost");
+    }
+    if (!no_turbo.empty()) {
+        info.turbo = no_turbo == "1" ? "off" : "on";
+    } else if (!boost.empty()) {
+        info.turbo = boost == "1" ? "on" : "off";
+    }
+
+    info.smt = ReadFirstLine("/sys/devices/system/cpu/smt/control");
+    info.isolated_cpus = ReadFirstLine("/sys/devices/system/cpu/isolated");
+    info.nohz_full_cpus = ReadFirstLine("/sys/devices/system/cpu/nohz_full");
+    if (info.nohz_full_cpus == "(null)") {
+        info.nohz_full_cpus.clear();
+    }
+
+    // "always [madvise] never": the bracketed mode is active
+    const auto thp = ReadFirstLine("/sys/kernel/mm/transparent_hugepage/enabled");
+    const auto open = thp.find('[');
+    const auto close = thp.find(']', open);
+    if (open != std::string::npos && close != std::string::npos) {
+        info.thp_mode = thp.substr(open + 1, close - open - 1);
+    }
+
+    const auto aslr = ReadFirstLine("/proc/sys/kernel/randomize_va_space");
+    if (!aslr.empty() && aslr.find_first_not_of("0123456789") == std::string::npos) {
+        info.aslr = std::stoi(aslr);
+    }
+}
+
+#endif
+
+}  // namespace
+
 EnvironmentInfo CollectEnvironment() {
     EnvironmentInfo info;
 
@@ -139,7 +208,21 @@ EnvironmentInfo CollectEnvironment() {
     // Count CPUs from sysconf
     info.cpu_cores = static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
 
+    CollectNoiseSources(info);
+
+#endif
+
+#if !defined(_WIN32)
+    double load = 0.0;
+    if (getloadavg(&load, 1) == 1) {
+        info.load_average_1m = load;
+    }
 #endif
+    info.noise = DetectNoiseSources(info);
+
+    // SIMD features (CPUID on x86, architectural on AArch64)
+    info.isa_level = IsaLevelName(HighestIsaLevel());
+    info.cpu_features = CpuFeatureNames(DetectCpuFeatures());
 
     // Compiler info (compile-time)
 #if defined(__clang__)
@@ -160,6 +243,32 @@ EnvironmentInfo CollectEnvironment() {
     return info;
 }
 
+std::vector<std::string> DetectNoiseSources(const EnvironmentInfo& info) {
+    std::vector<std::string> noise;
+    if (!info.cpu_governor.empty() && info.cpu_governor != "performance") {
+        noise.push_back("CPU_GOVERNOR:" + info.cpu_governor);
+    }
+    if (info.turbo == "on") {
+        noise.emplace_back("TURBO:on");
+    }
+    if (info.smt == "on") {
+        noise.emplace_back("SMT:on");
+    }
+    if (info.thp_mode == "always") {
+        noise.emplace_back("THP:always");
+    }
+    if (info.aslr > 0) {
+        noise.push_back("ASLR:" + std::to_string(info.aslr));
+    }
+    const double busy = std::max(1.0, kNoisyLoadPerCpu * info.cpu_cores);
+    if (info.load_average_1m > busy) {
+        std::ostringstream load;
+        load << std::fixed << std::setprecision(2) << info.load_average_1m;
+        noise.push_back("LOAD:" + load.str());
+    }
+    return noise;
+}
+
 std::string GetTimestamp() {
     auto now = std::chrono::system_clock::now();
     auto time_t_now = std::chrono::system_clock::to_time_t(now);
@@ -8,6 +8,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace vgcpu {
 namespace pal {
@@ -20,15 +21,37 @@ struct EnvironmentInfo {
     std::string os_version;
     std::string arch;
     std::string cpu_model;
+    std::string isa_level;                  ///< Highest SIMD level (IsaLevelName)
+    std::vector<std::string> cpu_features;  ///< SIMD features usable on this CPU and OS
     int cpu_cores = 0;
     int64_t memory_bytes = 0;
     std::string compiler_name;
     std::string compiler_version;
+
+    // Noise sources (Linux sysfs/procfs; empty or negative = unknown on this OS)
+    std::string cpu_governor;        ///< cpufreq governors in use, e.g. "performance"
+    std::string turbo;               ///< Frequency boost: "on" or "off"
+    std::string smt;                 ///< SMT control: "on", "off", "forceoff", "notsupported"
+    std::string isolated_cpus;       ///< isolcpus= list (e.g. "2-7"); empty = none
+    std::string nohz_full_cpus;      ///< nohz_full= list; empty = none
+    std::string thp_mode;            ///< Transparent huge pages: "always", "madvise" or "never"
+    double load_average_1m = -1.0;   ///< 1-minute load average at collection
+    int aslr = -1;                   ///< kernel.randomize_va_space (0 = off, 2 = full)
+    std::vector<std::string> noise;  ///< DetectNoiseSources of the above
 };
 
+/// Load average per online CPU above which the machine counts as busy (DetectNoiseSources); a
+/// load of 1 or less never does.
+inline constexpr double kNoisyLoadPerCpu = 0.1;
+
 /// Collect environment information for the current system.
 [[nodiscard]] EnvironmentInfo CollectEnvironment();
 
+/// Configurations known to add run-to-run noise, one reason code per source
+/// ("CPU_GOVERNOR:powersave", "TURBO:on", "SMT:on", "THP:always", "ASLR:2", "LOAD:3.50").
+/// Unknown fields are not reported.
+[[nodiscard]] std::vector<std::string> DetectNoiseSources(const EnvironmentInfo& info);
+
 /// Get the current timestamp in ISO 8601 format.
 [[nodiscard]] std::string GetTimestamp();
 
@@ -0,0 +1,212 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#include "pal/memory.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace vgcpu {
+namespace pal {
+
+namespace {
+
+constexpr size_t kHugePageSize = size_t{2} << 20;  // x86-64 and AArch64 (4K granule) PMD size
+
+bool IsPowerOfTwo(size_t value) {
+    return (value & (value - 1)) == 0;
+}
+
+/// Huge pages and NUMA binding need a mapping of their own.
+bool UsesMapping(const MemoryPolicy& policy) {
+    return policy.huge_pages != HugePages::kOff || policy.numa == NumaPlacement::kLocal;
+}
+
+#if defined(__linux__)
+
+constexpr int kMpolBind = 2;  // <linux/mempolicy.h>, not in libc headers
+
+size_t RoundUp(size_t value, size_t multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/// Length and alignment of the mapping behind a `size`-byte block.
+size_t MappingGranule(const MemoryPolicy& policy) {
+    const size_t granule = policy.huge_pages == HugePages::kOff ? GetPageSize() : kHugePageSize;
+    return policy.alignment > granule ? policy.alignment : granule;
+}
+
+/// Anonymous mapping of `length` bytes starting on an `align` boundary: over-map, then trim.
+void* MapAligned(size_t length, size_t align, int flags) {
+    const size_t page = GetPageSize();
+    const size_t slack = align > page ? align : 0;
+    void* raw = mmap(nullptr, length + slack, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    const auto base = reinterpret_cast<uintptr_t>(raw);
+    const uintptr_t start = RoundUp(base, align);
+    if (start > base) {
+        munmap(raw, start - base);
+    }
+    if (base + slack > start) {
+        munmap(reinterpret_cast<void*>(start + length), base + slack - start);
+    }
+    return reinterpret_cast<void*>(start);
+}
+
+/// Bind [data, data + length) to the NUMA node of the CPU this thread is running on.
+bool BindToLocalNode(void* data, size_t length) {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return false;
+    }
+    constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> mask(node / kBitsPerWord + 1, 0);
+    mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+    // The kernel reads maxnode - 1 bits
+    return syscall(SYS_mbind, data, length, kMpolBind, mask.data(),
+                   mask.size() * kBitsPerWord + 1, 0) == 0;
+}
+
+#endif
+
+}  // namespace
+
+const char* HugePagesName(HugePages mode) {
+    switch (mode) {
+        case HugePages::kOff:
+            return "off";
+        case HugePages::kTransparent:
+            return "thp";
+        case HugePages::kExplicit:
+            return "hugetlb";
+    }
+    return "unknown";
+}
+
+const char* NumaPlacementName(NumaPlacement placement) {
+    switch (placement) {
+        case NumaPlacement::kFirstTouch:
+            return "first_touch";
+        case NumaPlacement::kLocal:
+            return "local";
+    }
+    return "unknown";
+}
+
+size_t GetPageSize() {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    const long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? static_cast<size_t>(size) : 4096;
+#endif
+}
+
+void* AllocateMemory(size_t size, const MemoryPolicy& policy) {
+    if (!IsPowerOfTwo(policy.alignment)) {
+        return nullptr;
+    }
+    if (!UsesMapping(policy)) {
+        if (policy.alignment == 0) {
+            return ::operator new(size, std::nothrow);
+        }
+        return ::operator new(size, std::align_val_t{policy.alignment}, std::nothrow);
+    }
+#if defined(__linux__)
+    const size_t granule = MappingGranule(policy);
+    const size_t length = RoundUp(size == 0 ? 1 : size, granule);
+    void* data = nullptr;
+    if (policy.huge_pages == HugePages::kExplicit) {
+        // hugetlbfs mappings come huge-page aligned; the pool is reserved at mmap time
+        if (granule > kHugePageSize) {
+            errno = EINVAL;
+            return nullptr;
+        }
+        data = MapAligned(length, GetPageSize(), MAP_HUGETLB);
+    } else {
+        data = MapAligned(length, granule, 0);
+    }
+    if (data == nullptr) {
+        return nullptr;
+    }
+    // Advice and binding must precede the first touch to take effect
+    const bool advised = policy.huge_pages != HugePages::kTransparent ||
+                         madvise(data, length, MADV_HUGEPAGE) == 0;
+    const bool bound = advised && (policy.numa != NumaPlacement::kLocal ||
+                                   BindToLocalNode(data, length));
+    if (!bound) {
+        const int error = errno;
+        munmap(data, length);
+        errno = error;
+        return nullptr;
+    }
+    return data;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+void FreeMemory(void* data, size_t size, const MemoryPolicy& policy) {
+    if (data == nullptr) {
+        return;
+    }
+    if (!UsesMapping(policy)) {
+        if (policy.alignment == 0) {
+            ::operator delete(data);
+        } else {
+            ::operator delete(data, std::align_val_t{policy.alignment});
+        }
+        return;
+    }
+#if defined(__linux__)
+    munmap(data, RoundUp(size == 0 ? 1 : size, MappingGranule(policy)));
+#else
+    (void)size;
+#endif
+}
+
+Status ProbeMemoryPolicy(const MemoryPolicy& policy) {
+    if (!IsPowerOfTwo(policy.alignment)) {
+        return Status::InvalidArg("Alignment must be a power of two, got " +
+                                  std::to_string(policy.alignment));
+    }
+#if !defined(__linux__)
+    if (UsesMapping(policy)) {
+        return Status::Unsupported("Huge pages and NUMA binding are only available on Linux");
+    }
+#endif
+    errno = 0;
+    void* data = AllocateMemory(kHugePageSize, policy);
+    if (data == nullptr) {
+        return Status::Fail(std::string("Allocation failed: ") +
+                            (errno != 0 ? std::strerror(errno) : "out of memory"));
+    }
+    FreeMemory(data, kHugePageSize, policy);
+    return Status::Ok();
+}
+
+}  // namespace pal
+}  // namespace vgcpu
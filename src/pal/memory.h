@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#pragma once
+
+#include "common/status.h"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace vgcpu {
+namespace pal {
+
+/// Page backing for an allocation.
+enum class HugePages {
+    kOff,          ///< Base pages
+    kTransparent,  ///< 2 MiB-aligned mapping advised MADV_HUGEPAGE (Linux THP)
+    kExplicit,     ///< MAP_HUGETLB from the reserved hugetlbfs pool (Linux)
+};
+
+/// Which NUMA node an allocation's pages land on.
+enum class NumaPlacement {
+    kFirstTouch,  ///< OS default: the node of the thread that first writes each page
+    kLocal,       ///< Bound (mbind) to the node of the allocating thread's CPU (Linux)
+};
+
+/// How AllocateMemory obtains a block. The default is plain operator new.
+struct MemoryPolicy {
+    size_t alignment = 0;  ///< Power of two; 0 = operator new's default
+    HugePages huge_pages = HugePages::kOff;
+    NumaPlacement numa = NumaPlacement::kFirstTouch;
+
+    bool operator==(const MemoryPolicy&) const = default;
+};
+
+/// Lowercase name: "off", "thp" or "hugetlb" (the --huge-pages spelling).
+[[nodiscard]] const char* HugePagesName(HugePages mode);
+
+/// Lowercase name: "first_touch" or "local".
+[[nodiscard]] const char* NumaPlacementName(NumaPlacement placement);
+
+/// Size of a base page in bytes.
+[[nodiscard]] size_t GetPageSize();
+
+/// Allocate `size` bytes under `policy`. Huge pages and NUMA binding use an anonymous mapping
+/// (page-aligned, zero-filled); otherwise the block comes from aligned operator new.
+/// @return nullptr if the OS refuses (e.g. no hugetlbfs pages reserved) or is unsupported.
+[[nodiscard]] void* AllocateMemory(size_t size, const MemoryPolicy& policy);
+
+/// Release a block from AllocateMemory with the same `size` and `policy`.
+void FreeMemory(void* data, size_t size, const MemoryPolicy& policy);
+
+/// Check that this host can serve `policy` by allocating and freeing one huge page's worth.
+/// @return InvalidArg for a bad alignment, Unsupported off Linux, or Fail with the OS error.
+Status ProbeMemoryPolicy(const MemoryPolicy& policy);
+
+/// Standard allocator over AllocateMemory, so containers of surface pixels can carry a
+/// MemoryPolicy. Default-constructed, it behaves like std::allocator.
+template <typename T>
+class SurfaceAllocator {
+   public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+
+    SurfaceAllocator() noexcept = default;
+    explicit SurfaceAllocator(const MemoryPolicy& policy) noexcept : policy_(policy) {}
+    template <typename U>
+    SurfaceAllocator(const SurfaceAllocator<U>& other) noexcept : policy_(other.policy()) {}
+
+    T* allocate(size_t n) {
+        void* data = AllocateMemory(n * sizeof(T), policy_);
+        if (data == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(data);
+    }
+
+    void deallocate(T* data, size_t n) noexcept { FreeMemory(data, n * sizeof(T), policy_); }
+
+    [[nodiscard]] const MemoryPolicy& policy() const noexcept { return policy_; }
+
+    template <typename U>
+    bool operator==(const SurfaceAllocator<U>& other) const noexcept {
+        return policy_ == other.policy();
+    }
+
+   private:
+    MemoryPolicy policy_;
+};
+
+}  // namespace pal
+}  // namespace vgcpu
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#include "pal/realtime.h"
+
+#include "pal/memory.h"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace vgcpu {
+namespace pal {
+
+Status SetRealtimePriority(int priority) {
+#if defined(_WIN32)
+    (void)priority;
+    if (!SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)) {
+        return Status::Fail("SetThreadPriority failed (error " + std::to_string(GetLastError()) +
+                            ")");
+    }
+    return Status::Ok();
+#else
+    const int min = sched_get_priority_min(SCHED_FIFO);
+    const int max = sched_get_priority_max(SCHED_FIFO);
+    if (priority < min || priority > max) {
+        return Status::InvalidArg("SCHED_FIFO priority must be in " + std::to_string(min) + "-" +
+                                  std::to_string(max));
+    }
+    sched_param param{};
+    param.sched_priority = priority;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (error != 0) {
+        return Status::Fail(std::string("SCHED_FIFO: ") + std::strerror(error));
+    }
+    return Status::Ok();
+#endif
+}
+
+Status LockProcessMemory() {
+#if defined(_WIN32)
+    return Status::Unsupported("mlockall is not available on Windows");
+#else
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        return Status::Fail(std::string("mlockall: ") + std::strerror(errno));
+    }
+    return Status::Ok();
+#endif
+}
+
+void PrefaultWritable(void* data, size_t size) {
+    auto* bytes = static_cast<volatile unsigned char*>(data);
+    const size_t page = GetPageSize();
+    for (size_t offset = 0; offset < size; offset += page) {
+        bytes[offset] = bytes[offset];
+    }
+}
+
+void PrefaultReadable(const void* data, size_t size) {
+    const auto* bytes = static_cast<const volatile unsigned char*>(data);
+    const size_t page = GetPageSize();
+    unsigned char sink = 0;
+    for (size_t offset = 0; offset < size; offset += page) {
+        sink ^= bytes[offset];
+    }
+    (void)sink;
+}
+
+}  // namespace pal
+}  // namespace vgcpu
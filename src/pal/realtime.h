@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-03] PAL (Chapter 3) / [API-06-02] PAL (Chapter 4)
+
+#pragma once
+
+#include "common/status.h"
+
+#include <cstddef>
+
+namespace vgcpu {
+namespace pal {
+
+/// Run the calling thread under SCHED_FIFO at `priority` (1-99 on Linux), so it is only
+/// preempted by higher real-time priorities. Threads it creates afterwards inherit the policy
+/// (glibc default). On Windows the thread gets THREAD_PRIORITY_TIME_CRITICAL instead.
+/// @return InvalidArg for a priority out of range, or Fail with the OS error (usually missing
+/// CAP_SYS_NICE or RLIMIT_RTPRIO).
+Status SetRealtimePriority(int priority);
+
+/// Lock the process's current and future pages in RAM (mlockall), so the measured loop never
+/// takes a major fault. Locks are not inherited by forked children; they must lock again.
+/// @return Unsupported where unavailable, or Fail with the OS error (usually RLIMIT_MEMLOCK).
+Status LockProcessMemory();
+
+/// Fault in every page of [data, data + size) by writing each page's first byte back, leaving
+/// the contents unchanged.
+void PrefaultWritable(void* data, size_t size);
+
+/// Fault in every page of [data, data + size) by reading it.
+void PrefaultReadable(const void* data, size_t size);
+
+}  // namespace pal
+}  // namespace vgcpu
@@ -14,6 +14,7 @@
 #include <windows.h>
 // Link with Kernel32.lib
 #elif defined(__APPLE__) || defined(__linux__)
+#include <sys/resource.h>
 #include <time.h>
 #include <unistd.h>
 #if defined(__APPLE__)
@@ -121,7 +122,6 @@ const char* GetCpuTimeSemantics() {
     return "process";
 }
 #else
-#include <sys/resource.h>
 Duration GetCpuTime() {
     struct rusage usage;
     if (getrusage(RUSAGE_SELF, &usage) == 0) {
@@ -165,5 +165,22 @@ const char* GetCpuTimeSemantics() {
 
 #endif
 
+bool ReadProcessCounters(ProcessCounters& counters) {
+#if defined(__APPLE__) || defined(__linux__)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return false;
+    }
+    counters.minor_faults = usage.ru_minflt;
+    counters.major_faults = usage.ru_majflt;
+    counters.voluntary_switches = usage.ru_nvcsw;
+    counters.involuntary_switches = usage.ru_nivcsw;
+    return true;
+#else
+    counters = {};
+    return false;
+#endif
+}
+
 }  // namespace pal
 }  // namespace vgcpu
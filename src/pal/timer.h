@@ -37,6 +37,17 @@ using Duration = std::chrono::nanoseconds;
 /// Returns "process" or "thread" depending on what GetCpuTime() measures.
 [[nodiscard]] const char* GetCpuTimeSemantics();
 
+/// Scheduler and memory events of the process so far (cumulative).
+struct ProcessCounters {
+    int64_t minor_faults = 0;          ///< Page faults served without I/O
+    int64_t major_faults = 0;          ///< Page faults that needed I/O
+    int64_t voluntary_switches = 0;    ///< Context switches from blocking
+    int64_t involuntary_switches = 0;  ///< Context switches from preemption
+};
+
+/// Read the process counters (getrusage). Returns false where unsupported (Windows).
+[[nodiscard]] bool ReadProcessCounters(ProcessCounters& counters);
+
 /// Get the estimated CPU frequency in Hz (0 if unknown).
 [[nodiscard]] int64_t GetCpuFrequency();
 
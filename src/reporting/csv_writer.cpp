@@ -66,7 +66,22 @@ std::string CsvWriter::ToCsv(const std::vector<CaseResult>& results) {
     // Blueprint Reference: [REQ-49] Report MUST carry tool_version/schema_version (Chapter 4)
     oss << "backend_id,scene_id,scene_hash,width,height,decision,";
     oss << "wall_p50_ns,wall_p90_ns,cpu_p50_ns,cpu_p90_ns,sample_count,";
-    oss << "artifact_path,ssim_score,ssim_passed,ssim_message\n";
+    oss << "artifact_path,ssim_score,ssim_passed,ssim_message,";
+    oss << "baseline_id,net_wall_p50_ns,net_cpu_p50_ns,";
+    oss << "thread_count,scaling_reference_id,speedup_vs_serial,parallel_efficiency,";
+    oss << "pixel_format,convert_ns,batch_frames,";
+    oss << "pipeline_depth,sustained_fps,latency_p50_ns,latency_p90_ns,";
+    oss << "stroke_count,stroker_p50_ns,fill_wall_p50_ns,fill_cpu_p50_ns,";
+    oss << "flatten_tolerance,curve_count,flatten_p50_ns,flat_wall_p50_ns,flat_cpu_p50_ns,";
+    oss << "max_isa,wall_ci_low_ns,wall_ci_high_ns,wall_ci_rel,sampling_stop,";
+    oss << "warmup_frames,first_frame_ns,";
+    oss << "wall_mean_ns,wall_stddev_ns,repetition_count,within_stddev_ns,between_stddev_ns,";
+    oss << "wall_min_ns,wall_max_ns,wall_p95_ns,wall_p99_ns,wall_p999_ns,wall_mad_ns,";
+    oss << "wall_boot_low_ns,wall_boot_high_ns,wall_outliers,wall_far_outliers,";
+    oss << "serial_fraction,";
+    oss << "instance_count,aggregate_fps,instance_efficiency,instance_latency_p50_ns,";
+    oss << "instance_latency_p99_ns,slot,first_core,core_count,cold_rotation,cold_evict_bytes,";
+    oss << "cold_wall_p50_ns,cold_wall_p90_ns,cold_cpu_p50_ns,cold_warm_ratio,stride\n";
 
     // Data rows
     for (const auto& r : results) {
@@ -84,7 +99,68 @@ std::string CsvWriter::ToCsv(const std::vector<CaseResult>& results) {
         oss << EscapeCsv(r.artifact_path) << ",";
         oss << r.ssim_score << ",";
         oss << (r.ssim_passed ? "true" : "false") << ",";
-        oss << EscapeCsv(r.ssim_message) << "\n";
+        oss << EscapeCsv(r.ssim_message) << ",";
+        oss << EscapeCsv(r.baseline_id) << ",";
+        oss << r.net_wall_p50_ns << ",";
+        oss << r.net_cpu_p50_ns << ",";
+        oss << r.thread_count << ",";
+        oss << EscapeCsv(r.scaling_reference_id) << ",";
+        oss << r.speedup_vs_serial << ",";
+        oss << r.parallel_efficiency << ",";
+        oss << EscapeCsv(r.pixel_format) << ",";
+        oss << r.convert_ns << ",";
+        oss << r.batch_frames << ",";
+        oss << r.throughput.pipeline_depth << ",";
+        oss << r.throughput.sustained_fps << ",";
+        oss << r.throughput.latency_p50_ns << ",";
+        oss << r.throughput.latency_p90_ns << ",";
+        oss << r.stroke_isolation.stroke_count << ",";
+        oss << r.stroke_isolation.stroker_p50_ns << ",";
+        oss << r.stroke_isolation.fill_wall_p50_ns << ",";
+        oss << r.stroke_isolation.fill_cpu_p50_ns << ",";
+        oss << r.flattened.tolerance << ",";
+        oss << r.flattened.curve_count << ",";
+        oss << r.flattened.flatten_p50_ns << ",";
+        oss << r.flattened.wall_p50_ns << ",";
+        oss << r.flattened.cpu_p50_ns << ",";
+        oss << EscapeCsv(r.max_isa) << ",";
+        oss << r.stats.wall_ci_low_ns << ",";
+        oss << r.stats.wall_ci_high_ns << ",";
+        oss << r.stats.wall_ci_rel << ",";
+        oss << EscapeCsv(r.sampling_stop) << ",";
+        oss << r.warmup_frames << ",";
+        oss << r.first_frame_ns << ",";
+        oss << r.stats.wall_mean_ns << ",";
+        oss << r.stats.wall_stddev_ns << ",";
+        oss << r.repetitions.count << ",";
+        oss << r.repetitions.within_stddev_ns << ",";
+        oss << r.repetitions.between_stddev_ns << ",";
+        oss << r.stats.wall_min_ns << ",";
+        oss << r.stats.wall_max_ns << ",";
+        oss << r.stats.wall_p95_ns << ",";
+        oss << r.stats.wall_p99_ns << ",";
+        oss << r.stats.wall_p999_ns << ",";
+        oss << r.stats.wall_mad_ns << ",";
+        oss << r.stats.wall_boot_low_ns << ",";
+        oss << r.stats.wall_boot_high_ns << ",";
+        oss << r.stats.wall_outliers << ",";
+        oss << r.stats.wall_far_outliers << ",";
+        oss << r.serial_fraction << ",";
+        oss << r.multi_instance.instance_count << ",";
+        oss << r.multi_instance.aggregate_fps << ",";
+        oss << r.multi_instance.scaling_efficiency << ",";
+        oss << r.multi_instance.latency_p50_ns << ",";
+        oss << r.multi_instance.latency_p99_ns << ",";
+        oss << r.slot << ",";
+        oss << r.first_core << ",";
+        oss << r.core_count << ",";
+        oss << r.cold_buffers.rotation << ",";
+        oss << r.cold_buffers.evict_bytes << ",";
+        oss << r.cold_buffers.wall_p50_ns << ",";
+        oss << r.cold_buffers.wall_p90_ns << ",";
+        oss << r.cold_buffers.cpu_p50_ns << ",";
+        oss << r.cold_buffers.cold_warm_ratio << ",";
+        oss << r.stride << "\n";
     }
 
     return oss.str();
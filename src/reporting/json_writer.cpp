@@ -80,18 +80,82 @@ std::string JsonWriter::ToJson(const RunMetadata& metadata,
     oss << "      \"os_version\": \"" << EscapeJson(metadata.environment.os_version) << "\",\n";
     oss << "      \"arch\": \"" << EscapeJson(metadata.environment.arch) << "\",\n";
     oss << "      \"cpu_model\": \"" << EscapeJson(metadata.environment.cpu_model) << "\",\n";
+    oss << "      \"isa_level\": \"" << EscapeJson(metadata.environment.isa_level) << "\",\n";
+    oss << "      \"cpu_features\": [";
+    for (size_t i = 0; i < metadata.environment.cpu_features.size(); ++i) {
+        oss << (i > 0 ? ", " : "") << "\"" << EscapeJson(metadata.environment.cpu_features[i])
+            << "\"";
+    }
+    oss << "],\n";
     oss << "      \"cpu_cores\": " << metadata.environment.cpu_cores << ",\n";
     oss << "      \"memory_bytes\": " << metadata.environment.memory_bytes << ",\n";
     oss << "      \"compiler_name\": \"" << EscapeJson(metadata.environment.compiler_name)
         << "\",\n";
     oss << "      \"compiler_version\": \"" << EscapeJson(metadata.environment.compiler_version)
-        << "\"\n";
+        << "\",\n";
+    oss << "      \"cpu_governor\": \"" << EscapeJson(metadata.environment.cpu_governor) << "\",\n";
+    oss << "      \"turbo\": \"" << EscapeJson(metadata.environment.turbo) << "\",\n";
+    oss << "      \"smt\": \"" << EscapeJson(metadata.environment.smt) << "\",\n";
+    oss << "      \"isolated_cpus\": \"" << EscapeJson(metadata.environment.isolated_cpus)
+        << "\",\n";
+    oss << "      \"nohz_full_cpus\": \"" << EscapeJson(metadata.environment.nohz_full_cpus)
+        << "\",\n";
+    oss << "      \"thp_mode\": \"" << EscapeJson(metadata.environment.thp_mode) << "\",\n";
+    oss << "      \"load_average_1m\": " << metadata.environment.load_average_1m << ",\n";
+    oss << "      \"aslr\": " << metadata.environment.aslr << ",\n";
+    oss << "      \"noise\": [";
+    for (size_t i = 0; i < metadata.environment.noise.size(); ++i) {
+        oss << (i > 0 ? ", " : "") << "\"" << EscapeJson(metadata.environment.noise[i]) << "\"";
+    }
+    oss << "]\n";
     oss << "    },\n";
     oss << "    \"policy\": {\n";
     oss << "      \"warmup_iterations\": " << metadata.policy.warmup_iterations << ",\n";
+    oss << "      \"auto_warmup\": " << (metadata.policy.auto_warmup ? "true" : "false") << ",\n";
+    oss << "      \"max_warmup_iterations\": " << metadata.policy.max_warmup_iterations << ",\n";
     oss << "      \"measurement_iterations\": " << metadata.policy.measurement_iterations << ",\n";
+    oss << "      \"target_ci\": " << metadata.policy.target_ci << ",\n";
+    oss << "      \"max_iterations\": " << metadata.policy.max_iterations << ",\n";
+    oss << "      \"time_budget_s\": " << metadata.policy.time_budget_s << ",\n";
     oss << "      \"repetitions\": " << metadata.policy.repetitions << ",\n";
-    oss << "      \"thread_count\": " << metadata.policy.thread_count << "\n";
+    oss << "      \"thread_count\": " << metadata.policy.thread_count << ",\n";
+    oss << "      \"batch_frames\": " << metadata.policy.batch_frames << ",\n";
+    oss << "      \"pipeline_depth\": " << metadata.policy.pipeline_depth << ",\n";
+    oss << "      \"instances\": " << metadata.policy.instances << ",\n";
+    oss << "      \"instance_time_s\": " << metadata.policy.instance_time_s << ",\n";
+    oss << "      \"jobs\": " << metadata.policy.jobs << ",\n";
+    oss << "      \"cores_per_job\": " << metadata.policy.cores_per_job << ",\n";
+    oss << "      \"isolate_strokes\": " << (metadata.policy.isolate_strokes ? "true" : "false")
+        << ",\n";
+    oss << "      \"sample_counters\": " << (metadata.policy.sample_counters ? "true" : "false")
+        << ",\n";
+    oss << "      \"flatten_tolerance\": " << metadata.policy.flatten_tolerance << ",\n";
+    oss << "      \"orchestrator_cpu\": " << metadata.policy.orchestrator_cpu << ",\n";
+    oss << "      \"worker_cpus\": [";
+    for (size_t i = 0; i < metadata.policy.worker_cpus.size(); ++i) {
+        oss << (i > 0 ? ", " : "") << metadata.policy.worker_cpus[i];
+    }
+    oss << "],\n";
+    oss << "      \"fifo_priority\": " << metadata.policy.fifo_priority << ",\n";
+    oss << "      \"lock_memory\": " << (metadata.policy.lock_memory ? "true" : "false") << ",\n";
+    oss << "      \"prefault\": " << (metadata.policy.prefault ? "true" : "false") << ",\n";
+    oss << "      \"rotate_buffers\": " << metadata.policy.rotate_buffers << ",\n";
+    oss << "      \"evict_llc\": " << (metadata.policy.evict_llc ? "true" : "false") << ",\n";
+    oss << "      \"pad_stride\": " << (metadata.policy.pad_stride ? "true" : "false") << ",\n";
+    oss << "      \"surface_alignment\": " << metadata.policy.surface_memory.alignment << ",\n";
+    oss << "      \"huge_pages\": \""
+        << pal::HugePagesName(metadata.policy.surface_memory.huge_pages) << "\",\n";
+    oss << "      \"numa_placement\": \""
+        << pal::NumaPlacementName(metadata.policy.surface_memory.numa) << "\"";
+    if (!metadata.policy.baseline_backend.empty()) {
+        oss << ",\n      \"baseline_backend\": \"" << EscapeJson(metadata.policy.baseline_backend)
+            << "\"";
+    }
+    if (!metadata.policy.isolation.empty()) {
+        oss << ",\n      \"isolation\": \"" << EscapeJson(metadata.policy.isolation) << "\"";
+        oss << ",\n      \"case_timeout_s\": " << metadata.policy.case_timeout_s;
+    }
+    oss << "\n";
     oss << "    }\n";
     oss << "  },\n";
 
@@ -105,6 +169,22 @@ std::string JsonWriter::ToJson(const RunMetadata& metadata,
         oss << "      \"scene_hash\": \"" << EscapeJson(r.scene_hash) << "\",\n";
         oss << "      \"width\": " << r.width << ",\n";
         oss << "      \"height\": " << r.height << ",\n";
+        oss << "      \"stride\": " << r.stride << ",\n";
+        oss << "      \"thread_count\": " << r.thread_count << ",\n";
+        oss << "      \"batch_frames\": " << r.batch_frames << ",\n";
+        oss << "      \"warmup_frames\": " << r.warmup_frames << ",\n";
+        oss << "      \"first_frame_ns\": " << r.first_frame_ns << ",\n";
+        if (r.slot >= 0) {
+            oss << "      \"slot\": " << r.slot << ",\n";
+            oss << "      \"first_core\": " << r.first_core << ",\n";
+            oss << "      \"core_count\": " << r.core_count << ",\n";
+        }
+        if (!r.max_isa.empty()) {
+            oss << "      \"max_isa\": \"" << EscapeJson(r.max_isa) << "\",\n";
+        }
+        if (!r.pixel_format.empty()) {
+            oss << "      \"pixel_format\": \"" << EscapeJson(r.pixel_format) << "\",\n";
+        }
         oss << "      \"decision\": \"" << DecisionToString(r.decision) << "\",\n";
         oss << "      \"reasons\": [";
         for (size_t j = 0; j < r.reasons.size(); ++j) {
@@ -118,8 +198,118 @@ std::string JsonWriter::ToJson(const RunMetadata& metadata,
         oss << "        \"wall_p90_ns\": " << r.stats.wall_p90_ns << ",\n";
         oss << "        \"cpu_p50_ns\": " << r.stats.cpu_p50_ns << ",\n";
         oss << "        \"cpu_p90_ns\": " << r.stats.cpu_p90_ns << ",\n";
-        oss << "        \"sample_count\": " << r.stats.sample_count << "\n";
+        oss << "        \"sample_count\": " << r.stats.sample_count << ",\n";
+        oss << "        \"wall_ci_low_ns\": " << r.stats.wall_ci_low_ns << ",\n";
+        oss << "        \"wall_ci_high_ns\": " << r.stats.wall_ci_high_ns << ",\n";
+        oss << "        \"wall_ci_rel\": " << r.stats.wall_ci_rel << ",\n";
+        oss << "        \"wall_mean_ns\": " << r.stats.wall_mean_ns << ",\n";
+        oss << "        \"wall_stddev_ns\": " << r.stats.wall_stddev_ns << ",\n";
+        oss << "        \"wall_min_ns\": " << r.stats.wall_min_ns << ",\n";
+        oss << "        \"wall_max_ns\": " << r.stats.wall_max_ns << ",\n";
+        oss << "        \"wall_p95_ns\": " << r.stats.wall_p95_ns << ",\n";
+        oss << "        \"wall_p99_ns\": " << r.stats.wall_p99_ns << ",\n";
+        oss << "        \"wall_p999_ns\": " << r.stats.wall_p999_ns << ",\n";
+        oss << "        \"wall_mad_ns\": " << r.stats.wall_mad_ns << ",\n";
+        oss << "        \"wall_boot_low_ns\": " << r.stats.wall_boot_low_ns << ",\n";
+        oss << "        \"wall_boot_high_ns\": " << r.stats.wall_boot_high_ns << ",\n";
+        oss << "        \"wall_outliers\": " << r.stats.wall_outliers << ",\n";
+        oss << "        \"wall_far_outliers\": " << r.stats.wall_far_outliers << "\n";
         oss << "      }";
+        if (r.repetitions.count > 0) {
+            oss << ",\n      \"repetitions\": {\n";
+            oss << "        \"count\": " << r.repetitions.count << ",\n";
+            oss << "        \"wall_p50_ns\": [";
+            for (size_t j = 0; j < r.repetitions.wall_p50_ns.size(); ++j) {
+                oss << (j > 0 ? ", " : "") << r.repetitions.wall_p50_ns[j];
+            }
+            oss << "],\n";
+            oss << "        \"within_stddev_ns\": " << r.repetitions.within_stddev_ns << ",\n";
+            oss << "        \"between_stddev_ns\": " << r.repetitions.between_stddev_ns << "\n";
+            oss << "      }";
+        }
+        if (!r.sampling_stop.empty()) {
+            oss << ",\n      \"sampling_stop\": \"" << EscapeJson(r.sampling_stop) << "\"";
+        }
+        if (!r.baseline_id.empty()) {
+            oss << ",\n      \"baseline\": {\n";
+            oss << "        \"backend_id\": \"" << EscapeJson(r.baseline_id) << "\",\n";
+            oss << "        \"net_wall_p50_ns\": " << r.net_wall_p50_ns << ",\n";
+            oss << "        \"net_cpu_p50_ns\": " << r.net_cpu_p50_ns << "\n";
+            oss << "      }";
+        }
+        if (!r.scaling_reference_id.empty()) {
+            oss << ",\n      \"scaling\": {\n";
+            oss << "        \"serial_backend_id\": \"" << EscapeJson(r.scaling_reference_id)
+                << "\",\n";
+            oss << "        \"speedup_vs_serial\": " << r.speedup_vs_serial << ",\n";
+            oss << "        \"parallel_efficiency\": " << r.parallel_efficiency << ",\n";
+            oss << "        \"serial_fraction\": " << r.serial_fraction << "\n";
+            oss << "      }";
+        }
+        if (r.throughput.pipeline_depth > 0) {
+            oss << ",\n      \"throughput\": {\n";
+            oss << "        \"pipeline_depth\": " << r.throughput.pipeline_depth << ",\n";
+            oss << "        \"frame_count\": " << r.throughput.frame_count << ",\n";
+            oss << "        \"async\": " << (r.throughput.async ? "true" : "false") << ",\n";
+            oss << "        \"sustained_fps\": " << r.throughput.sustained_fps << ",\n";
+            oss << "        \"latency_p50_ns\": " << r.throughput.latency_p50_ns << ",\n";
+            oss << "        \"latency_p90_ns\": " << r.throughput.latency_p90_ns << "\n";
+            oss << "      }";
+        }
+        if (r.multi_instance.instance_count > 0) {
+            const auto& mi = r.multi_instance;
+            oss << ",\n      \"multi_instance\": {\n";
+            oss << "        \"instance_count\": " << mi.instance_count << ",\n";
+            oss << "        \"duration_s\": " << mi.duration_s << ",\n";
+            oss << "        \"frame_count\": " << mi.frame_count << ",\n";
+            oss << "        \"aggregate_fps\": " << mi.aggregate_fps << ",\n";
+            oss << "        \"scaling_efficiency\": " << mi.scaling_efficiency << ",\n";
+            oss << "        \"latency_p50_ns\": " << mi.latency_p50_ns << ",\n";
+            oss << "        \"latency_p99_ns\": " << mi.latency_p99_ns << ",\n";
+            oss << "        \"instances\": [";
+            for (size_t j = 0; j < mi.instances.size(); ++j) {
+                const auto& in = mi.instances[j];
+                oss << (j > 0 ? "," : "") << "\n          {\"core\": " << in.core
+                    << ", \"scene_id\": \"" << EscapeJson(in.scene_id)
+                    << "\", \"frame_count\": " << in.frame_count
+                    << ", \"latency_p50_ns\": " << in.latency_p50_ns
+                    << ", \"latency_p90_ns\": " << in.latency_p90_ns
+                    << ", \"latency_p99_ns\": " << in.latency_p99_ns << "}";
+            }
+            oss << "\n        ]\n";
+            oss << "      }";
+        }
+        if (r.stroke_isolation.stroke_count > 0) {
+            const auto& si = r.stroke_isolation;
+            oss << ",\n      \"stroke_isolation\": {\n";
+            oss << "        \"stroke_count\": " << si.stroke_count << ",\n";
+            oss << "        \"stroker_p50_ns\": " << si.stroker_p50_ns << ",\n";
+            oss << "        \"fill_wall_p50_ns\": " << si.fill_wall_p50_ns << ",\n";
+            oss << "        \"fill_cpu_p50_ns\": " << si.fill_cpu_p50_ns << "\n";
+            oss << "      }";
+        }
+        if (r.flattened.curve_count > 0) {
+            oss << ",\n      \"flattened\": {\n";
+            oss << "        \"tolerance\": " << r.flattened.tolerance << ",\n";
+            oss << "        \"curve_count\": " << r.flattened.curve_count << ",\n";
+            oss << "        \"flatten_p50_ns\": " << r.flattened.flatten_p50_ns << ",\n";
+            oss << "        \"wall_p50_ns\": " << r.flattened.wall_p50_ns << ",\n";
+            oss << "        \"cpu_p50_ns\": " << r.flattened.cpu_p50_ns << "\n";
+            oss << "      }";
+        }
+        if (r.cold_buffers.rotation > 0) {
+            oss << ",\n      \"cold_buffers\": {\n";
+            oss << "        \"rotation\": " << r.cold_buffers.rotation << ",\n";
+            oss << "        \"evict_bytes\": " << r.cold_buffers.evict_bytes << ",\n";
+            oss << "        \"wall_p50_ns\": " << r.cold_buffers.wall_p50_ns << ",\n";
+            oss << "        \"wall_p90_ns\": " << r.cold_buffers.wall_p90_ns << ",\n";
+            oss << "        \"cpu_p50_ns\": " << r.cold_buffers.cpu_p50_ns << ",\n";
+            oss << "        \"cold_warm_ratio\": " << r.cold_buffers.cold_warm_ratio << "\n";
+            oss << "      }";
+        }
+        if (r.convert_ns > 0) {
+            oss << ",\n      \"convert_ns\": " << r.convert_ns;
+        }
         if (!r.artifact_path.empty()) {
             oss << ",\n      \"artifact_path\": \"" << EscapeJson(r.artifact_path) << "\"";
         }
@@ -11,8 +11,10 @@
 #include "pal/environment.h"
 #include "vgcpu/internal/version.h"
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <vector>
 
 namespace vgcpu {
 
@@ -57,6 +59,77 @@ class CsvWriter {
     static std::string ToCsv(const std::vector<CaseResult>& results);
 };
 
+/// Compact columnar file of the raw samples of a run (samples.vgcs), next to results.json.
+///
+/// Layout (integers little-endian, "varint" = unsigned LEB128):
+///   header  "VGCPUSMP", u32 version, u32 case count, u64 offset of the data section
+///   index   per case, in results order: backend_id, scene_id, max_isa (varint length + bytes),
+///           varint thread_count, width, height, sample_count, column count, then per column
+///           its name, varint offset (from the data section) and varint byte size
+///   data    column payloads: zigzag varints of the difference to the previous value (first
+///           value against 0)
+/// Columns are "wall_ns" and "cpu_ns" (per frame), then any CaseResult::sample_counters.
+/// Steady timings differ little from sample to sample, so most values take one or two bytes.
+inline constexpr char kSampleFileMagic[8] = {'V', 'G', 'C', 'P', 'U', 'S', 'M', 'P'};
+inline constexpr uint32_t kSampleFileVersion = 1;
+
+/// Index entry of one column of a case in a sample file.
+struct SampleColumnInfo {
+    std::string name;
+    uint64_t offset = 0;  ///< Payload offset from the start of the data section
+    uint64_t size = 0;    ///< Payload size in bytes
+};
+
+/// Index entry of one case in a sample file.
+struct SampleCaseInfo {
+    std::string backend_id;
+    std::string scene_id;
+    std::string max_isa;
+    int thread_count = 1;
+    int width = 0;
+    int height = 0;
+    uint64_t sample_count = 0;
+    std::vector<SampleColumnInfo> columns;
+};
+
+/// Sample file writer.
+class SampleWriter {
+   public:
+    /// Write the raw samples of every case to a sample file.
+    /// @param path Output file path (conventionally <out>/samples.vgcs).
+    /// @param results Benchmark case results; cases without samples get an empty entry.
+    /// @return Status indicating success or failure.
+    static Status Write(const std::filesystem::path& path, const std::vector<CaseResult>& results);
+
+    /// Encode the raw samples of every case as a sample file image.
+    static std::string ToBinary(const std::vector<CaseResult>& results);
+};
+
+/// Sample file reader. Opening parses only the header and index; columns are decoded on
+/// demand, so picking a few cases out of a large run does not decode the rest.
+class SampleReader {
+   public:
+    /// Read a sample file and parse its index.
+    /// @return IOError if the file cannot be read, InvalidArg if it is not a valid sample file.
+    static Result<SampleReader> Open(const std::filesystem::path& path);
+
+    /// Parse a sample file image (as produced by SampleWriter::ToBinary).
+    static Result<SampleReader> FromBinary(std::string data);
+
+    /// Cases in results order.
+    [[nodiscard]] const std::vector<SampleCaseInfo>& cases() const { return cases_; }
+
+    /// Decode one column of a case.
+    /// @return NotFound for an unknown case or column, InvalidArg for a corrupt payload.
+    [[nodiscard]] Result<std::vector<int64_t>> ReadColumn(size_t case_index,
+                                                          const std::string& name) const;
+
+   private:
+    std::string data_;
+    uint64_t data_offset_ = 0;
+    std::vector<SampleCaseInfo> cases_;
+};
+
 /// Human-readable summary writer.
 /// Blueprint Reference: [API-06-07] WriteSummaryToStdout (Chapter 4) / [ARCH-10-10] (Chapter 3)
 class SummaryWriter {
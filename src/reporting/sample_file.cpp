@@ -0,0 +1,283 @@
+// Copyright (c) 2025 Michele Fabbri (fabbri.michele@gmail.com)
+// SPDX-License-Identifier: MIT
+
+// Blueprint Reference: [ARCH-10-10] Reporting (Chapter 3) / [API-06-07] Reporting: CSV/JSON emit
+// (Chapter 4)
+
+#include "reporting/reporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace vgcpu {
+
+namespace {
+
+void PutU32(std::string& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void PutU64(std::string& out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+void PutVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void PutString(std::string& out, const std::string& s) {
+    PutVarint(out, s.size());
+    out += s;
+}
+
+/// Delta + zigzag varint payload of a column.
+std::string EncodeColumn(const std::vector<int64_t>& values) {
+    std::string out;
+    out.reserve(values.size() * 2);
+    int64_t previous = 0;
+    for (const auto value : values) {
+        const auto delta = static_cast<uint64_t>(value) - static_cast<uint64_t>(previous);
+        const auto signed_delta = static_cast<int64_t>(delta);
+        PutVarint(out, (delta << 1) ^ static_cast<uint64_t>(signed_delta >> 63));
+        previous = value;
+    }
+    return out;
+}
+
+/// Bounds-checked cursor over a sample file image.
+class ByteReader {
+   public:
+    ByteReader(const std::string& data, size_t pos, size_t end)
+        : data_(data), pos_(pos), end_(end) {}
+
+    bool U32(uint32_t& value) { return Fixed(value, 4); }
+    bool U64(uint64_t& value) { return Fixed(value, 8); }
+
+    bool Varint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos_ >= end_) {
+                return false;
+            }
+            const auto byte = static_cast<uint8_t>(data_[pos_++]);
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Int(int& value) {
+        uint64_t v = 0;
+        if (!Varint(v)) {
+            return false;
+        }
+        value = static_cast<int>(v);
+        return true;
+    }
+
+    bool String(std::string& value) {
+        uint64_t size = 0;
+        if (!Varint(size) || size > end_ - pos_) {
+            return false;
+        }
+        value.assign(data_, pos_, static_cast<size_t>(size));
+        pos_ += static_cast<size_t>(size);
+        return true;
+    }
+
+    [[nodiscard]] bool AtEnd() const { return pos_ == end_; }
+    [[nodiscard]] size_t pos() const { return pos_; }
+
+   private:
+    template <typename T>
+    bool Fixed(T& value, int bytes) {
+        if (end_ - pos_ < static_cast<size_t>(bytes)) {
+            return false;
+        }
+        value = 0;
+        for (int i = 0; i < bytes; ++i) {
+            value |= static_cast<T>(static_cast<uint8_t>(data_[pos_++])) << (8 * i);
+        }
+        return true;
+    }
+
+    const std::string& data_;
+    size_t pos_;
+    size_t end_;
+};
+
+}  // namespace
+
+std::string SampleWriter::ToBinary(const std::vector<CaseResult>& results) {
+    std::string index;
+    std::string data;
+    for (const auto& r : results) {
+        std::vector<std::pair<const char*, const std::vector<int64_t>*>> columns;
+        if (!r.wall_samples.empty()) {
+            columns.emplace_back("wall_ns", &r.wall_samples);
+            columns.emplace_back("cpu_ns", &r.cpu_samples);
+            for (const auto& counter : r.sample_counters) {
+                columns.emplace_back(counter.name.c_str(), &counter.values);
+            }
+        }
+
+        PutString(index, r.backend_id);
+        PutString(index, r.scene_id);
+        PutString(index, r.max_isa);
+        PutVarint(index, static_cast<uint64_t>(r.thread_count));
+        PutVarint(index, static_cast<uint64_t>(r.width));
+        PutVarint(index, static_cast<uint64_t>(r.height));
+        PutVarint(index, r.wall_samples.size());
+        PutVarint(index, columns.size());
+        for (const auto& [name, values] : columns) {
+            const std::string payload = EncodeColumn(*values);
+            PutString(index, name);
+            PutVarint(index, data.size());
+            PutVarint(index, payload.size());
+            data += payload;
+        }
+    }
+
+    std::string out(kSampleFileMagic, sizeof(kSampleFileMagic));
+    PutU32(out, kSampleFileVersion);
+    PutU32(out, static_cast<uint32_t>(results.size()));
+    PutU64(out, out.size() + 8 + index.size());
+    out += index;
+    out += data;
+    return out;
+}
+
+Status SampleWriter::Write(const std::filesystem::path& path,
+                           const std::vector<CaseResult>& results) {
+    // Ensure parent directory exists
+    if (path.has_parent_path()) {
+        std::error_code ec;
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec) {
+            return Status::IOError("Failed to create directory: " + path.parent_path().string() +
+                                   " (" + ec.message() + ")");
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        return Status::IOError("Failed to open file for writing: " + path.string());
+    }
+
+    const std::string image = ToBinary(results);
+    file.write(image.data(), static_cast<std::streamsize>(image.size()));
+    if (!file) {
+        return Status::IOError("Failed to write to file: " + path.string());
+    }
+
+    return Status::Ok();
+}
+
+Result<SampleReader> SampleReader::Open(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return Status::IOError("Failed to open file for reading: " + path.string());
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (file.bad()) {
+        return Status::IOError("Failed to read file: " + path.string());
+    }
+    return FromBinary(std::move(data));
+}
+
+Result<SampleReader> SampleReader::FromBinary(std::string data) {
+    SampleReader reader;
+    reader.data_ = std::move(data);
+    const std::string& image = reader.data_;
+    if (image.size() < sizeof(kSampleFileMagic) ||
+        std::memcmp(image.data(), kSampleFileMagic, sizeof(kSampleFileMagic)) != 0) {
+        return Status::InvalidArg("Not a sample file");
+    }
+
+    ByteReader header(image, sizeof(kSampleFileMagic), image.size());
+    uint32_t version = 0;
+    uint32_t case_count = 0;
+    if (!header.U32(version) || !header.U32(case_count) || !header.U64(reader.data_offset_)) {
+        return Status::InvalidArg("Truncated sample file header");
+    }
+    if (version != kSampleFileVersion) {
+        return Status::InvalidArg("Unsupported sample file version " + std::to_string(version));
+    }
+    if (reader.data_offset_ < header.pos() || reader.data_offset_ > image.size()) {
+        return Status::InvalidArg("Corrupt sample file index");
+    }
+
+    const uint64_t data_size = image.size() - reader.data_offset_;
+    ByteReader index(image, header.pos(), static_cast<size_t>(reader.data_offset_));
+    reader.cases_.reserve(std::min<size_t>(case_count, image.size()));  // Untrusted count
+    for (uint32_t i = 0; i < case_count; ++i) {
+        SampleCaseInfo info;
+        uint64_t column_count = 0;
+        if (!index.String(info.backend_id) || !index.String(info.scene_id) ||
+            !index.String(info.max_isa) || !index.Int(info.thread_count) ||
+            !index.Int(info.width) || !index.Int(info.height) ||
+            !index.Varint(info.sample_count) || !index.Varint(column_count)) {
+            return Status::InvalidArg("Corrupt sample file index");
+        }
+        for (uint64_t c = 0; c < column_count; ++c) {
+            SampleColumnInfo column;
+            if (!index.String(column.name) || !index.Varint(column.offset) ||
+                !index.Varint(column.size) || column.offset > data_size ||
+                column.size > data_size - column.offset ||
+                info.sample_count > column.size) {  // Every value takes at least one byte
+                return Status::InvalidArg("Corrupt sample file index");
+            }
+            info.columns.push_back(std::move(column));
+        }
+        reader.cases_.push_back(std::move(info));
+    }
+    if (!index.AtEnd()) {
+        return Status::InvalidArg("Corrupt sample file index");
+    }
+    return reader;
+}
+
+Result<std::vector<int64_t>> SampleReader::ReadColumn(size_t case_index,
+                                                      const std::string& name) const {
+    if (case_index >= cases_.size()) {
+        return Status::NotFound("No case " + std::to_string(case_index) + " in sample file");
+    }
+    const auto& info = cases_[case_index];
+    for (const auto& column : info.columns) {
+        if (column.name != name) {
+            continue;
+        }
+        const auto begin = static_cast<size_t>(data_offset_ + column.offset);
+        ByteReader payload(data_, begin, begin + static_cast<size_t>(column.size));
+        std::vector<int64_t> values;
+        values.reserve(static_cast<size_t>(info.sample_count));
+        uint64_t previous = 0;
+        while (!payload.AtEnd()) {
+            uint64_t zigzag = 0;
+            if (!payload.Varint(zigzag)) {
+                return Status::InvalidArg("Corrupt column '" + name + "' in sample file");
+            }
+            previous += (zigzag >> 1) ^ (~(zigzag & 1) + 1);
+            values.push_back(static_cast<int64_t>(previous));
+        }
+        if (values.size() != info.sample_count) {
+            return Status::InvalidArg("Column '" + name + "' has the wrong sample count");
+        }
+        return values;
+    }
+    return Status::NotFound("No column '" + name + "' for case " + std::to_string(case_index));
+}
+
+}  // namespace vgcpu
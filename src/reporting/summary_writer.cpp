@@ -6,8 +6,11 @@
 
 #include "reporting/reporter.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <string>
+#include <vector>
 
 namespace vgcpu {
 
@@ -46,16 +49,114 @@ void SummaryWriter::PrintSummary(const RunMetadata& metadata,
               << metadata.environment.os_version << "\n";
     std::cout << "  Arch:      " << metadata.environment.arch << "\n";
     std::cout << "  CPU:       " << metadata.environment.cpu_model << "\n";
+    std::cout << "  ISA:       " << metadata.environment.isa_level << " (";
+    for (size_t i = 0; i < metadata.environment.cpu_features.size(); ++i) {
+        std::cout << (i > 0 ? " " : "") << metadata.environment.cpu_features[i];
+    }
+    std::cout << ")\n";
     std::cout << "  Cores:     " << metadata.environment.cpu_cores << "\n";
     std::cout << "  Compiler:  " << metadata.environment.compiler_name << " "
               << metadata.environment.compiler_version << "\n";
+    if (!metadata.environment.noise.empty()) {
+        std::cout << "  Noise:    ";
+        for (const auto& source : metadata.environment.noise) {
+            std::cout << " " << source;
+        }
+        std::cout << "\n";
+    }
     std::cout << "  Timestamp: " << metadata.run_timestamp << "\n\n";
 
     // Policy info
     std::cout << "Benchmark Policy:\n";
-    std::cout << "  Warmup:      " << metadata.policy.warmup_iterations << " iterations\n";
-    std::cout << "  Measurement: " << metadata.policy.measurement_iterations << " iterations\n";
-    std::cout << "  Repetitions: " << metadata.policy.repetitions << "\n\n";
+    if (metadata.policy.auto_warmup) {
+        std::cout << "  Warmup:      auto, " << metadata.policy.warmup_iterations << ".."
+                  << metadata.policy.max_warmup_iterations << " iterations until settled\n";
+    } else {
+        std::cout << "  Warmup:      " << metadata.policy.warmup_iterations << " iterations\n";
+    }
+    if (metadata.policy.target_ci > 0.0) {
+        std::cout << "  Measurement: " << metadata.policy.measurement_iterations << ".."
+                  << metadata.policy.max_iterations << " iterations until +-"
+                  << metadata.policy.target_ci * 100.0 << "% median CI (budget "
+                  << metadata.policy.time_budget_s << "s)\n";
+    } else {
+        std::cout << "  Measurement: " << metadata.policy.measurement_iterations << " iterations\n";
+    }
+    std::cout << "  Repetitions: " << metadata.policy.repetitions << "\n";
+    if (metadata.policy.jobs > 1) {
+        std::cout << "  Jobs:        " << metadata.policy.jobs << " x "
+                  << metadata.policy.cores_per_job << " cores\n";
+    }
+    if (!metadata.policy.isolation.empty()) {
+        std::cout << "  Isolation:   forked child per " << metadata.policy.isolation;
+        if (metadata.policy.case_timeout_s > 0.0) {
+            std::cout << ", " << metadata.policy.case_timeout_s << "s case timeout";
+        }
+        std::cout << "\n";
+    }
+    // Execution controls as applied (main.cpp drops what the OS refused)
+    std::vector<std::string> controls;
+    if (metadata.policy.orchestrator_cpu >= 0) {
+        controls.push_back("measuring on CPU " + std::to_string(metadata.policy.orchestrator_cpu));
+    }
+    if (!metadata.policy.worker_cpus.empty()) {
+        std::string cpus;
+        for (const int cpu : metadata.policy.worker_cpus) {
+            cpus += (cpus.empty() ? "" : ",") + std::to_string(cpu);
+        }
+        controls.push_back("workers on CPUs " + cpus);
+    }
+    if (metadata.policy.fifo_priority > 0) {
+        controls.push_back("SCHED_FIFO " + std::to_string(metadata.policy.fifo_priority));
+    }
+    if (metadata.policy.lock_memory) {
+        controls.emplace_back("mlockall");
+    }
+    if (metadata.policy.prefault) {
+        controls.emplace_back("prefault");
+    }
+    if (!controls.empty()) {
+        std::cout << "  Execution:   ";
+        for (size_t i = 0; i < controls.size(); ++i) {
+            std::cout << (i > 0 ? ", " : "") << controls[i];
+        }
+        std::cout << "\n";
+    }
+    if (metadata.policy.rotate_buffers > 0 || metadata.policy.evict_llc) {
+        std::cout << "  Cold buffers: " << std::max(1, metadata.policy.rotate_buffers)
+                  << " rotated scene copies and buffers"
+                  << (metadata.policy.evict_llc ? ", LLC evicted before each frame" : "") << "\n";
+    }
+    // Output buffer layout and backing (main.cpp drops huge pages/NUMA binding if unavailable)
+    const auto& memory = metadata.policy.surface_memory;
+    std::vector<std::string> surface;
+    if (metadata.policy.pad_stride) {
+        surface.emplace_back("padded rows");
+    }
+    if (memory.alignment > 0) {
+        surface.push_back(std::to_string(memory.alignment) + "-byte aligned");
+    }
+    if (memory.huge_pages != pal::HugePages::kOff) {
+        surface.push_back(std::string(pal::HugePagesName(memory.huge_pages)) + " huge pages");
+    }
+    if (memory.numa == pal::NumaPlacement::kLocal) {
+        surface.emplace_back("NUMA-local");
+    }
+    if (!surface.empty()) {
+        std::cout << "  Surface:     ";
+        for (size_t i = 0; i < surface.size(); ++i) {
+            std::cout << (i > 0 ? ", " : "") << surface[i];
+        }
+        std::cout << "\n";
+    }
+    if (metadata.policy.instances > 0) {
+        std::cout << "  Instances:   " << metadata.policy.instances << " concurrent for "
+                  << metadata.policy.instance_time_s << "s\n";
+    }
+    if (!metadata.policy.baseline_backend.empty()) {
+        std::cout << "  Baseline:    " << metadata.policy.baseline_backend << " (net p50 shown)\n";
+    }
+    std::cout << "\n";
 
     // Count outcomes
     int executed = 0, skipped = 0, failed = 0;
@@ -82,9 +183,9 @@ void SummaryWriter::PrintSummary(const RunMetadata& metadata,
     if (!results.empty()) {
         std::cout << std::left << std::setw(12) << "Backend" << std::setw(24) << "Scene"
                   << std::setw(8) << "Status" << std::right << std::setw(12) << "Wall p50"
-                  << std::setw(12) << "CPU p50"
+                  << std::setw(12) << "Wall p99" << std::setw(12) << "CPU p50"
                   << "\n";
-        std::cout << std::string(68, '-') << "\n";
+        std::cout << std::string(80, '-') << "\n";
 
         for (const auto& r : results) {
             std::cout << std::left << std::setw(12) << r.backend_id << std::setw(24) << r.scene_id
@@ -93,7 +194,56 @@ void SummaryWriter::PrintSummary(const RunMetadata& metadata,
             if (r.decision == CaseDecision::kExecute) {
                 std::cout << std::right << std::fixed << std::setprecision(2) << std::setw(10)
                           << NsToMs(r.stats.wall_p50_ns) << "ms" << std::setw(10)
+                          << NsToMs(r.stats.wall_p99_ns) << "ms" << std::setw(10)
                           << NsToMs(r.stats.cpu_p50_ns) << "ms";
+                if (r.stats.wall_outliers > 0) {
+                    std::cout << "  " << r.stats.wall_outliers << " outliers";
+                }
+                if (!r.baseline_id.empty()) {
+                    std::cout << "  net " << NsToMs(r.net_wall_p50_ns) << "ms";
+                }
+                if (!r.scaling_reference_id.empty()) {
+                    std::cout << "  x" << r.speedup_vs_serial << " vs " << r.scaling_reference_id
+                              << " at " << r.thread_count << "t (eff "
+                              << r.parallel_efficiency * 100.0 << "%, serial "
+                              << r.serial_fraction * 100.0 << "%)";
+                }
+                if (r.multi_instance.instance_count > 0) {
+                    std::cout << "  " << r.multi_instance.instance_count << " inst "
+                              << r.multi_instance.aggregate_fps << " fps (eff "
+                              << r.multi_instance.scaling_efficiency * 100.0 << "%, p99 "
+                              << NsToMs(r.multi_instance.latency_p99_ns) << "ms)";
+                }
+                if (r.stroke_isolation.stroke_count > 0) {
+                    std::cout << "  stroker " << NsToMs(r.stroke_isolation.stroker_p50_ns)
+                              << "ms + fill " << NsToMs(r.stroke_isolation.fill_wall_p50_ns)
+                              << "ms";
+                }
+                if (r.flattened.curve_count > 0) {
+                    std::cout << "  flat " << NsToMs(r.flattened.wall_p50_ns) << "ms";
+                }
+                if (r.cold_buffers.rotation > 0) {
+                    std::cout << "  cold " << NsToMs(r.cold_buffers.wall_p50_ns) << "ms (x"
+                              << r.cold_buffers.cold_warm_ratio << ")";
+                }
+                if (!r.max_isa.empty()) {
+                    std::cout << "  isa<=" << r.max_isa;
+                }
+                if (metadata.policy.auto_warmup) {
+                    std::cout << "  warm " << r.warmup_frames << " (first "
+                              << NsToMs(r.first_frame_ns) << "ms)";
+                }
+                if (r.repetitions.count > 0 && r.stats.wall_mean_ns > 0.0) {
+                    std::cout << "  x" << r.repetitions.count << " runs sd between "
+                              << r.repetitions.between_stddev_ns / r.stats.wall_mean_ns * 100.0
+                              << "% within "
+                              << r.repetitions.within_stddev_ns / r.stats.wall_mean_ns * 100.0
+                              << "%";
+                }
+                if (!r.sampling_stop.empty()) {
+                    std::cout << "  +-" << r.stats.wall_ci_rel * 100.0 << "% n="
+                              << r.stats.sample_count << " (" << r.sampling_stop << ")";
+                }
             } else if (!r.reasons.empty()) {
                 std::cout << "  (" << r.reasons[0] << ")";
             }
@@ -0,0 +1,20 @@
+// tests/plugin_probe.cpp
+// Blueprint Reference: [TEST-10], [ARCH-10-06]
+// Backend plugin used by the registry tests to exercise lazy plugin loading
+
+#include "plugin_probe.h"
+
+#include "adapters/adapter_registry.h"
+#include "adapters/null/null_adapter.h"
+
+namespace vgcpu {
+
+void RegisterPluginProbe() {
+    auto& registry = AdapterRegistry::Instance();
+    registry.Register("plugin_probe", "Plugin Probe",
+                      []() { return std::make_unique<NullAdapter>(); });
+    registry.RegisterVariant("plugin_probe", "lazy", "Plugin Probe [lazy]",
+                             []() { return std::make_unique<NullAdapter>(); });
+}
+
+}  // namespace vgcpu
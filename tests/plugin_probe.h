@@ -0,0 +1,12 @@
+// tests/plugin_probe.h
+// Blueprint Reference: [TEST-10], [ARCH-10-06]
+// Backend plugin used by the registry tests to exercise lazy plugin loading
+
+#pragma once
+
+namespace vgcpu {
+
+/// Register "plugin_probe" (a null renderer) and its "plugin_probe:lazy" variant.
+void RegisterPluginProbe();
+
+}  // namespace vgcpu
@@ -1,9 +1,11 @@
 #include "doctest.h"
 #include "vgcpu/artifacts/naming.hpp"
+#include "vgcpu/artifacts/pixel_convert.hpp"
 #include "vgcpu/artifacts/png_reader.hpp"
 #include "vgcpu/artifacts/png_writer.hpp"
 #include "vgcpu/artifacts/ssim_compare.hpp"
 
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <vector>
@@ -69,3 +71,54 @@ TEST_CASE("PNG Writer & SSIM") {
     // Cleanup
     std::filesystem::remove(filename);
 }
+
+TEST_CASE("Pixel conversion swizzles and unpremultiplies") {
+    using vgcpu::PixelFormat;
+    // Premultiplied BGRA: opaque red, half-transparent green, transparent black
+    std::vector<uint8_t> bgra = {0, 0, 255, 255, 0, 128, 0, 128, 0, 0, 0, 0};
+    std::vector<uint8_t> rgba(bgra.size());
+    REQUIRE(convert_pixels(bgra, PixelFormat::kBgra8Premul, rgba, PixelFormat::kRgba8));
+    CHECK(rgba == std::vector<uint8_t>{255, 0, 0, 255, 0, 255, 0, 128, 0, 0, 0, 0});
+
+    // Round trip back to premultiplied BGRA is exact for these values
+    std::vector<uint8_t> back(rgba.size());
+    REQUIRE(convert_pixels(rgba, PixelFormat::kRgba8, back, PixelFormat::kBgra8Premul));
+    CHECK(back == bgra);
+
+    // Same format is a copy; undersized destinations are rejected
+    CHECK(convert_pixels(bgra, PixelFormat::kBgra8Premul, back, PixelFormat::kBgra8Premul));
+    CHECK(back == bgra);
+    std::vector<uint8_t> small(4);
+    CHECK(!convert_pixels(bgra, PixelFormat::kBgra8Premul, small, PixelFormat::kRgba8));
+}
+
+TEST_CASE("Vectorized pixel conversion matches the scalar reference") {
+    using vgcpu::PixelFormat;
+    // Every (color, alpha) pair, including invalid premultiplied colors above alpha; an odd
+    // pixel count exercises the scalar tail.
+    std::vector<uint8_t> src;
+    for (int a = 0; a < 256; ++a) {
+        for (int c = 0; c < 256; ++c) {
+            src.insert(src.end(), {static_cast<uint8_t>(c), static_cast<uint8_t>(255 - c),
+                                   static_cast<uint8_t>(c / 2), static_cast<uint8_t>(a)});
+        }
+    }
+    src.insert(src.end(), {7, 9, 11, 13});
+
+    const PixelFormat formats[] = {PixelFormat::kRgba8Premul, PixelFormat::kBgra8Premul,
+                                   PixelFormat::kRgba8, PixelFormat::kBgra8};
+    CAPTURE(convert_pixels_isa());
+    for (auto from : formats) {
+        for (auto to : formats) {
+            std::vector<uint8_t> expected(src.size()), actual(src.size());
+            REQUIRE(convert_pixels_scalar(src, from, expected, to));
+            REQUIRE(convert_pixels(src, from, actual, to));
+            CHECK(actual == expected);
+
+            // In place
+            std::vector<uint8_t> inplace = src;
+            REQUIRE(convert_pixels(inplace, from, inplace, to));
+            CHECK(inplace == expected);
+        }
+    }
+}
@@ -0,0 +1,104 @@
+// tests/test_baseline.cpp
+// Blueprint Reference: [TEST-10], [ARCH-10-08]
+// Unit tests for the decode-only baseline adapter and baseline subtraction
+
+#include "adapters/decode/decode_adapter.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "ir/ir_format.h"
+#include "ir/ir_loader.h"
+
+#include <cstring>
+
+namespace vgcpu {
+
+TEST_SUITE("Decode Baseline") {
+    TEST_CASE("DecodeAdapter walks and flattens the test scene" *
+              doctest::test_suite("baseline")) {
+        auto scene = ir::IrLoader::CreateTestScene(400, 300);
+        SurfaceConfig config;
+        config.width = 400;
+        config.height = 300;
+        SurfaceBuffer buffer(static_cast<size_t>(config.width) * config.height * 4, 0);
+
+        DecodeAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        REQUIRE(adapter.Prepare(scene).ok());
+        REQUIRE(adapter.Render(scene, config, buffer).ok());
+
+        CHECK(adapter.GetInfo().id == "decode");
+        CHECK(adapter.GetDrawCount() == 1);
+        CHECK(adapter.GetFlattenedPointCount() == 4);
+
+        adapter.Shutdown();
+    }
+
+    TEST_CASE("DecodeAdapter flattens curves under the current transform" *
+              doctest::test_suite("baseline")) {
+        auto scene = ir::IrLoader::CreateTestScene(400, 300);
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kCubicTo,
+                                ir::PathVerb::kClose};
+        scene.paths[0].points = {0.0f, 0.0f, 100.0f, 200.0f, 200.0f, -200.0f, 300.0f, 0.0f};
+
+        // Prefix the stream with a 2x scale so flattening runs in device space
+        const float m[6] = {2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f};
+        std::vector<uint8_t> prefix(1 + sizeof(m));
+        prefix[0] = static_cast<uint8_t>(ir::Opcode::kSetMatrix);
+        std::memcpy(prefix.data() + 1, m, sizeof(m));
+        scene.command_stream.insert(scene.command_stream.begin(), prefix.begin(), prefix.end());
+
+        DecodeAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        REQUIRE(adapter.Prepare(scene).ok());
+        CHECK(adapter.GetDrawCount() == 1);
+        // Wang: ceil(sqrt(0.75 * 600 * 2 / 0.25)) = 60 segments in device space (43 unscaled)
+        CHECK(adapter.GetFlattenedPointCount() == 61);
+    }
+
+    TEST_CASE("DecodeAdapter restarts at the contour start after a close" *
+              doctest::test_suite("baseline")) {
+        auto scene = ir::IrLoader::CreateTestScene(400, 300);
+        // Two triangles sharing (0,0); the second has no kMoveTo of its own
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kClose,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kClose};
+        scene.paths[0].points = {0.0f, 0.0f, 10.0f, 0.0f, 10.0f, 10.0f, 0.0f, 10.0f, -10.0f, 0.0f};
+
+        DecodeAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        REQUIRE(adapter.Prepare(scene).ok());
+        CHECK(adapter.GetFlattenedPointCount() == 6);
+    }
+
+    TEST_CASE("ApplyBaseline subtracts matching decode timings" *
+              doctest::test_suite("baseline")) {
+        CaseResult base;
+        base.backend_id = "decode";
+        base.scene_id = "fills/solid_basic";
+        base.width = 800;
+        base.height = 600;
+        base.decision = CaseDecision::kExecute;
+        base.stats.wall_p50_ns = 1000;
+        base.stats.cpu_p50_ns = 900;
+
+        CaseResult backend = base;
+        backend.backend_id = "blend2d";
+        backend.stats.wall_p50_ns = 5000;
+        backend.stats.cpu_p50_ns = 500;
+
+        CaseResult other_scene = backend;
+        other_scene.scene_id = "fills/nested_rects";
+
+        std::vector<CaseResult> results = {base, backend, other_scene};
+        Harness::ApplyBaseline(results, "decode");
+
+        CHECK(results[0].baseline_id.empty());
+        CHECK(results[1].baseline_id == "decode");
+        CHECK(results[1].net_wall_p50_ns == 4000);
+        CHECK(results[1].net_cpu_p50_ns == 0);  // Clamped, never negative
+        CHECK(results[2].baseline_id.empty());
+    }
+}
+
+}  // namespace vgcpu
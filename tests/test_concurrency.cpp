@@ -3,8 +3,11 @@
 // Unit tests for thread-safety and idempotency of Render()
 
 #include "adapters/adapter_registry.h"
+#include "adapters/null/null_adapter.h"
 #include "doctest.h"
+#include "harness/scheduler.h"
 #include "ir/ir_loader.h"
+#include "pal/affinity.h"
 
 #include <atomic>
 #include <thread>
@@ -41,7 +44,7 @@ TEST_SUITE("Concurrency & Idempotency") {
 
             // Run concurrent rendering
             const int kThreadCount = 4;
-            std::vector<std::vector<uint8_t>> buffers(kThreadCount);
+            std::vector<SurfaceBuffer> buffers(kThreadCount);
             std::vector<std::thread> threads;
             std::atomic<bool> success{true};
             std::string error_msg;
@@ -78,6 +81,65 @@ TEST_SUITE("Concurrency & Idempotency") {
             adapter->Shutdown();
         }
     }
+
+    TEST_CASE("CaseScheduler runs cases on slots in a deterministic assignment" *
+              doctest::test_suite("concurrency")) {
+        auto first = ir::IrLoader::CreateTestScene(32, 32);
+        auto second = ir::IrLoader::CreateTestScene(16, 16);
+        second.scene_id = "test/second";
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 3;
+
+        // Two configurations of "null" (e.g. ISA caps) and an unknown backend, over two scenes
+        std::vector<CaseSpec> cases;
+        AdapterArgs capped;
+        capped.max_isa = pal::IsaLevel::kScalar;
+        for (const auto& args : {AdapterArgs{}, capped}) {
+            for (const auto* scene : {&first, &second}) {
+                cases.push_back({"null", args, policy, scene});
+            }
+        }
+        cases.push_back({"missing", AdapterArgs{}, policy, &first});
+
+        // One slot per backend and scene (artifact path), dealt round-robin
+        const auto slots = CaseScheduler::AssignSlots(cases, 2);
+        CHECK(slots == std::vector<int>{0, 1, 0, 1, 0});
+        CHECK(CaseScheduler::AssignSlots(cases, 2) == slots);
+
+        std::atomic<int> created{0};
+        auto factory = [&](const std::string& id) -> std::unique_ptr<IBackendAdapter> {
+            if (id != "null") {
+                return nullptr;
+            }
+            ++created;
+            return std::make_unique<NullAdapter>();
+        };
+        const auto allowed = pal::GetAllowedCpus();
+        auto results = CaseScheduler::Run(cases, factory, {2, 1});
+        REQUIRE(results.size() == cases.size());
+        CHECK(created == 4);  // One instance per slot and configuration
+        for (size_t i = 0; i + 1 < results.size(); ++i) {
+            CAPTURE(i);
+            CHECK(results[i].decision == CaseDecision::kExecute);
+            CHECK(results[i].scene_id == cases[i].scene->scene_id);
+            CHECK(results[i].slot == slots[i]);
+            if (results[i].first_core >= 0) {
+                // OS CPU IDs, not indices into the allowed set
+                REQUIRE(static_cast<size_t>(slots[i]) < allowed.size());
+                CHECK(results[i].first_core == allowed[static_cast<size_t>(slots[i])]);
+                CHECK(results[i].core_count == 1);
+            }
+        }
+        CHECK(results.back().decision == CaseDecision::kFail);
+        REQUIRE(!results.back().reasons.empty());
+        CHECK(results.back().reasons[0].starts_with("INIT_FAILED"));
+
+        // A single job runs inline and leaves the results unassigned
+        auto serial = CaseScheduler::Run(cases, factory, {1, 1});
+        CHECK(serial[0].decision == CaseDecision::kExecute);
+        CHECK(serial[0].slot == -1);
+    }
 }
 
 }  // namespace vgcpu
@@ -0,0 +1,157 @@
+// tests/test_flatten.cpp
+// Blueprint Reference: [TEST-10], [ARCH-12-01d]
+// Unit tests for the prepare-time curve flattener and the harness flattened variant
+
+#include "adapters/null/null_adapter.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "ir/ir_loader.h"
+#include "ir/path_flattener.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace vgcpu {
+
+namespace {
+
+/// One cubic from (0, 0) to (100, 0) bulging up to y = 75.
+Path MakeCubic() {
+    Path path;
+    path.verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kCubicTo, ir::PathVerb::kClose};
+    path.points = {0.0f, 0.0f, 0.0f, 100.0f, 100.0f, 100.0f, 100.0f, 0.0f};
+    return path;
+}
+
+/// Point of MakeCubic() at parameter t.
+std::array<float, 2> CubicAt(float t) {
+    const float u = 1.0f - t;
+    const float w1 = 3.0f * u * u * t;
+    const float w2 = 3.0f * u * t * t;
+    return {w2 * 100.0f + t * t * t * 100.0f, (w1 + w2) * 100.0f};
+}
+
+/// Distance from (px, py) to the segment (ax, ay)-(bx, by).
+float SegmentDistance(float px, float py, float ax, float ay, float bx, float by) {
+    const float dx = bx - ax;
+    const float dy = by - ay;
+    const float len2 = dx * dx + dy * dy;
+    const float t = len2 > 0.0f ? std::clamp(((px - ax) * dx + (py - ay) * dy) / len2, 0.0f, 1.0f)
+                                : 0.0f;
+    return std::hypot(px - (ax + t * dx), py - (ay + t * dy));
+}
+
+/// A scene that fills MakeCubic() under a uniform `scale`.
+PreparedScene MakeCurvedScene(float scale) {
+    auto scene = ir::IrLoader::CreateTestScene(32, 32);
+    scene.paths = {MakeCubic()};
+    auto& cs = scene.command_stream;
+    cs.pop_back();  // kEnd
+
+    const float m[6] = {scale, 0.0f, 0.0f, scale, 0.0f, 0.0f};
+    cs.push_back(static_cast<uint8_t>(ir::Opcode::kConcatMatrix));
+    cs.insert(cs.end(), reinterpret_cast<const uint8_t*>(m),
+              reinterpret_cast<const uint8_t*>(m) + sizeof(m));
+    cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kFillPath), 0x00, 0x00});
+    cs.push_back(static_cast<uint8_t>(ir::Opcode::kEnd));
+    return scene;
+}
+
+}  // namespace
+
+TEST_SUITE("Flatten") {
+    TEST_CASE("FlattenPath replaces curves with lines within tolerance" *
+              doctest::test_suite("flatten")) {
+        const float tolerance = 0.25f;
+        int curves = 0;
+        const Path flat = ir::FlattenPath(MakeCubic(), tolerance, &curves);
+        CHECK(curves == 1);
+
+        REQUIRE(flat.verbs.size() > 8);  // Enough segments for the vector path and its tail
+        CHECK(flat.verbs.front() == ir::PathVerb::kMoveTo);
+        CHECK(flat.verbs.back() == ir::PathVerb::kClose);
+        for (size_t i = 1; i + 1 < flat.verbs.size(); ++i) {
+            CHECK(flat.verbs[i] == ir::PathVerb::kLineTo);
+        }
+        REQUIRE(flat.points.size() == (flat.verbs.size() - 1) * 2);
+        CHECK(flat.points[flat.points.size() - 2] == 100.0f);  // Exact endpoint
+        CHECK(flat.points.back() == 0.0f);
+
+        // Every polyline vertex lies on the curve, and the curve stays within tolerance of it
+        const size_t segments = flat.verbs.size() - 2;
+        for (size_t i = 0; i <= segments; ++i) {
+            const auto on = CubicAt(static_cast<float>(i) / static_cast<float>(segments));
+            CHECK(flat.points[i * 2] == doctest::Approx(on[0]).epsilon(1e-4));
+            CHECK(flat.points[i * 2 + 1] == doctest::Approx(on[1]).epsilon(1e-4));
+        }
+        float max_error = 0.0f;
+        for (int k = 0; k <= 1000; ++k) {
+            const auto p = CubicAt(static_cast<float>(k) / 1000.0f);
+            float best = 1e9f;
+            for (size_t i = 0; i < segments; ++i) {
+                const float* s = flat.points.data() + i * 2;
+                best = std::min(best, SegmentDistance(p[0], p[1], s[0], s[1], s[2], s[3]));
+            }
+            max_error = std::max(max_error, best);
+        }
+        CHECK(max_error <= tolerance);
+    }
+
+    TEST_CASE("FlattenPath starts a curve after kClose at the contour start" *
+              doctest::test_suite("flatten")) {
+        Path path;
+        path.verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo, ir::PathVerb::kClose,
+                      ir::PathVerb::kQuadTo};
+        path.points = {0.0f, 0.0f, 50.0f, 50.0f, 50.0f, -50.0f, 100.0f, 0.0f};
+
+        const Path flat = ir::FlattenPath(path, 0.25f);
+        REQUIRE(flat.points.size() == (2 + 10) * 2);  // Wang: sqrt(0.25 * 100 / 0.25) = 10
+        CHECK(flat.points[4] == doctest::Approx(10.0f));  // t = 0.1 from (0, 0), not (50, 50)
+        CHECK(flat.points[5] == doctest::Approx(-9.0f));
+    }
+
+    TEST_CASE("FlattenScene tightens the tolerance for scaled draws" *
+              doctest::test_suite("flatten")) {
+        auto plain = ir::FlattenScene(MakeCurvedScene(1.0f), 0.25f);
+        int curves = 0;
+        auto scaled = ir::FlattenScene(MakeCurvedScene(4.0f), 0.25f, &curves);
+        REQUIRE(plain.ok());
+        REQUIRE(scaled.ok());
+        CHECK(curves == 1);
+        CHECK(scaled.value().paths[0].verbs.size() > plain.value().paths[0].verbs.size());
+        CHECK(scaled.value().command_stream == MakeCurvedScene(4.0f).command_stream);
+
+        CHECK(ir::FlattenScene(MakeCurvedScene(1.0f), 0.0f).failed());
+
+        auto scales = ir::PathScales(MakeCurvedScene(4.0f));
+        REQUIRE(scales.ok());
+        CHECK(scales.value() == std::vector<float>{4.0f});
+        std::vector<Path> reused(1);
+        CHECK(ir::FlattenPaths({MakeCubic()}, scales.value(), 0.25f, reused) == 1);
+        CHECK(reused[0].verbs == scaled.value().paths[0].verbs);
+    }
+
+    TEST_CASE("RunCase times the flattened scene when a tolerance is set" *
+              doctest::test_suite("flatten")) {
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 3;
+        policy.flatten_tolerance = 0.5f;
+
+        NullAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        auto result = Harness::RunCase(adapter, MakeCurvedScene(2.0f), policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.flattened.curve_count == 1);
+        CHECK(result.flattened.tolerance == doctest::Approx(0.5f));
+        CHECK(result.flattened.flatten_p50_ns >= 0);
+
+        // Line-only scenes have nothing to flatten
+        auto lines = Harness::RunCase(adapter, ir::IrLoader::CreateTestScene(32, 32), policy);
+        REQUIRE(lines.decision == CaseDecision::kExecute);
+        CHECK(lines.flattened.curve_count == 0);
+    }
+}
+
+}  // namespace vgcpu
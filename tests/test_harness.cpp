@@ -0,0 +1,661 @@
+// tests/test_harness.cpp
+// Blueprint Reference: [TEST-10], [ARCH-10-08], [ARCH-13-02b]
+// Unit tests for the harness measured loop
+
+#include "adapters/null/null_adapter.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "harness/statistics.h"
+#include "ir/ir_loader.h"
+#include "pal/affinity.h"
+#include "pal/timer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vgcpu {
+
+namespace {
+
+/// Null renderer that counts frames.
+class CountingAdapter : public NullAdapter {
+   public:
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override {
+        ++frames;
+        return NullAdapter::Render(scene, config, output_buffer);
+    }
+
+    int frames = 0;
+};
+
+/// Null renderer that records which scene and buffer every frame used.
+class AddressAdapter : public CountingAdapter {
+   public:
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override {
+        scenes.insert(&scene);
+        buffers.insert(output_buffer.data());
+        return CountingAdapter::Render(scene, config, output_buffer);
+    }
+
+    std::set<const PreparedScene*> scenes;
+    std::set<const uint8_t*> buffers;
+};
+
+/// Null renderer that records the surface layout it was given.
+class LayoutAdapter : public CountingAdapter {
+   public:
+    explicit LayoutAdapter(bool stride_support) : stride_support_(stride_support) {}
+
+    CapabilitySet GetCapabilities() const override {
+        CapabilitySet caps = CountingAdapter::GetCapabilities();
+        caps.supports_surface_stride = stride_support_;
+        return caps;
+    }
+
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override {
+        stride = SurfaceStride(config);
+        buffer_size = output_buffer.size();
+        address = reinterpret_cast<uintptr_t>(output_buffer.data());
+        return CountingAdapter::Render(scene, config, output_buffer);
+    }
+
+    int stride = 0;
+    size_t buffer_size = 0;
+    uintptr_t address = 0;
+
+   private:
+    bool stride_support_;
+};
+
+/// Null renderer whose frames alternate between ~2us and ~50us, so the median never settles.
+class JitterAdapter : public CountingAdapter {
+   public:
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override {
+        const int64_t spin_ns = frames % 2 == 0 ? 2'000 : 50'000;
+        const auto start = pal::NowMonotonic();
+        while (pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic())) < spin_ns) {
+        }
+        return CountingAdapter::Render(scene, config, output_buffer);
+    }
+};
+
+/// Null renderer with a cold start: frame i spins 20us + 2ms * 0.8^i, like a JIT or cache warming.
+class DecayAdapter : public CountingAdapter {
+   public:
+    Status Render(const PreparedScene& scene, const SurfaceConfig& config,
+                  SurfaceView output_buffer) override {
+        const auto spin_ns = static_cast<int64_t>(20'000 + 2'000'000 * std::pow(0.8, frames));
+        const auto start = pal::NowMonotonic();
+        while (pal::ToNanoseconds(pal::Elapsed(start, pal::NowMonotonic())) < spin_ns) {
+        }
+        return CountingAdapter::Render(scene, config, output_buffer);
+    }
+};
+
+/// Null renderer that tracks pipelined submissions per slot.
+class PipelinedAdapter : public NullAdapter {
+   public:
+    Status SubmitFrame(const PreparedScene& scene, const SurfaceConfig& config,
+                       SurfaceView output_buffer, uint32_t slot) override {
+        if (busy.size() <= slot) {
+            busy.resize(slot + 1, false);
+        }
+        if (busy[slot]) {
+            return Status::Fail("slot reused before WaitFrame");
+        }
+        busy[slot] = true;
+        ++submits;
+        ++in_flight;
+        max_in_flight = std::max(max_in_flight, in_flight);
+        return NullAdapter::Render(scene, config, output_buffer);
+    }
+
+    Status WaitFrame(uint32_t slot) override {
+        if (slot < busy.size() && busy[slot]) {
+            busy[slot] = false;
+            --in_flight;
+        }
+        return Status::Ok();
+    }
+
+    std::vector<bool> busy;
+    int submits = 0;
+    int in_flight = 0;
+    int max_in_flight = 0;
+};
+
+/// Null renderer whose "stroker" returns the centerline unchanged.
+class OutliningAdapter : public CountingAdapter {
+   public:
+    Result<Path> StrokeToPath(const Path& path, const StrokeParams& stroke) override {
+        last_stroke = stroke;
+        ++outlined;
+        return path;
+    }
+
+    StrokeParams last_stroke;
+    int outlined = 0;
+};
+
+/// The test rectangle stroked (width 4, round caps) under a 2x scale, then filled.
+PreparedScene MakeStrokedScene() {
+    auto scene = ir::IrLoader::CreateTestScene(32, 32);
+    auto& cs = scene.command_stream;
+    cs.pop_back();  // kEnd
+
+    const float scale[6] = {2.0f, 0.0f, 0.0f, 2.0f, 0.0f, 0.0f};
+    cs.push_back(static_cast<uint8_t>(ir::Opcode::kConcatMatrix));
+    cs.insert(cs.end(), reinterpret_cast<const uint8_t*>(scale),
+              reinterpret_cast<const uint8_t*>(scale) + sizeof(scale));
+
+    const float width = 4.0f;
+    cs.push_back(static_cast<uint8_t>(ir::Opcode::kSetStroke));
+    cs.insert(cs.end(), {0x00, 0x00});
+    cs.insert(cs.end(), reinterpret_cast<const uint8_t*>(&width),
+              reinterpret_cast<const uint8_t*>(&width) + sizeof(width));
+    cs.push_back(ir::PackStrokeOptions(ir::StrokeCap::kRound, ir::StrokeJoin::kMiter));
+    cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kStrokePath), 0x00, 0x00});
+    cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kFillPath), 0x00, 0x00});
+    cs.push_back(static_cast<uint8_t>(ir::Opcode::kEnd));
+    return scene;
+}
+
+}  // namespace
+
+TEST_SUITE("Harness") {
+    TEST_CASE("RunCase times batches of frames and reports per-frame samples" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        CountingAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 2;
+        policy.measurement_iterations = 5;
+        policy.batch_frames = 8;
+        auto result = Harness::RunCase(adapter, scene, policy);
+
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.batch_frames == 8);
+        CHECK(result.stats.sample_count == 5);
+        CHECK(adapter.frames == 2 + 5 * 8);
+    }
+
+    TEST_CASE("Median confidence interval uses distribution-free order statistics" *
+              doctest::test_suite("harness")) {
+        std::vector<int64_t> sorted(100);
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            sorted[i] = static_cast<int64_t>(i + 1) * 10;
+        }
+        // n = 100: ranks 40 and 61 (1-based)
+        const auto [low, high] = MedianConfidenceInterval(sorted);
+        CHECK(low == 400);
+        CHECK(high == 610);
+        CHECK(RelativeMedianCi(sorted) == doctest::Approx((610.0 - 400.0) / 2.0 / 505.0));
+
+        // Tiny samples clamp to the sample range
+        const std::vector<int64_t> three = {10, 20, 30};
+        CHECK(MedianConfidenceInterval(three) == std::pair<int64_t, int64_t>{10, 30});
+        CHECK(MedianConfidenceInterval({}) == std::pair<int64_t, int64_t>{0, 0});
+    }
+
+    TEST_CASE("Adaptive sampling stops on precision, the sample cap or the time budget" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 0;
+        policy.measurement_iterations = 10;
+        policy.max_iterations = 25;
+
+        // Fixed count leaves the stop reason empty but still reports the achieved precision
+        CountingAdapter fixed;
+        REQUIRE(fixed.Initialize(AdapterArgs{}).ok());
+        auto plain = Harness::RunCase(fixed, scene, policy);
+        REQUIRE(plain.decision == CaseDecision::kExecute);
+        CHECK(plain.sampling_stop.empty());
+        CHECK(plain.stats.sample_count == 10);
+        CHECK(plain.stats.wall_ci_low_ns <= plain.stats.wall_p50_ns);
+        CHECK(plain.stats.wall_ci_high_ns >= plain.stats.wall_p50_ns);
+
+        // A loose target is met as soon as the minimum is reached
+        policy.target_ci = 10.0;
+        JitterAdapter loose;
+        REQUIRE(loose.Initialize(AdapterArgs{}).ok());
+        auto met = Harness::RunCase(loose, scene, policy);
+        REQUIRE(met.decision == CaseDecision::kExecute);
+        CHECK(met.sampling_stop == "ci");
+        CHECK(met.stats.sample_count == 10);
+        CHECK(met.stats.wall_ci_rel <= 10.0);
+
+        // An unreachable target runs to the cap
+        policy.target_ci = 1e-6;
+        JitterAdapter jitter;
+        REQUIRE(jitter.Initialize(AdapterArgs{}).ok());
+        auto capped = Harness::RunCase(jitter, scene, policy);
+        REQUIRE(capped.decision == CaseDecision::kExecute);
+        CHECK(capped.sampling_stop == "max_iterations");
+        CHECK(capped.stats.sample_count == 25);
+        CHECK(capped.stats.wall_ci_rel > 1e-6);
+
+        // An exhausted budget stops right after the minimum
+        policy.time_budget_s = 0.0;
+        JitterAdapter budget;
+        REQUIRE(budget.Initialize(AdapterArgs{}).ok());
+        auto timed_out = Harness::RunCase(budget, scene, policy);
+        REQUIRE(timed_out.decision == CaseDecision::kExecute);
+        CHECK(timed_out.sampling_stop == "time_budget");
+        CHECK(timed_out.stats.sample_count == 10);
+    }
+
+    TEST_CASE("ComputeStats reports tails, robust spread and outliers" *
+              doctest::test_suite("harness")) {
+        // 1..99 us plus one 10 ms hiccup, shuffled
+        std::vector<int64_t> wall;
+        for (int64_t i = 1; i < 100; ++i) {
+            wall.push_back(i * 1000);
+        }
+        wall.push_back(10'000'000);
+        std::reverse(wall.begin(), wall.end());
+        std::vector<int64_t> cpu = wall;
+        const auto stats = ComputeStats(wall, cpu);
+
+        CHECK(stats.sample_count == 100);
+        CHECK(stats.wall_min_ns == 1000);
+        CHECK(stats.wall_max_ns == 10'000'000);
+        CHECK(stats.wall_p50_ns == 50'500);
+        CHECK(stats.wall_p95_ns == 95'050);
+        CHECK(stats.wall_p99_ns > 99'000);
+        CHECK(stats.wall_p999_ns > stats.wall_p99_ns);
+        CHECK(stats.wall_mad_ns == 25'000);
+        CHECK(stats.wall_outliers == 1);
+        CHECK(stats.wall_far_outliers == 1);
+        CHECK(stats.wall_mean_ns == doctest::Approx((4950.0 * 1000.0 + 1e7) / 100.0));
+
+        // Bootstrap interval brackets the median, is reproducible and near the exact one
+        CHECK(stats.wall_boot_low_ns <= stats.wall_p50_ns);
+        CHECK(stats.wall_boot_high_ns >= stats.wall_p50_ns);
+        CHECK(stats.wall_boot_low_ns >= stats.wall_ci_low_ns - 5000);
+        CHECK(stats.wall_boot_high_ns <= stats.wall_ci_high_ns + 5000);
+        std::sort(wall.begin(), wall.end());
+        CHECK(BootstrapMedianInterval(wall) ==
+              std::pair<int64_t, int64_t>{stats.wall_boot_low_ns, stats.wall_boot_high_ns});
+    }
+
+    TEST_CASE("Mann-Kendall z flags monotonic trends only" * doctest::test_suite("harness")) {
+        std::vector<int64_t> rising(16);
+        for (size_t i = 0; i < rising.size(); ++i) {
+            rising[i] = static_cast<int64_t>(i) * 100;
+        }
+        const std::vector<int64_t> falling(rising.rbegin(), rising.rend());
+        CHECK(MannKendallZ(rising) > kZ95);
+        CHECK(MannKendallZ(falling) < -kZ95);
+        CHECK(MannKendallZ(std::vector<int64_t>(16, 500)) == 0.0);
+        CHECK(std::abs(MannKendallZ({5, 1, 5, 1, 5, 1, 5, 1, 5, 1, 5, 1})) < kZ95);
+    }
+
+    TEST_CASE("Auto warmup runs until frame times settle, within its bounds" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 3;
+        policy.measurement_iterations = 3;
+        policy.auto_warmup = true;
+
+        // No trend: settles as soon as two windows are available
+        JitterAdapter steady;
+        REQUIRE(steady.Initialize(AdapterArgs{}).ok());
+        auto flat = Harness::RunCase(steady, scene, policy);
+        REQUIRE(flat.decision == CaseDecision::kExecute);
+        CHECK(flat.warmup_frames == 2 * kWarmupWindow);
+        CHECK(flat.reasons.empty());
+
+        // Cold start: keeps warming past the decay, reports the cold frame
+        DecayAdapter cold;
+        REQUIRE(cold.Initialize(AdapterArgs{}).ok());
+        auto warmed = Harness::RunCase(cold, scene, policy);
+        REQUIRE(warmed.decision == CaseDecision::kExecute);
+        CHECK(warmed.warmup_frames > 2 * kWarmupWindow);
+        CHECK(warmed.warmup_frames < policy.max_warmup_iterations);
+        CHECK(warmed.first_frame_ns >= 2'000'000);
+        CHECK(warmed.stats.wall_p50_ns < 2 * 20'000 + 20'000);
+        CHECK(warmed.reasons.empty());
+
+        // Cap reached while still warming: measured anyway, flagged
+        policy.max_warmup_iterations = 20;
+        DecayAdapter capped;
+        REQUIRE(capped.Initialize(AdapterArgs{}).ok());
+        auto unsettled = Harness::RunCase(capped, scene, policy);
+        REQUIRE(unsettled.decision == CaseDecision::kExecute);
+        CHECK(unsettled.warmup_frames == 20);
+        REQUIRE(!unsettled.reasons.empty());
+        CHECK(unsettled.reasons[0].starts_with("WARMUP_NOT_SETTLED"));
+
+        // Fixed warmup still reports its frame count and first frame
+        policy.auto_warmup = false;
+        CountingAdapter fixed;
+        REQUIRE(fixed.Initialize(AdapterArgs{}).ok());
+        auto plain = Harness::RunCase(fixed, scene, policy);
+        CHECK(plain.warmup_frames == 3);
+        CHECK(plain.first_frame_ns > 0);
+    }
+
+    TEST_CASE("Repetitions run on fresh adapters and split the variance" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 4;
+        policy.repetitions = 3;
+
+        std::vector<CountingAdapter*> instances;
+        auto factory = [&]() -> std::unique_ptr<IBackendAdapter> {
+            auto adapter = std::make_unique<CountingAdapter>();
+            instances.push_back(adapter.get());
+            return adapter;
+        };
+        auto result = Harness::RunRepeated(factory, AdapterArgs{}, scene, policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(instances.size() == 3);
+        CHECK(result.repetitions.count == 3);
+        REQUIRE(result.repetitions.wall_p50_ns.size() == 3);
+        auto p50s = result.repetitions.wall_p50_ns;
+        std::sort(p50s.begin(), p50s.end());
+        CHECK(result.stats.wall_p50_ns == p50s[1]);  // The median repetition is reported
+        CHECK(result.stats.sample_count == 4);
+
+        auto missing = Harness::RunRepeated([] { return std::unique_ptr<IBackendAdapter>(); },
+                                            AdapterArgs{}, scene, policy);
+        CHECK(missing.decision == CaseDecision::kFail);
+        REQUIRE(!missing.reasons.empty());
+        CHECK(missing.reasons[0].starts_with("INIT_FAILED"));
+
+        // Two runs of 3 samples: means 10 and 20, both with stddev 1
+        TimingStats a;
+        a.sample_count = 3;
+        a.wall_mean_ns = 10.0;
+        a.wall_stddev_ns = 1.0;
+        TimingStats b = a;
+        b.wall_mean_ns = 20.0;
+        const auto spread = ComputeRepetitionStats({a, b});
+        CHECK(spread.within_stddev_ns == doctest::Approx(1.0));
+        CHECK(spread.between_stddev_ns == doctest::Approx(std::sqrt(50.0)));
+    }
+
+    TEST_CASE("Multi-instance runs render concurrently on separate instances" *
+              doctest::test_suite("harness")) {
+        auto wide = ir::IrLoader::CreateTestScene(32, 32);
+        auto tall = ir::IrLoader::CreateTestScene(16, 64);
+        tall.scene_id = "test/tall";
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 2;
+        policy.instances = 3;
+        policy.instance_time_s = 0.02;
+
+        std::vector<CountingAdapter*> created;  // The factory runs under the setup lock
+        auto factory = [&]() -> std::unique_ptr<IBackendAdapter> {
+            auto adapter = std::make_unique<CountingAdapter>();
+            created.push_back(adapter.get());
+            return adapter;
+        };
+        auto multi = Harness::RunInstances(factory, AdapterArgs{}, {&wide, &tall}, policy, 1000);
+        REQUIRE(multi.ok());
+        const auto& stats = multi.value();
+        CHECK(created.size() == 3);
+        CHECK(stats.instance_count == 3);
+        REQUIRE(stats.instances.size() == 3);
+        CHECK(stats.instances[0].scene_id == wide.scene_id);
+        CHECK(stats.instances[1].scene_id == "test/tall");
+        CHECK(stats.instances[2].scene_id == wide.scene_id);
+
+        int frames = 0;
+        const auto allowed = pal::GetAllowedCpus();  // Instances report OS IDs, not indices
+        for (const auto& instance : stats.instances) {
+            if (!allowed.empty()) {
+                CHECK(std::find(allowed.begin(), allowed.end(), instance.core) != allowed.end());
+            }
+            CHECK(instance.frame_count > 0);
+            CHECK(instance.latency_p50_ns <= instance.latency_p99_ns);
+            frames += instance.frame_count;
+        }
+        CHECK(stats.frame_count == frames);
+        CHECK(stats.duration_s >= 0.02);
+        CHECK(stats.aggregate_fps > 0.0);
+        CHECK(stats.scaling_efficiency > 0.0);
+
+        auto missing = Harness::RunInstances([] { return std::unique_ptr<IBackendAdapter>(); },
+                                             AdapterArgs{}, {&wide}, policy);
+        REQUIRE(missing.failed());
+        CHECK(missing.status().message.starts_with("INIT_FAILED"));
+    }
+
+    TEST_CASE("A binding ISA cap skips backends that cannot honor it" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        CountingAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 2;
+        policy.max_isa = pal::HighestIsaLevel();  // Not binding: runs as native
+        auto native = Harness::RunCase(adapter, scene, policy);
+        CHECK(native.decision == CaseDecision::kExecute);
+        CHECK(native.max_isa == pal::IsaLevelName(pal::HighestIsaLevel()));
+
+        if (pal::HighestIsaLevel() != pal::IsaLevel::kScalar) {
+            policy.max_isa = pal::IsaLevel::kScalar;
+            auto capped = Harness::RunCase(adapter, scene, policy);
+            CHECK(capped.decision == CaseDecision::kSkip);
+            REQUIRE(!capped.reasons.empty());
+            CHECK(capped.reasons[0] == "UNSUPPORTED_FEATURE:isa_cap");
+            CHECK(capped.max_isa == "scalar");
+        }
+    }
+
+    TEST_CASE("InitializeAdapter moves the measuring thread to its CPU after startup" *
+              doctest::test_suite("harness")) {
+        const auto allowed = pal::GetAllowedCpus();
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 0;
+        policy.measurement_iterations = 2;
+        policy.prefault = true;
+        if (!allowed.empty()) {
+            policy.worker_cpus = allowed;
+            policy.orchestrator_cpu = allowed.back();
+        }
+
+        // On a scratch thread, so the test runner keeps its CPUs
+        Status status = Status::Ok();
+        CaseDecision decision = CaseDecision::kFail;
+        std::vector<int> measuring_cpus;
+        std::thread([&] {
+            CountingAdapter adapter;
+            status = Harness::InitializeAdapter(adapter, AdapterArgs{}, policy);
+            measuring_cpus = pal::GetAllowedCpus();
+            decision =
+                Harness::RunCase(adapter, ir::IrLoader::CreateTestScene(32, 32), policy).decision;
+        }).join();
+        CHECK(status.ok());
+        CHECK(decision == CaseDecision::kExecute);
+#if defined(__linux__)
+        CHECK(measuring_cpus == std::vector<int>{allowed.back()});
+#endif
+    }
+
+    TEST_CASE("Cold-buffer mode rotates scene copies and output buffers" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        AddressAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 6;
+        policy.rotate_buffers = 3;
+        auto result = Harness::RunCase(adapter, scene, policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.cold_buffers.rotation == 3);
+        CHECK(result.cold_buffers.evict_bytes == 0);
+        CHECK(result.cold_buffers.wall_p90_ns >= result.cold_buffers.wall_p50_ns);
+        CHECK(result.stats.sample_count == 6);  // Warm results are reported as before
+        CHECK(adapter.scenes.size() == 3);      // The scene itself and two copies
+        CHECK(adapter.buffers.size() == 4);     // The warm buffer and three rotated ones
+
+        // Eviction alone runs cold on a single scene and buffer
+        policy.measurement_iterations = 1;
+        policy.rotate_buffers = 0;
+        policy.evict_llc = true;
+        auto evicted = Harness::RunCase(adapter, scene, policy);
+        REQUIRE(evicted.decision == CaseDecision::kExecute);
+        CHECK(evicted.cold_buffers.rotation == 1);
+        CHECK(evicted.cold_buffers.evict_bytes > 0);
+    }
+
+    TEST_CASE("Surface policy pads rows and aligns the output buffer" *
+              doctest::test_suite("harness")) {
+        CHECK(Harness::PaddedStride(16) == 64);
+        CHECK(Harness::PaddedStride(97) == 448);    // 388 bytes, rounded up to a cache line
+        CHECK(Harness::PaddedStride(256) == 1088);  // 1024 bytes alias: one more line
+
+        auto scene = ir::IrLoader::CreateTestScene(256, 16);
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 2;
+        policy.pad_stride = true;
+        policy.surface_memory.alignment = 4096;
+
+        LayoutAdapter padded(true);
+        REQUIRE(padded.Initialize(AdapterArgs{}).ok());
+        auto result = Harness::RunCase(padded, scene, policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.stride == 1088);
+        CHECK(padded.stride == 1088);
+        CHECK(padded.buffer_size == 1088 * 16);
+        CHECK(padded.address % 4096 == 0);
+
+        // Backends that only write tight rows are skipped rather than handed padding
+        LayoutAdapter tight(false);
+        REQUIRE(tight.Initialize(AdapterArgs{}).ok());
+        auto skipped = Harness::RunCase(tight, scene, policy);
+        CHECK(skipped.decision == CaseDecision::kSkip);
+        REQUIRE(!skipped.reasons.empty());
+        CHECK(skipped.reasons[0] == "UNSUPPORTED_FEATURE:surface_stride");
+
+        policy.pad_stride = false;
+        auto plain = Harness::RunCase(tight, scene, policy);
+        REQUIRE(plain.decision == CaseDecision::kExecute);
+        CHECK(plain.stride == 1024);
+        CHECK(tight.buffer_size == 1024 * 16);
+        CHECK(tight.address % 4096 == 0);
+    }
+
+    TEST_CASE("Automatic batch size is a power of two within bounds" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        CountingAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 0;
+        policy.measurement_iterations = 3;
+        policy.batch_frames = 0;
+        auto result = Harness::RunCase(adapter, scene, policy);
+
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        const int batch = result.batch_frames;
+        CHECK(batch >= 1);
+        CHECK(batch <= kMaxAutoBatchFrames);
+        CHECK((batch & (batch - 1)) == 0);
+        // A null frame is far below the sample target, so calibration must have batched
+        CHECK(batch > 1);
+    }
+
+    TEST_CASE("Throughput mode keeps pipeline_depth frames in flight" *
+              doctest::test_suite("harness")) {
+        auto scene = ir::IrLoader::CreateTestScene(32, 32);
+        PipelinedAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 5;
+        policy.pipeline_depth = 3;
+        auto result = Harness::RunCase(adapter, scene, policy);
+
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        const auto& tp = result.throughput;
+        CHECK(tp.pipeline_depth == 3);
+        CHECK(tp.frame_count == 3 * kPipelineFramesPerSlot);
+        CHECK(adapter.submits == tp.frame_count);
+        CHECK(adapter.max_in_flight == 3);
+        CHECK(adapter.in_flight == 0);  // Drained
+        CHECK(tp.sustained_fps > 0.0);
+        CHECK(tp.latency_p90_ns >= tp.latency_p50_ns);
+        // Per-frame timings are still reported
+        CHECK(result.stats.sample_count == 5);
+    }
+
+    TEST_CASE("OutlineStrokes replaces strokes with nonzero fills of the outlines" *
+              doctest::test_suite("harness")) {
+        const auto scene = MakeStrokedScene();
+        OutliningAdapter adapter;
+        int64_t stroker_ns = -1;
+        auto outlined = Harness::OutlineStrokes(adapter, scene, &stroker_ns);
+        REQUIRE(outlined.ok());
+        CHECK(stroker_ns >= 0);
+        CHECK(adapter.outlined == 1);
+        CHECK(adapter.last_stroke.width == doctest::Approx(4.0f));
+        CHECK(adapter.last_stroke.cap == ir::StrokeCap::kRound);
+        CHECK(adapter.last_stroke.resolution_scale == doctest::Approx(2.0f));
+
+        const auto& out = outlined.value();
+        REQUIRE(out.paths.size() == 2);
+        const auto& cs = out.command_stream;
+        CHECK(std::find(cs.begin(), cs.end(), static_cast<uint8_t>(ir::Opcode::kStrokePath)) ==
+              cs.end());
+        // SetStroke is dropped; the outline (path 1) is filled, then the rectangle (path 0)
+        const std::vector<uint8_t> tail = {static_cast<uint8_t>(ir::Opcode::kFillPath), 0x01, 0x00,
+                                           static_cast<uint8_t>(ir::Opcode::kFillPath), 0x00, 0x00,
+                                           static_cast<uint8_t>(ir::Opcode::kEnd)};
+        REQUIRE(cs.size() >= tail.size());
+        CHECK(std::equal(tail.begin(), tail.end(), cs.end() - static_cast<long>(tail.size())));
+    }
+
+    TEST_CASE("Stroke isolation times the stroker and the fill-only scene" *
+              doctest::test_suite("harness")) {
+        const auto scene = MakeStrokedScene();
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 4;
+        policy.isolate_strokes = true;
+
+        OutliningAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        auto result = Harness::RunCase(adapter, scene, policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.stroke_isolation.stroke_count == 1);
+        CHECK(adapter.outlined == 4);  // Once per measurement iteration
+        CHECK(adapter.frames == 2 * (1 + 4));
+
+        // Backends without a stroker still run the case and say why isolation is missing
+        CountingAdapter plain;
+        REQUIRE(plain.Initialize(AdapterArgs{}).ok());
+        auto unsupported = Harness::RunCase(plain, scene, policy);
+        REQUIRE(unsupported.decision == CaseDecision::kExecute);
+        CHECK(unsupported.stroke_isolation.stroke_count == 0);
+        REQUIRE(!unsupported.reasons.empty());
+        CHECK(unsupported.reasons[0].starts_with("STROKE_ISOLATION_UNSUPPORTED"));
+    }
+}
+
+}  // namespace vgcpu
@@ -18,7 +18,7 @@ TEST_SUITE("Hot-Path Allocation Enforcement") {
         SurfaceConfig config;
         config.width = 200;
         config.height = 200;
-        std::vector<uint8_t> buffer(config.width * config.height * 4, 0);
+        SurfaceBuffer buffer(config.width * config.height * 4, 0);
 
         auto backend_ids = registry.GetAdapterIds();
         for (const auto& id : backend_ids) {
@@ -26,6 +26,7 @@ TEST_SUITE("Hot-Path Allocation Enforcement") {
             REQUIRE(adapter != nullptr);
 
             CAPTURE(id);
+            config.format = adapter->GetNativeFormat();
 
             // Warmup/Init (allocations allowed here)
             AdapterArgs args;
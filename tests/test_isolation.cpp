@@ -0,0 +1,109 @@
+// tests/test_isolation.cpp
+// Blueprint Reference: [TEST-10], [ARCH-13-01]
+// Unit tests for process-isolated case execution
+
+#include "doctest.h"
+#include "harness/isolation.h"
+#include "ir/ir_loader.h"
+
+#include <chrono>
+#include <csignal>
+#include <thread>
+
+namespace vgcpu {
+
+namespace {
+
+std::vector<CaseResult> MakeExpected(int count) {
+    const auto scene = ir::IrLoader::CreateTestScene(32, 32);
+    std::vector<CaseResult> expected;
+    for (int i = 0; i < count; ++i) {
+        expected.push_back(Harness::FailedCase("null", scene, BenchmarkPolicy{}, ""));
+        expected.back().scene_id = "case" + std::to_string(i);
+    }
+    return expected;
+}
+
+CaseResult Executed(const CaseResult& placeholder) {
+    CaseResult result = placeholder;
+    result.decision = CaseDecision::kExecute;
+    result.reasons.clear();
+    result.stats.wall_p50_ns = 1234;
+    return result;
+}
+
+}  // namespace
+
+TEST_SUITE("Isolation") {
+    TEST_CASE("Case results survive the wire format" * doctest::test_suite("isolation")) {
+        CaseResult result = MakeExpected(1)[0];
+        result.decision = CaseDecision::kExecute;
+        result.reasons = {"WARMUP_NOT_SETTLED:200 frames"};
+        result.stats.wall_p50_ns = 1'500'000;
+        result.stats.wall_ci_rel = 0.0125;
+        result.multi_instance.instance_count = 2;
+        result.multi_instance.instances.resize(2);
+        result.multi_instance.instances[1].core = 3;
+        result.wall_samples = {1, 2, 3};
+        result.sample_counters = {{"minor_faults", {0, 4, 0}}};
+        result.ssim_passed = false;
+
+        auto decoded = IsolatedRunner::Decode(IsolatedRunner::Encode(result));
+        REQUIRE(decoded.ok());
+        const auto& d = decoded.value();
+        CHECK(d.backend_id == "null");
+        CHECK(d.decision == CaseDecision::kExecute);
+        CHECK(d.reasons == result.reasons);
+        CHECK(d.stats.wall_p50_ns == 1'500'000);
+        CHECK(d.stats.wall_ci_rel == doctest::Approx(0.0125));
+        REQUIRE(d.multi_instance.instances.size() == 2);
+        CHECK(d.multi_instance.instances[1].core == 3);
+        CHECK(d.wall_samples == result.wall_samples);
+        REQUIRE(d.sample_counters.size() == 1);
+        CHECK(d.sample_counters[0].values == result.sample_counters[0].values);
+        CHECK_FALSE(d.ssim_passed);
+
+        CHECK(IsolatedRunner::Decode("{not json").failed());
+    }
+
+#if !defined(_WIN32)
+    TEST_CASE("Crashes and timeouts fail only the running case" *
+              doctest::test_suite("isolation")) {
+        REQUIRE(IsolatedRunner::IsSupported());
+        const auto expected = MakeExpected(4);
+        auto results = IsolatedRunner::Run(
+            expected,
+            [&](size_t first, const IsolatedRunner::Emit& emit) {
+                for (size_t i = first; i < expected.size(); ++i) {
+                    if (i == 1) {
+                        std::raise(SIGKILL);  // Uncatchable, so no crash handler interferes
+                    }
+                    if (i == 2) {
+                        std::this_thread::sleep_for(std::chrono::seconds(30));
+                    }
+                    emit(Executed(expected[i]));
+                }
+            },
+            0.2);
+        REQUIRE(results.size() == 4);
+        CHECK(results[0].decision == CaseDecision::kExecute);
+        CHECK(results[0].stats.wall_p50_ns == 1234);
+        CHECK(results[1].decision == CaseDecision::kFail);
+        CHECK(results[1].scene_id == "case1");
+        REQUIRE(results[1].reasons.size() == 1);
+        CHECK(results[1].reasons[0].starts_with("CRASHED:"));
+        CHECK(results[2].decision == CaseDecision::kFail);
+        REQUIRE(results[2].reasons.size() == 1);
+        CHECK(results[2].reasons[0].starts_with("TIMEOUT:"));
+        CHECK(results[3].decision == CaseDecision::kExecute);
+        CHECK(results[3].scene_id == "case3");
+
+        // A child that exits cleanly without reporting (backend failed to initialize) is skipped
+        auto skipped = IsolatedRunner::Run(
+            expected, [](size_t, const IsolatedRunner::Emit&) {}, 0.0);
+        CHECK(skipped.empty());
+    }
+#endif
+}
+
+}  // namespace vgcpu
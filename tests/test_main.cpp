@@ -7,8 +7,11 @@
 
 // Include adapter registration functions for Tier-1 backends
 #include "adapters/blend2d/blend2d_adapter.h"
+#include "adapters/decode/decode_adapter.h"
 #include "adapters/null/null_adapter.h"
 #include "adapters/plutovg/plutovg_adapter.h"
+#include "adapters/tiled/tiled_adapter.h"
+#include "adapters/vgcpu_ref/ref_adapter.h"
 
 // Register adapters before tests run
 // This is done via a global constructor
@@ -19,12 +22,19 @@ struct AdapterRegistrar {
 #ifdef VGCPU_ENABLE_NULL_BACKEND
         vgcpu::RegisterNullAdapter();
 #endif
+#ifdef VGCPU_ENABLE_DECODE_BACKEND
+        vgcpu::RegisterDecodeAdapter();
+#endif
+#ifdef VGCPU_ENABLE_VGCPU_REF
+        vgcpu::RegisterVgcpuRefAdapter();
+#endif
 #ifdef VGCPU_ENABLE_PLUTOVG
         vgcpu::RegisterPlutoVGAdapter();
 #endif
 #ifdef VGCPU_ENABLE_BLEND2D
         vgcpu::RegisterBlend2DAdapter();
 #endif
+        vgcpu::RegisterTiledVariants();
     }
 };
 static AdapterRegistrar g_registrar;
@@ -3,10 +3,18 @@
 // Unit tests for Platform Abstraction Layer (PAL)
 
 #include "doctest.h"
+#include "pal/affinity.h"
+#include "pal/cpu_features.h"
+#include "pal/environment.h"
+#include "pal/memory.h"
+#include "pal/realtime.h"
 #include "pal/timer.h"
 
 #include <chrono>
+#include <cstdint>
+#include <string>
 #include <thread>
+#include <vector>
 
 TEST_SUITE("PAL Timer") {
     TEST_CASE("Monotonic clock returns increasing values" * doctest::test_suite("pal")) {
@@ -51,3 +59,157 @@ TEST_SUITE("PAL Timer") {
         CHECK(ms == doctest::Approx(1.0));
     }
 }
+
+TEST_SUITE("PAL CPU features") {
+    TEST_CASE("ISA levels are detected and named consistently" * doctest::test_suite("pal")) {
+        using vgcpu::pal::IsaLevel;
+        const IsaLevel highest = vgcpu::pal::HighestIsaLevel();
+        CHECK(vgcpu::pal::IsIsaLevelAvailable(highest));
+        CHECK(vgcpu::pal::IsIsaLevelAvailable(IsaLevel::kScalar));
+        CHECK_FALSE(vgcpu::pal::IsIsaLevelAvailable(IsaLevel::kSse2) &&
+                    vgcpu::pal::IsIsaLevelAvailable(IsaLevel::kNeon));
+
+        for (auto level : {IsaLevel::kScalar, IsaLevel::kSse2, IsaLevel::kSse42, IsaLevel::kAvx2,
+                           IsaLevel::kAvx512, IsaLevel::kNeon}) {
+            CHECK(vgcpu::pal::ParseIsaLevel(vgcpu::pal::IsaLevelName(level)) == level);
+        }
+        CHECK(vgcpu::pal::ParseIsaLevel("sse42") == IsaLevel::kSse42);
+        CHECK_FALSE(vgcpu::pal::ParseIsaLevel("mmx").has_value());
+
+        const auto env = vgcpu::pal::CollectEnvironment();
+        CHECK(env.isa_level == vgcpu::pal::IsaLevelName(highest));
+        if (highest != IsaLevel::kScalar) {
+            CHECK_FALSE(env.cpu_features.empty());
+        }
+    }
+}
+
+TEST_SUITE("PAL Environment") {
+    TEST_CASE("Noise sources are detected from the collected settings" *
+              doctest::test_suite("pal")) {
+        vgcpu::pal::EnvironmentInfo quiet;
+        quiet.cpu_cores = 16;
+        quiet.cpu_governor = "performance";
+        quiet.turbo = "off";
+        quiet.smt = "off";
+        quiet.thp_mode = "madvise";
+        quiet.aslr = 0;
+        quiet.load_average_1m = 1.5;  // Below 0.1 per CPU
+        CHECK(vgcpu::pal::DetectNoiseSources(quiet).empty());
+        CHECK(vgcpu::pal::DetectNoiseSources(vgcpu::pal::EnvironmentInfo{}).empty());  // Unknown
+
+        auto noisy = quiet;
+        noisy.cpu_governor = "performance,powersave";
+        noisy.turbo = "on";
+        noisy.smt = "on";
+        noisy.thp_mode = "always";
+        noisy.aslr = 2;
+        noisy.load_average_1m = 3.5;
+        CHECK(vgcpu::pal::DetectNoiseSources(noisy) ==
+              std::vector<std::string>{"CPU_GOVERNOR:performance,powersave", "TURBO:on", "SMT:on",
+                                       "THP:always", "ASLR:2", "LOAD:3.50"});
+
+        // The collected environment reports its own noise
+        const auto env = vgcpu::pal::CollectEnvironment();
+        CHECK(env.noise == vgcpu::pal::DetectNoiseSources(env));
+    }
+}
+
+TEST_SUITE("PAL Affinity") {
+    TEST_CASE("Threads can be pinned to an available CPU" * doctest::test_suite("pal")) {
+        const int cpus = vgcpu::pal::GetAvailableCpuCount();
+        CHECK(cpus >= 1);
+        CHECK_FALSE(vgcpu::pal::PinCurrentThread(-1));
+
+        // Pin a scratch thread, not the test runner
+        bool pinned = false;
+        bool beyond = true;
+        std::thread([&] {
+            pinned = vgcpu::pal::PinCurrentThread(cpus - 1);
+            beyond = vgcpu::pal::PinCurrentThread(cpus);
+        }).join();
+#if defined(__linux__)
+        CHECK(pinned);
+        CHECK_FALSE(beyond);
+#endif
+    }
+
+    TEST_CASE("CPU lists parse in taskset syntax" * doctest::test_suite("pal")) {
+        CHECK(vgcpu::pal::ParseCpuList("3") == std::vector<int>{3});
+        CHECK(vgcpu::pal::ParseCpuList("4-6,0,5") == std::vector<int>{0, 4, 5, 6});
+        CHECK_FALSE(vgcpu::pal::ParseCpuList(""));
+        CHECK_FALSE(vgcpu::pal::ParseCpuList("2-1"));
+        CHECK_FALSE(vgcpu::pal::ParseCpuList("-1"));
+        CHECK_FALSE(vgcpu::pal::ParseCpuList("1,x"));
+        CHECK_FALSE(vgcpu::pal::ParseCpuList("0-100000"));
+    }
+
+    TEST_CASE("Threads can be pinned to OS CPU IDs" * doctest::test_suite("pal")) {
+        const auto allowed = vgcpu::pal::GetAllowedCpus();
+        CHECK_FALSE(vgcpu::pal::PinCurrentThreadToCpus({}));
+#if defined(__linux__)
+        REQUIRE(static_cast<int>(allowed.size()) == vgcpu::pal::GetAvailableCpuCount());
+        std::vector<int> seen;
+        std::thread([&] {
+            if (vgcpu::pal::PinCurrentThreadToCpus({allowed.back()})) {
+                seen = vgcpu::pal::GetAllowedCpus();
+            }
+        }).join();
+        CHECK(seen == std::vector<int>{allowed.back()});
+#endif
+    }
+}
+
+TEST_SUITE("PAL Realtime") {
+    TEST_CASE("Prefaulting leaves buffer contents unchanged" * doctest::test_suite("pal")) {
+        std::vector<unsigned char> buffer(64 * 1024);
+        for (size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<unsigned char>(i * 31);
+        }
+        const auto copy = buffer;
+        vgcpu::pal::PrefaultWritable(buffer.data(), buffer.size());
+        vgcpu::pal::PrefaultReadable(buffer.data(), buffer.size());
+        vgcpu::pal::PrefaultWritable(nullptr, 0);
+        CHECK(buffer == copy);
+    }
+
+    TEST_CASE("Real-time priorities outside the valid range are rejected" *
+              doctest::test_suite("pal")) {
+#if !defined(_WIN32)
+        CHECK(vgcpu::pal::SetRealtimePriority(100000).code == vgcpu::StatusCode::kInvalidArg);
+#endif
+    }
+}
+
+TEST_SUITE("PAL Memory") {
+    TEST_CASE("Surface allocations honor the memory policy" * doctest::test_suite("pal")) {
+        vgcpu::pal::MemoryPolicy page;
+        page.alignment = vgcpu::pal::GetPageSize();
+        std::vector<uint8_t, vgcpu::pal::SurfaceAllocator<uint8_t>> buffer(
+            1000, 7, vgcpu::pal::SurfaceAllocator<uint8_t>(page));
+        CHECK(reinterpret_cast<uintptr_t>(buffer.data()) % page.alignment == 0);
+        buffer.resize(100'000);
+        CHECK(reinterpret_cast<uintptr_t>(buffer.data()) % page.alignment == 0);
+        CHECK(buffer[999] == 7);
+
+        vgcpu::pal::MemoryPolicy odd;
+        odd.alignment = 48;
+        CHECK(vgcpu::pal::ProbeMemoryPolicy(odd).code == vgcpu::StatusCode::kInvalidArg);
+        CHECK(vgcpu::pal::AllocateMemory(64, odd) == nullptr);
+
+        // Huge pages and NUMA binding depend on the kernel; when available, the mapping is
+        // zero-filled and aligned to the huge page size
+        vgcpu::pal::MemoryPolicy huge;
+        huge.huge_pages = vgcpu::pal::HugePages::kTransparent;
+        huge.numa = vgcpu::pal::NumaPlacement::kLocal;
+        if (vgcpu::pal::ProbeMemoryPolicy(huge).ok()) {
+            const size_t size = size_t{3} << 20;
+            auto* data = static_cast<uint8_t*>(vgcpu::pal::AllocateMemory(size, huge));
+            REQUIRE(data != nullptr);
+            CHECK(reinterpret_cast<uintptr_t>(data) % (size_t{2} << 20) == 0);
+            CHECK(data[size - 1] == 0);
+            data[0] = 1;
+            vgcpu::pal::FreeMemory(data, size, huge);
+        }
+    }
+}
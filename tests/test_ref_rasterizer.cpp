@@ -0,0 +1,261 @@
+// tests/test_ref_rasterizer.cpp
+// Blueprint Reference: [TEST-11], [ARCH-10-07]
+// Unit tests for the built-in vgcpu_ref reference rasterizer
+
+#include "adapters/vgcpu_ref/ref_adapter.h"
+#include "adapters/vgcpu_ref/ref_kernels.h"
+#include "adapters/vgcpu_ref/ref_rasterizer.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "ir/ir_format.h"
+#include "ir/ir_loader.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+namespace vgcpu {
+
+namespace {
+
+uint32_t PixelAt(const SurfaceBuffer& buffer, int width, int x, int y) {
+    const size_t i = (static_cast<size_t>(y) * width + x) * 4;
+    return buffer[i] | (buffer[i + 1] << 8) | (buffer[i + 2] << 16) |
+           (static_cast<uint32_t>(buffer[i + 3]) << 24);
+}
+
+SurfaceBuffer RenderWith(VgcpuRefAdapter& adapter, const PreparedScene& scene) {
+    SurfaceConfig config;
+    config.width = static_cast<int>(scene.width);
+    config.height = static_cast<int>(scene.height);
+    SurfaceBuffer buffer(static_cast<size_t>(config.width) * config.height * 4, 0);
+    REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+    REQUIRE(adapter.Prepare(scene).ok());
+    REQUIRE(adapter.Render(scene, config, buffer).ok());
+    adapter.Shutdown();
+    return buffer;
+}
+
+}  // namespace
+
+TEST_SUITE("Reference Rasterizer") {
+    TEST_CASE("vgcpu_ref fills the test rectangle exactly" * doctest::test_suite("vgcpu_ref")) {
+        auto scene = ir::IrLoader::CreateTestScene(400, 300);
+        VgcpuRefAdapter adapter(ref::KernelIsa::kScalar);
+        auto buffer = RenderWith(adapter, scene);
+
+        // Pixel-aligned edges: full coverage inside, background outside
+        CHECK(PixelAt(buffer, 400, 100, 100) == 0xFF0000FF);
+        CHECK(PixelAt(buffer, 400, 299, 249) == 0xFF0000FF);
+        CHECK(PixelAt(buffer, 400, 200, 175) == 0xFF0000FF);
+        CHECK(PixelAt(buffer, 400, 99, 175) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 400, 300, 175) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 400, 200, 250) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 400, 0, 0) == 0xFFFFFFFF);
+    }
+
+    TEST_CASE("Even-odd rule leaves the inner square of nested contours empty" *
+              doctest::test_suite("vgcpu_ref")) {
+        auto scene = ir::IrLoader::CreateTestScene(64, 64);
+        // Two same-direction squares: nonzero fills the inner one, even-odd does not
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kClose,  ir::PathVerb::kMoveTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kClose};
+        scene.paths[0].points = {8.0f,  8.0f,  56.0f, 8.0f,  56.0f, 56.0f, 8.0f,  56.0f,
+                                 24.0f, 24.0f, 40.0f, 24.0f, 40.0f, 40.0f, 24.0f, 40.0f};
+
+        VgcpuRefAdapter nonzero(ref::KernelIsa::kScalar);
+        auto filled = RenderWith(nonzero, scene);
+        CHECK(PixelAt(filled, 64, 32, 32) == 0xFF0000FF);
+
+        scene.command_stream[8] = static_cast<uint8_t>(ir::FillRule::kEvenOdd);
+        VgcpuRefAdapter even_odd(ref::KernelIsa::kScalar);
+        auto holed = RenderWith(even_odd, scene);
+        CHECK(PixelAt(holed, 64, 32, 32) == 0xFFFFFFFF);
+        CHECK(PixelAt(holed, 64, 12, 32) == 0xFF0000FF);
+    }
+
+    TEST_CASE("vgcpu_ref places fills under ConcatMatrix, Save and Restore" *
+              doctest::test_suite("vgcpu_ref")) {
+        auto scene = ir::IrLoader::CreateTestScene(64, 64);
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kClose};
+        scene.paths[0].points = {0.0f, 0.0f, 10.0f, 0.0f, 10.0f, 10.0f, 0.0f, 10.0f};
+
+        // Keep Clear + SetFill, then: save; translate(10, 10); scale(2); fill; restore;
+        // translate(40, 40); fill. Squares land at [10, 30) and [40, 50).
+        auto& cs = scene.command_stream;
+        cs.resize(9);
+        auto concat = [&](float a, float d, float e, float f) {
+            const float m[6] = {a, 0.0f, 0.0f, d, e, f};
+            cs.push_back(static_cast<uint8_t>(ir::Opcode::kConcatMatrix));
+            cs.insert(cs.end(), reinterpret_cast<const uint8_t*>(m),
+                      reinterpret_cast<const uint8_t*>(m) + sizeof(m));
+        };
+        auto fill = [&]() {
+            cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kFillPath), 0x00, 0x00});
+        };
+        cs.push_back(static_cast<uint8_t>(ir::Opcode::kSave));
+        concat(1.0f, 1.0f, 10.0f, 10.0f);
+        concat(2.0f, 2.0f, 0.0f, 0.0f);
+        fill();
+        cs.push_back(static_cast<uint8_t>(ir::Opcode::kRestore));
+        concat(1.0f, 1.0f, 40.0f, 40.0f);
+        fill();
+        cs.push_back(static_cast<uint8_t>(ir::Opcode::kEnd));
+
+        VgcpuRefAdapter adapter(ref::KernelIsa::kScalar);
+        auto buffer = RenderWith(adapter, scene);
+        CHECK(PixelAt(buffer, 64, 10, 10) == 0xFF0000FF);
+        CHECK(PixelAt(buffer, 64, 29, 29) == 0xFF0000FF);  // Scaled, not just translated
+        CHECK(PixelAt(buffer, 64, 9, 20) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 64, 30, 20) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 64, 40, 40) == 0xFF0000FF);  // Restore dropped the scale
+        CHECK(PixelAt(buffer, 64, 49, 49) == 0xFF0000FF);
+        CHECK(PixelAt(buffer, 64, 50, 45) == 0xFFFFFFFF);
+        CHECK(PixelAt(buffer, 64, 35, 35) == 0xFFFFFFFF);
+    }
+
+    TEST_CASE("SIMD kernels match the scalar reference" * doctest::test_suite("vgcpu_ref")) {
+        // Off-grid triangle with a translucent color exercises partial coverage and blending
+        auto scene = ir::IrLoader::CreateTestScene(97, 61);
+        scene.paints[0].color = 0x80402010;
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kClose};
+        scene.paths[0].points = {3.3f, 2.7f, 91.6f, 17.2f, 20.1f, 58.9f};
+
+        VgcpuRefAdapter scalar(ref::KernelIsa::kScalar);
+        auto expected = RenderWith(scalar, scene);
+
+        for (auto isa : {ref::KernelIsa::kSse2, ref::KernelIsa::kAvx2, ref::KernelIsa::kNeon}) {
+            if (!ref::IsIsaAvailable(isa)) {
+                continue;
+            }
+            CAPTURE(ref::IsaName(isa));
+            VgcpuRefAdapter simd(isa);
+            auto actual = RenderWith(simd, scene);
+            REQUIRE(actual.size() == expected.size());
+            int max_diff = 0;
+            for (size_t i = 0; i < actual.size(); ++i) {
+                max_diff = std::max(max_diff, std::abs(actual[i] - expected[i]));
+            }
+            CHECK(max_diff <= 1);
+        }
+    }
+
+    TEST_CASE("Stroker covers the pen width around the centerline" *
+              doctest::test_suite("vgcpu_ref")) {
+        ref::Polygon centerline;
+        centerline.points = {{10.0f, 20.0f}, {50.0f, 20.0f}, {50.0f, 60.0f}};
+        centerline.EndContour(false);
+
+        ref::StrokeStyle style;
+        style.width = 8.0f;
+        style.cap = ir::StrokeCap::kSquare;
+        style.join = ir::StrokeJoin::kMiter;
+
+        ref::Polygon outline;
+        ref::Stroker stroker;
+        stroker.Stroke(centerline, style, 0.25f, outline);
+        REQUIRE(!outline.contour_ends.empty());
+
+        ref::Rasterizer rasterizer;
+        rasterizer.Reset(64, 72);
+        rasterizer.AddPolygon(outline);
+        std::vector<float> coverage(64 * 72, 0.0f);
+        rasterizer.Sweep(ref::GetKernels(ref::KernelIsa::kScalar), false,
+                         [&](int y, int x, const float* c, int n) {
+                             for (int i = 0; i < n; ++i)
+                                 coverage[static_cast<size_t>(y) * 64 + x + i] = c[i];
+                         });
+        auto at = [&](int x, int y) { return coverage[static_cast<size_t>(y) * 64 + x]; };
+
+        CHECK(at(30, 17) == doctest::Approx(1.0f));  // Segment body
+        CHECK(at(7, 20) == doctest::Approx(1.0f));   // Square cap extends by half width
+        CHECK(at(53, 17) == doctest::Approx(1.0f));  // Miter corner
+        CHECK(at(30, 25) == doctest::Approx(0.0f));  // Outside the pen
+        CHECK(at(30, 10) == doctest::Approx(0.0f));
+    }
+
+    TEST_CASE("Stroke outlines fill exactly what the stroke covers" *
+              doctest::test_suite("vgcpu_ref")) {
+        // Round-capped open curve under a non-uniform scale, then a fill in another paint
+        auto scene = ir::IrLoader::CreateTestScene(96, 96);
+        Paint blue;
+        blue.color = 0xFFFF0000;
+        scene.paints.push_back(blue);
+        Path curve;
+        curve.verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kCubicTo};
+        curve.points = {5.0f, 40.0f, 20.0f, 0.0f, 40.0f, 80.0f, 55.0f, 20.0f};
+        scene.paths.push_back(curve);
+        Path square;
+        square.verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo, ir::PathVerb::kLineTo,
+                        ir::PathVerb::kLineTo, ir::PathVerb::kClose};
+        square.points = {10.0f, 10.0f, 30.0f, 10.0f, 30.0f, 30.0f, 10.0f, 30.0f};
+        scene.paths.push_back(square);
+
+        auto& cs = scene.command_stream;
+        cs.resize(5);  // Keep kClear
+        auto append = [&](const void* data, size_t size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            cs.insert(cs.end(), bytes, bytes + size);
+        };
+        const float scale[6] = {1.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f};
+        const float width = 7.0f;
+        cs.push_back(static_cast<uint8_t>(ir::Opcode::kConcatMatrix));
+        append(scale, sizeof(scale));
+        cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kSetFill), 0x01, 0x00, 0x00});
+        cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kSetStroke), 0x00, 0x00});
+        append(&width, sizeof(width));
+        cs.push_back(ir::PackStrokeOptions(ir::StrokeCap::kRound, ir::StrokeJoin::kRound));
+        cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kStrokePath), 0x01, 0x00});
+        cs.insert(cs.end(), {static_cast<uint8_t>(ir::Opcode::kFillPath), 0x02, 0x00});
+        cs.push_back(static_cast<uint8_t>(ir::Opcode::kEnd));
+
+        VgcpuRefAdapter stroker(ref::KernelIsa::kScalar);
+        auto outlined = Harness::OutlineStrokes(stroker, scene);
+        REQUIRE(outlined.ok());
+        REQUIRE(outlined.value().paths.size() == scene.paths.size() + 1);
+
+        VgcpuRefAdapter a(ref::KernelIsa::kScalar);
+        VgcpuRefAdapter b(ref::KernelIsa::kScalar);
+        const auto stroked = RenderWith(a, scene);
+        const auto filled = RenderWith(b, outlined.value());
+        int max_diff = 0;
+        for (size_t i = 0; i < stroked.size(); ++i) {
+            max_diff = std::max(max_diff, std::abs(stroked[i] - filled[i]));
+        }
+        CHECK(max_diff <= 1);
+        CHECK(PixelAt(filled, 96, 20, 20) == 0xFFFF0000);  // Square keeps its own paint
+    }
+
+    TEST_CASE("An ISA cap limits kernel selection" * doctest::test_suite("vgcpu_ref")) {
+        AdapterArgs args;
+        args.max_isa = pal::IsaLevel::kScalar;
+        VgcpuRefAdapter capped;
+        REQUIRE(capped.Initialize(args).ok());
+        CHECK(capped.GetIsa() == ref::KernelIsa::kScalar);
+        CHECK(capped.GetCapabilities().supports_isa_cap);
+        capped.Shutdown();
+
+        // An uncapped adapter picks the best kernels, and a pinned variant above the cap refuses
+        VgcpuRefAdapter native;
+        REQUIRE(native.Initialize(AdapterArgs{}).ok());
+        CHECK(native.GetIsa() == ref::DetectBestIsa());
+        if (native.GetIsa() != ref::KernelIsa::kScalar) {
+            VgcpuRefAdapter pinned(native.GetIsa());
+            CHECK(pinned.Initialize(args).code == StatusCode::kUnsupported);
+        }
+        native.Shutdown();
+
+        CHECK(ref::IsIsaWithinLevel(ref::KernelIsa::kSse2, pal::IsaLevel::kSse42));
+        CHECK_FALSE(ref::IsIsaWithinLevel(ref::KernelIsa::kAvx2, pal::IsaLevel::kSse42));
+        CHECK(ref::IsIsaWithinLevel(ref::KernelIsa::kAvx2, pal::IsaLevel::kAvx512));
+        CHECK_FALSE(ref::IsIsaWithinLevel(ref::KernelIsa::kNeon, pal::IsaLevel::kScalar));
+    }
+}
+
+}  // namespace vgcpu
@@ -1,10 +1,17 @@
 // tests/test_registry.cpp
-// Blueprint Reference: [TEST-10], [TEST-12], [TASK-05.02]
+// Blueprint Reference: [TEST-10], [TEST-12], [TASK-05.02], [ARCH-10-06]
 // Unit tests for Backend Adapter Registry
 
 #include "adapters/adapter_registry.h"
+#include "adapters/null/null_adapter.h"
+#include "adapters/plugin_loader.h"
 #include "doctest.h"
 
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
 TEST_SUITE("Adapter Registry") {
     TEST_CASE("Registry returns non-empty list of backends" * doctest::test_suite("registry")) {
         // [TEST-10] registry_contains_tier1
@@ -63,4 +70,69 @@ TEST_SUITE("Adapter Registry") {
         CHECK(!info.id.empty());
         CHECK(!info.detailed_name.empty());
     }
+
+    TEST_CASE("Variants are registered under their base backend" *
+              doctest::test_suite("registry")) {
+        // Parameterized variants: "<base>:<params>" ids, hidden from the base listing. A local
+        // registry keeps the probe variant out of Instance() for the rest of the run.
+        struct ProbeVariantAdapter : vgcpu::NullAdapter {
+            [[nodiscard]] vgcpu::AdapterInfo GetInfo() const override {
+                auto info = NullAdapter::GetInfo();
+                info.id = "null:test=probe";
+                return info;
+            }
+        };
+        vgcpu::AdapterRegistry registry;
+        registry.Register("null", "Null Backend (Debug/Testing)",
+                          []() { return std::make_unique<vgcpu::NullAdapter>(); });
+        registry.RegisterVariant("null", "test=probe", "Null [test=probe]",
+                                 []() { return std::make_unique<ProbeVariantAdapter>(); });
+
+        CHECK(vgcpu::AdapterRegistry::MakeVariantId("null", "test=probe") == "null:test=probe");
+        CHECK(vgcpu::AdapterRegistry::MakeVariantId("null", "") == "null");
+        CHECK(registry.HasAdapter("null:test=probe"));
+        auto variant = registry.CreateAdapter("null:test=probe");
+        REQUIRE(variant != nullptr);
+        CHECK(variant->GetInfo().id == "null:test=probe");
+
+        auto variants = registry.GetVariantIds("null");
+        CHECK(variants == std::vector<std::string>{"null:test=probe"});
+
+        CHECK(registry.GetAdapterIds() == std::vector<std::string>{"null"});
+        CHECK(registry.GetAdapterIds(true) ==
+              std::vector<std::string>{"null", "null:test=probe"});
+        CHECK(!vgcpu::AdapterRegistry::Instance().HasAdapter("null:test=probe"));
+    }
+
+#ifdef VGCPU_TEST_PLUGIN_DIR
+    TEST_CASE("Backend plugins are discovered and loaded on demand" *
+              doctest::test_suite("registry")) {
+        auto& registry = vgcpu::AdapterRegistry::Instance();
+        const std::filesystem::path dir = VGCPU_TEST_PLUGIN_DIR;
+
+        auto ids = vgcpu::DiscoverPlugins(dir);
+        CHECK(std::find(ids.begin(), ids.end(), "plugin_probe") != ids.end());
+        CHECK(vgcpu::DiscoverPlugins(dir / "missing").empty());
+
+        // Discovery alone maps nothing into the process
+        CHECK(!registry.HasAdapter("plugin_probe"));
+        CHECK(vgcpu::LoadBackendPlugin(dir, "missing").code == vgcpu::StatusCode::kNotFound);
+
+        REQUIRE(vgcpu::LoadBackendPlugin(dir, "plugin_probe").ok());
+        CHECK(registry.HasAdapter("plugin_probe"));
+        CHECK(registry.GetVariantIds("plugin_probe") ==
+              std::vector<std::string>{"plugin_probe:lazy"});
+
+        // Adapters created through the plugin ABI render like built-in ones
+        auto adapter = registry.CreateAdapter("plugin_probe:lazy");
+        REQUIRE(adapter != nullptr);
+        CHECK(adapter->Initialize(vgcpu::AdapterArgs{}).ok());
+        adapter->Shutdown();
+
+        // Loading again is a no-op
+        const size_t count = registry.GetAdapters().size();
+        CHECK(vgcpu::LoadBackendPlugin(dir, "plugin_probe").ok());
+        CHECK(registry.GetAdapters().size() == count);
+    }
+#endif
 }
@@ -0,0 +1,131 @@
+// tests/test_reporting.cpp
+// Blueprint Reference: [TEST-10], [ARCH-10-10]
+// Unit tests for raw sample retention and the columnar sample file
+
+#include "adapters/null/null_adapter.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "ir/ir_loader.h"
+#include "reporting/reporter.h"
+
+#include <filesystem>
+
+namespace vgcpu {
+
+TEST_SUITE("Reporting") {
+    TEST_CASE("RunCase keeps raw samples and optional counters in run order" *
+              doctest::test_suite("reporting")) {
+        BenchmarkPolicy policy;
+        policy.warmup_iterations = 1;
+        policy.measurement_iterations = 6;
+        policy.sample_counters = true;
+
+        NullAdapter adapter;
+        REQUIRE(adapter.Initialize(AdapterArgs{}).ok());
+        auto result = Harness::RunCase(adapter, ir::IrLoader::CreateTestScene(32, 32), policy);
+        REQUIRE(result.decision == CaseDecision::kExecute);
+        CHECK(result.wall_samples.size() == 6);
+        CHECK(result.cpu_samples.size() == 6);
+        for (const auto& counter : result.sample_counters) {
+            CHECK(counter.values.size() == 6);
+        }
+#if defined(__linux__) || defined(__APPLE__)
+        REQUIRE(result.sample_counters.size() == 4);
+        CHECK(result.sample_counters[0].name == "minor_faults");
+#endif
+    }
+
+    TEST_CASE("Sample files round-trip through delta varint columns" *
+              doctest::test_suite("reporting")) {
+        std::vector<CaseResult> results(3);
+        results[0].backend_id = "null";
+        results[0].scene_id = "test/simple_rect";
+        results[0].width = 32;
+        results[0].height = 16;
+        results[0].thread_count = 4;
+        results[0].max_isa = "sse2";
+        results[0].wall_samples = {1200, 1190, 1250, 40'000'000, 1180, 0};
+        results[0].cpu_samples = {1100, 1100, 1200, 39'000'000, 1000, -5};
+        results[0].sample_counters = {{"minor_faults", {0, 0, 3, 120, 0, 0}}};
+        results[1].backend_id = "skipped";  // No samples
+        results[2].backend_id = "big";
+        for (int64_t i = 0; i < 10'000; ++i) {
+            results[2].wall_samples.push_back(50'000 + (i * 7919) % 97);
+        }
+        results[2].cpu_samples = results[2].wall_samples;
+
+        const std::string image = SampleWriter::ToBinary(results);
+        // Steady samples take about one byte each, far below 8-byte raw storage
+        CHECK(image.size() < 2 * 2 * 10'000 + 256);
+
+        auto reader = SampleReader::FromBinary(image);
+        REQUIRE(reader.ok());
+        const auto& cases = reader.value().cases();
+        REQUIRE(cases.size() == 3);
+        CHECK(cases[0].backend_id == "null");
+        CHECK(cases[0].scene_id == "test/simple_rect");
+        CHECK(cases[0].max_isa == "sse2");
+        CHECK(cases[0].thread_count == 4);
+        CHECK(cases[0].width == 32);
+        CHECK(cases[0].height == 16);
+        CHECK(cases[0].sample_count == 6);
+        REQUIRE(cases[0].columns.size() == 3);
+        CHECK(cases[1].columns.empty());
+
+        auto wall = reader.value().ReadColumn(0, "wall_ns");
+        auto cpu = reader.value().ReadColumn(0, "cpu_ns");
+        auto faults = reader.value().ReadColumn(0, "minor_faults");
+        auto big = reader.value().ReadColumn(2, "wall_ns");
+        REQUIRE(wall.ok());
+        REQUIRE(cpu.ok());
+        REQUIRE(faults.ok());
+        REQUIRE(big.ok());
+        CHECK(wall.value() == results[0].wall_samples);
+        CHECK(cpu.value() == results[0].cpu_samples);
+        CHECK(faults.value() == results[0].sample_counters[0].values);
+        CHECK(big.value() == results[2].wall_samples);
+
+        CHECK(reader.value().ReadColumn(1, "wall_ns").status().code == StatusCode::kNotFound);
+        CHECK(reader.value().ReadColumn(7, "wall_ns").status().code == StatusCode::kNotFound);
+
+        // Files round-trip too, and damaged images are rejected instead of misread
+        const auto path = std::filesystem::temp_directory_path() / "vgcpu_test_samples.vgcs";
+        REQUIRE(SampleWriter::Write(path, results).ok());
+        auto from_file = SampleReader::Open(path);
+        REQUIRE(from_file.ok());
+        CHECK(from_file.value().cases().size() == 3);
+        std::filesystem::remove(path);
+
+        CHECK(SampleReader::FromBinary("not a sample file").failed());
+        CHECK(SampleReader::FromBinary(image.substr(0, 40)).failed());
+    }
+
+    TEST_CASE("Sample counts larger than their columns are rejected" *
+              doctest::test_suite("reporting")) {
+        CaseResult one;
+        one.backend_id = "b";
+        one.scene_id = "s";
+        one.thread_count = one.width = one.height = 1;
+        one.wall_samples = {7};
+        one.cpu_samples = {7};
+        std::string image = SampleWriter::ToBinary({one});
+        REQUIRE(SampleReader::FromBinary(image).ok());
+
+        // Index entry: "b", "s", "", threads, width, height, then the sample count varint
+        const std::string entry("\x01"
+                                "b\x01"
+                                "s\x00\x01\x01\x01\x01",
+                                9);
+        const size_t index_begin = image.find(entry);
+        REQUIRE(index_begin != std::string::npos);
+        const std::string huge = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x7F";  // 2^56 - 1
+        image.replace(index_begin + entry.size() - 1, 1, huge);
+        image[index_begin - 8] = static_cast<char>(image[index_begin - 8] + huge.size() - 1);
+
+        auto reader = SampleReader::FromBinary(image);
+        REQUIRE(reader.failed());
+        CHECK(reader.status().code == StatusCode::kInvalidArg);
+    }
+}
+
+}  // namespace vgcpu
@@ -0,0 +1,234 @@
+// tests/test_tiled.cpp
+// Blueprint Reference: [TEST-12], [REQ-35]
+// Unit tests for the tile-parallel decorator adapter and scaling report
+
+#include "adapters/null/null_adapter.h"
+#include "adapters/tiled/tiled_adapter.h"
+#include "doctest.h"
+#include "harness/harness.h"
+#include "ir/ir_format.h"
+#include "ir/ir_loader.h"
+
+#ifdef VGCPU_ENABLE_VGCPU_REF
+#include "adapters/vgcpu_ref/ref_adapter.h"
+#endif
+
+#include <cstring>
+#include <utility>
+
+namespace vgcpu {
+
+TEST_SUITE("Tiled Adapter") {
+    TEST_CASE("Tiled variant ids map back to their inner backend" *
+              doctest::test_suite("tiled")) {
+        CHECK(TiledAdapter::InnerIdOf("cairo:tiled") == "cairo");
+        CHECK(TiledAdapter::InnerIdOf("cairo") == "");
+        CHECK(TiledAdapter::InnerIdOf("cairo:aa=fast") == "");
+        CHECK(TiledAdapter::InnerIdOf(":tiled") == "");
+    }
+
+    TEST_CASE("Band scenes translate absolute transforms by the band offset" *
+              doctest::test_suite("tiled")) {
+        auto scene = ir::IrLoader::CreateTestScene(100, 80);
+        const float m[6] = {2.0f, 0.0f, 0.0f, 2.0f, 5.0f, 7.0f};
+        std::vector<uint8_t> prefix(1 + sizeof(m));
+        prefix[0] = static_cast<uint8_t>(ir::Opcode::kSetMatrix);
+        std::memcpy(prefix.data() + 1, m, sizeof(m));
+        scene.command_stream.insert(scene.command_stream.begin(), prefix.begin(), prefix.end());
+
+        auto band = TiledAdapter::MakeBandScene(scene, 40, 20);
+        REQUIRE(band.ok());
+        const auto& stream = band.value().command_stream;
+        CHECK(band.value().height == 20);
+        CHECK(band.value().width == 100);
+        REQUIRE(stream.size() == scene.command_stream.size() + prefix.size());
+
+        // Implicit band shift, then the scene's own transform pre-translated
+        float shift[6];
+        float moved[6];
+        CHECK(stream[0] == static_cast<uint8_t>(ir::Opcode::kSetMatrix));
+        std::memcpy(shift, stream.data() + 1, sizeof(shift));
+        std::memcpy(moved, stream.data() + 1 + sizeof(shift) + 1, sizeof(moved));
+        CHECK(shift[5] == doctest::Approx(-40.0f));
+        CHECK(moved[0] == doctest::Approx(2.0f));
+        CHECK(moved[4] == doctest::Approx(5.0f));
+        CHECK(moved[5] == doctest::Approx(7.0f - 40.0f));
+
+        scene.command_stream.insert(scene.command_stream.begin(), uint8_t{0x7F});
+        CHECK(TiledAdapter::MakeBandScene(scene, 0, 10).failed());
+    }
+
+    TEST_CASE("Tiled adapters rebuild their bands and unwind failed initialization" *
+              doctest::test_suite("tiled")) {
+        // Counts live inner instances; the third Initialize of a generation fails on request
+        struct Lifecycle {
+            int live = 0;
+            int created = 0;
+            int fail_at = -1;
+            bool transforms = true;
+        };
+        struct LifecycleAdapter : NullAdapter {
+            explicit LifecycleAdapter(Lifecycle& counts) : counts_(counts) {}
+            Status Initialize(const AdapterArgs& args) override {
+                if (counts_.created++ == counts_.fail_at) {
+                    return Status::Fail("inner init failed");
+                }
+                ++counts_.live;
+                return NullAdapter::Initialize(args);
+            }
+            void Shutdown() override {
+                --counts_.live;
+                NullAdapter::Shutdown();
+            }
+            [[nodiscard]] CapabilitySet GetCapabilities() const override {
+                CapabilitySet caps = NullAdapter::GetCapabilities();
+                caps.supports_transforms = counts_.transforms;
+                return caps;
+            }
+            Lifecycle& counts_;
+        };
+
+        Lifecycle counts;
+        TiledAdapter tiled("lifecycle",
+                           [&counts] { return std::make_unique<LifecycleAdapter>(counts); });
+        AdapterArgs args;
+        args.thread_count = 4;
+        REQUIRE(tiled.Initialize(args).ok());
+        CHECK(counts.live == 4);
+        args.thread_count = 2;
+        REQUIRE(tiled.Initialize(args).ok());
+        CHECK(tiled.GetBandCount() == 2);
+        CHECK(counts.live == 2);
+
+        counts.created = 0;
+        counts.fail_at = 2;
+        args.thread_count = 4;
+        CHECK(tiled.Initialize(args).failed());
+        CHECK(tiled.GetBandCount() == 0);
+        CHECK(counts.live == 0);
+        CHECK(tiled.Prepare(ir::IrLoader::CreateTestScene(16, 16)).failed());
+
+        // Bands are placed with a translate, so the inner backend must apply transforms
+        Lifecycle flat;
+        flat.transforms = false;
+        TiledAdapter untransformed(
+            "flat", [&flat] { return std::make_unique<LifecycleAdapter>(flat); });
+        CHECK(untransformed.Initialize(args).code == StatusCode::kUnsupported);
+        CHECK(flat.live == 0);
+    }
+
+#ifdef VGCPU_ENABLE_VGCPU_REF
+    TEST_CASE("Tiled rendering matches the serial inner backend" *
+              doctest::test_suite("tiled")) {
+        auto scene = ir::IrLoader::CreateTestScene(97, 61);
+        scene.paths[0].verbs = {ir::PathVerb::kMoveTo, ir::PathVerb::kLineTo,
+                                ir::PathVerb::kLineTo, ir::PathVerb::kClose};
+        scene.paths[0].points = {3.3f, 2.7f, 91.6f, 17.2f, 20.1f, 58.9f};
+        SurfaceConfig config;
+        config.width = 97;
+        config.height = 61;
+        const size_t size = static_cast<size_t>(config.width) * config.height * 4;
+
+        VgcpuRefAdapter serial(ref::KernelIsa::kScalar);
+        SurfaceBuffer expected(size, 0);
+        REQUIRE(serial.Initialize(AdapterArgs{}).ok());
+        REQUIRE(serial.Prepare(scene).ok());
+        REQUIRE(serial.Render(scene, config, expected).ok());
+
+        TiledAdapter tiled("vgcpu_ref", [] {
+            return std::make_unique<VgcpuRefAdapter>(ref::KernelIsa::kScalar);
+        });
+        AdapterArgs args;
+        args.thread_count = 4;
+        REQUIRE(tiled.Initialize(args).ok());
+        REQUIRE(tiled.Prepare(scene).ok());
+        CHECK(tiled.GetBandCount() == 4);
+        CHECK(tiled.GetCapabilities().supports_parallel_render);
+
+        // Several frames exercise the persistent workers
+        for (int frame = 0; frame < 3; ++frame) {
+            SurfaceBuffer actual(size, 0);
+            REQUIRE(tiled.Render(scene, config, actual).ok());
+            CHECK(actual == expected);
+        }
+
+        // Padded rows: same pixels at the wider stride, padding left alone
+        SurfaceConfig padded = config;
+        padded.stride = Harness::PaddedStride(config.width);
+        const size_t row_bytes = static_cast<size_t>(config.width) * 4;
+        const auto stride = static_cast<size_t>(padded.stride);
+        for (IBackendAdapter* adapter : {static_cast<IBackendAdapter*>(&serial),
+                                         static_cast<IBackendAdapter*>(&tiled)}) {
+            CHECK(adapter->GetCapabilities().supports_surface_stride);
+            SurfaceBuffer rows(stride * config.height, 0xAB);
+            REQUIRE(adapter->Render(scene, padded, rows).ok());
+            for (size_t y = 0; y < static_cast<size_t>(config.height); ++y) {
+                CHECK(std::memcmp(rows.data() + y * stride, expected.data() + y * row_bytes,
+                                  row_bytes) == 0);
+                CHECK(rows[y * stride + row_bytes] == 0xAB);
+            }
+        }
+        tiled.Shutdown();
+    }
+#endif
+
+    TEST_CASE("ApplyScaling compares tiled variants with the serial backend" *
+              doctest::test_suite("tiled")) {
+        CaseResult serial;
+        serial.backend_id = "cairo";
+        serial.scene_id = "s";
+        serial.width = serial.height = 100;
+        serial.decision = CaseDecision::kExecute;
+        serial.stats.wall_p50_ns = 8000;
+
+        CaseResult tiled = serial;
+        tiled.backend_id = "cairo:tiled";
+        tiled.thread_count = 4;
+        tiled.stats.wall_p50_ns = 2500;
+
+        CaseResult other_size = tiled;
+        other_size.width = 50;
+
+        std::vector<CaseResult> results = {serial, tiled, other_size};
+        Harness::ApplyScaling(results);
+
+        CHECK(results[0].scaling_reference_id.empty());
+        CHECK(results[1].scaling_reference_id == "cairo");
+        CHECK(results[1].speedup_vs_serial == doctest::Approx(3.2));
+        CHECK(results[1].parallel_efficiency == doctest::Approx(0.8));
+        CHECK(results[2].scaling_reference_id.empty());
+    }
+
+    TEST_CASE("ApplyScaling fits an Amdahl serial fraction over a thread sweep" *
+              doctest::test_suite("tiled")) {
+        // Serial fraction 0.2: speedup 1 / (0.2 + 0.8 / n)
+        std::vector<CaseResult> results;
+        for (const auto& [threads, wall_ns] :
+             std::vector<std::pair<int, int64_t>>{{1, 1000}, {2, 600}, {4, 400}, {8, 300}}) {
+            CaseResult r;
+            r.backend_id = "blend2d";
+            r.scene_id = "s";
+            r.width = r.height = 100;
+            r.thread_count = threads;
+            r.decision = CaseDecision::kExecute;
+            r.stats.wall_p50_ns = wall_ns;
+            results.push_back(r);
+        }
+        Harness::ApplyScaling(results);
+
+        CHECK(results[0].scaling_reference_id.empty());  // The reference itself
+        for (size_t i = 1; i < results.size(); ++i) {
+            CHECK(results[i].scaling_reference_id == "blend2d");
+            CHECK(results[i].serial_fraction == doctest::Approx(0.2));
+        }
+        CHECK(results[2].speedup_vs_serial == doctest::Approx(2.5));
+        CHECK(results[2].parallel_efficiency == doctest::Approx(0.625));
+
+        CHECK(Harness::FitSerialFraction({}) == 0.0);
+        CHECK(Harness::FitSerialFraction({{1, 1.0}}) == 0.0);
+        CHECK(Harness::FitSerialFraction({{4, 4.0}}) == doctest::Approx(0.0));
+        CHECK(Harness::FitSerialFraction({{4, 0.5}}) == 1.0);  // Slowdowns clamp
+    }
+}
+
+}  // namespace vgcpu
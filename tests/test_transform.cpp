@@ -0,0 +1,70 @@
+// tests/test_transform.cpp
+// Blueprint Reference: [TEST-10], [ARCH-10-07]
+// Unit tests for the adapter-side transform stack (SetMatrix/ConcatMatrix/Save/Restore)
+
+#include "adapters/transform_stack.h"
+#include "doctest.h"
+#include "ir/ir_format.h"
+
+#include <cmath>
+
+namespace vgcpu {
+
+namespace {
+
+/// Map (x, y) through an IR-layout matrix.
+std::array<float, 2> Map(const TransformStack::Matrix& m, float x, float y) {
+    return {m[0] * x + m[2] * y + m[4], m[1] * x + m[3] * y + m[5]};
+}
+
+}  // namespace
+
+TEST_SUITE("Transforms") {
+    TEST_CASE("ConcatMatrix applies the new transform before the current one" *
+              doctest::test_suite("transforms")) {
+        TransformStack transforms;
+        const float translate[6] = {1.0f, 0.0f, 0.0f, 1.0f, 100.0f, 50.0f};
+        const float scale[6] = {2.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f};
+        transforms.Apply(ir::Opcode::kConcatMatrix, reinterpret_cast<const uint8_t*>(translate));
+        transforms.Apply(ir::Opcode::kConcatMatrix, reinterpret_cast<const uint8_t*>(scale));
+
+        // translate(scale(p)): (1, 1) -> (2, 3) -> (102, 53)
+        auto p = Map(transforms.Current(), 1.0f, 1.0f);
+        CHECK(p[0] == doctest::Approx(102.0f));
+        CHECK(p[1] == doctest::Approx(53.0f));
+
+        // SetMatrix replaces the whole transform
+        transforms.Apply(ir::Opcode::kSetMatrix, reinterpret_cast<const uint8_t*>(scale));
+        p = Map(transforms.Current(), 1.0f, 1.0f);
+        CHECK(p[0] == doctest::Approx(2.0f));
+        CHECK(p[1] == doctest::Approx(3.0f));
+    }
+
+    TEST_CASE("Save and Restore bracket transform changes" * doctest::test_suite("transforms")) {
+        TransformStack transforms;
+        const float angle = 0.5f;
+        const float rotate[6] = {std::cos(angle), std::sin(angle), -std::sin(angle),
+                                 std::cos(angle), 0.0f,            0.0f};
+
+        transforms.Save();
+        transforms.Apply(ir::Opcode::kConcatMatrix, reinterpret_cast<const uint8_t*>(rotate));
+        CHECK_FALSE(transforms.IsIdentity());
+        transforms.Save();
+        transforms.Apply(ir::Opcode::kConcatMatrix, reinterpret_cast<const uint8_t*>(rotate));
+        auto p = Map(transforms.Current(), 1.0f, 0.0f);
+        CHECK(p[0] == doctest::Approx(std::cos(2 * angle)));
+        CHECK(p[1] == doctest::Approx(std::sin(2 * angle)));
+
+        transforms.Restore();
+        p = Map(transforms.Current(), 1.0f, 0.0f);
+        CHECK(p[0] == doctest::Approx(std::cos(angle)));
+        transforms.Restore();
+        CHECK(transforms.IsIdentity());
+
+        // Unbalanced restores are ignored
+        transforms.Restore();
+        CHECK(transforms.IsIdentity());
+    }
+}
+
+}  // namespace vgcpu
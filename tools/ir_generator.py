@@ -224,6 +224,26 @@ class IrBuilder:
         self.commands.append(Command(Opcode.STROKE_PATH, args))
         return self
     
+    def set_matrix(self, a: float, b: float, c: float, d: float, e: float, f: float):
+        """Replace the current transform (x' = a*x + c*y + e, y' = b*x + d*y + f)."""
+        self.commands.append(Command(Opcode.SET_MATRIX, struct.pack('<6f', a, b, c, d, e, f)))
+        return self
+    
+    def concat_matrix(self, a: float, b: float, c: float, d: float, e: float, f: float):
+        """Apply a transform to local coordinates before the current one."""
+        self.commands.append(Command(Opcode.CONCAT_MATRIX, struct.pack('<6f', a, b, c, d, e, f)))
+        return self
+    
+    def translate(self, tx: float, ty: float):
+        return self.concat_matrix(1, 0, 0, 1, tx, ty)
+    
+    def rotate(self, radians: float):
+        c, s = math.cos(radians), math.sin(radians)
+        return self.concat_matrix(c, s, -s, c, 0, 0)
+    
+    def scale(self, sx: float, sy: float):
+        return self.concat_matrix(sx, 0, 0, sy, 0, 0)
+    
     def save(self):
         self.commands.append(Command(Opcode.SAVE))
         return self
@@ -456,6 +476,92 @@ def create_strokes_curves_scene() -> Tuple[bytes, dict]:
         "required_features": {"needs_stroke": True}
     }
 
+def create_rotated_instances_scene() -> Tuple[bytes, dict]:
+    builder = IrBuilder(800, 600)
+    
+    # One star and one rounded blob, defined once around the origin and instanced through
+    # nested save/concat/restore, so every edge is rasterized at an arbitrary angle and scale.
+    star = Path()
+    for i in range(10):
+        radius = 40 if i % 2 == 0 else 16
+        angle = i * math.pi / 5 - math.pi / 2
+        x, y = radius * math.cos(angle), radius * math.sin(angle)
+        if i == 0: star.move_to(x, y)
+        else: star.line_to(x, y)
+    star.close()
+    star_id = builder.add_path(star)
+    blob_id = builder.add_path(Path().circle(0, 0, 30))
+    
+    paints = [builder.add_paint(Paint.solid(int(127 + 127 * math.sin(i * 0.7)),
+                                            int(127 + 127 * math.sin(i * 0.7 + 2.1)),
+                                            int(127 + 127 * math.sin(i * 0.7 + 4.2)), 200))
+              for i in range(12)]
+    outline = builder.add_paint(Paint.solid(20, 20, 20))
+    
+    builder.clear(250, 250, 250)
+    cols, rows = 12, 9
+    for row in range(rows):
+        for col in range(cols):
+            i = row * cols + col
+            builder.save()
+            builder.translate(35 + col * 66, 35 + row * 66)
+            builder.rotate(i * 0.37)
+            builder.scale(0.5 + 0.6 * ((i * 7) % 10) / 10, 0.5 + 0.6 * ((i * 3) % 10) / 10)
+            builder.set_fill(paints[i % len(paints)])
+            builder.fill_path(star_id if i % 3 else blob_id)
+            builder.set_stroke(outline, 1.5, StrokeCap.BUTT, StrokeJoin.MITER)
+            builder.stroke_path(star_id if i % 3 else blob_id)
+            builder.restore()
+    
+    return builder.build(), {
+        "scene_id": "transforms/rotated_instances",
+        "description": "108 rotated/scaled star and circle instances (nested save/concat/restore)",
+        "default_width": 800, "default_height": 600,
+        "required_features": {"needs_nonzero": True, "needs_stroke": True}
+    }
+
+def create_transformed_gradients_scene() -> Tuple[bytes, dict]:
+    builder = IrBuilder(800, 600)
+    
+    # Gradients are defined in local space, so each instance exercises the backend's
+    # inverse-mapped (rotated, skewed, anisotropically scaled) gradient span generation.
+    linear = builder.add_paint(Paint.linear(-50, 0, 50, 0, [
+        GradientStop(0.0, rgba(255, 0, 0)),
+        GradientStop(0.5, rgba(255, 255, 0)),
+        GradientStop(1.0, rgba(0, 0, 255))
+    ]))
+    radial = builder.add_paint(Paint.radial(0, 0, 50, [
+        GradientStop(0.0, rgba(255, 255, 255)),
+        GradientStop(0.6, rgba(0, 160, 255)),
+        GradientStop(1.0, rgba(0, 0, 80))
+    ]))
+    square = builder.add_path(Path().rect(-50, -50, 100, 100))
+    disc = builder.add_path(Path().circle(0, 0, 50))
+    
+    builder.clear(30, 30, 30)
+    cols, rows = 8, 6
+    for row in range(rows):
+        for col in range(cols):
+            i = row * cols + col
+            skew = 0.4 * math.sin(i * 0.9)
+            # Absolute transform per instance: rotation * skew * scale, placed on a grid
+            angle = i * 0.29
+            c, s = math.cos(angle), math.sin(angle)
+            sx, sy = 0.45 + 0.25 * (col % 3) / 2, 0.45 + 0.25 * (row % 2)
+            builder.set_matrix(c * sx, s * sx, (c * skew - s) * sy, (s * skew + c) * sy,
+                               50 + col * 100, 50 + row * 100)
+            builder.set_fill(linear if i % 2 == 0 else radial)
+            builder.fill_path(square if i % 2 == 0 else disc)
+    builder.set_matrix(1, 0, 0, 1, 0, 0)
+    
+    return builder.build(), {
+        "scene_id": "transforms/transformed_gradients",
+        "description": "Linear and radial gradients under rotated/skewed/scaled transforms",
+        "default_width": 800, "default_height": 600,
+        "required_features": {"needs_nonzero": True, "needs_linear_gradient": True,
+                              "needs_radial_gradient": True}
+    }
+
 def create_noop_scene() -> Tuple[bytes, dict]:
     builder = IrBuilder(800, 600)
     
@@ -482,6 +588,8 @@ def main():
         (create_spiral_circles_scene, 'fills/spiral_circles.irbin'),
         (create_gradients_linear_scene, 'fills/gradients_linear.irbin'),
         (create_strokes_curves_scene, 'strokes/strokes_curves.irbin'),
+        (create_rotated_instances_scene, 'transforms/rotated_instances.irbin'),
+        (create_transformed_gradients_scene, 'transforms/transformed_gradients.irbin'),
         (create_noop_scene, 'validation/noop.irbin'),
     ]
     